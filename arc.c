@@ -0,0 +1,234 @@
+#include "arc.h"
+
+/** \file
+  \brief Arcs - cut G2/G3 arcs into chords
+
+  An arc becomes a series of straight moves, each short enough to stay within
+  ARC_TOLERANCE of the true arc. Chords are queued one at a time, as the
+  movebuffer has room, by arc_segment() called from the main loop. A full
+  circle takes no more memory than a single G1 this way, and the commands
+  after the arc wait in the command queue until its last chord is queued.
+
+  The point on the arc is kept relative to the center and rotated by the
+  same angle for each chord, which takes four multiplications. Angles are
+  binary, a full turn is \f$2^{32}\f$, and sine, cosine and arc tangent come
+  from CORDIC, so there's no floating point involved. The last chord ends
+  exactly at the programmed endpoint, so rounding errors don't add up.
+
+  With ARC_NATIVE, arcs in the XY plane without helical motion skip all this
+  and go into the movebuffer as a single entry, see dda_create_arc().
+*/
+
+#include <string.h>
+#include <avr/pgmspace.h>
+
+#include "dda.h"
+#include "dda_queue.h"
+#include "dda_maths.h"
+#include "sersendf.h"
+
+#ifdef ARC_TOLERANCE
+
+/// binary angle units per radian, \f$2^{32} / 2 \pi\f$
+#define ANGLE_PER_RADIAN 683565276UL
+
+/// longest chord, in binary angle units, an eighth of a turn
+#define CHORD_ANGLE_MAX 0x20000000UL
+
+/// positions on the arc have this many fractional bits
+#define ARC_FRACTION 8
+
+/// the plane arcs are in, set by G17 to G19
+uint8_t arc_plane = ARC_PLANE_XY;
+
+/// chords still to be queued, zero when no arc is in progress
+uint32_t arc_segments = 0;
+
+/// everything needed to queue the next chord
+static struct {
+  uint8_t axis_0; ///< first axis of the plane, e.g. X for G17
+  uint8_t axis_1; ///< second axis of the plane, e.g. Y for G17
+  uint8_t linear; ///< axis perpendicular to the plane, for helices
+  int32_t center_0; ///< center on axis_0
+  int32_t center_1; ///< center on axis_1
+  int32_t point_0; ///< current point relative to center, 24.8
+  int32_t point_1; ///< current point relative to center, 24.8
+  int32_t cos; ///< cosine of the angle of each chord, 2.30
+  int32_t sin; ///< sine of that angle, negative clockwise, 2.30
+  int32_t linear_start; ///< start on the linear axis
+  int32_t linear_delta; ///< travel along the linear axis
+  uint32_t count; ///< number of chords in total
+  TARGET target; ///< endpoint of the arc and its feedrate
+} arc;
+
+/// the axis of a TARGET, 0 to 2 for X, Y and Z
+static int32_t *axis(TARGET *t, uint8_t a) {
+  return (a == 0) ? &t->X : ((a == 1) ? &t->Y : &t->Z);
+}
+
+/** start an arc
+  \param cmd the G2 or G3, with the endpoint made absolute already
+  \param ccw counterclockwise (G3) or clockwise (G2)
+
+  The arc starts at \ref startpoint and is in \ref arc_plane. Its center is
+  given either by the I, J and K offsets from the start or by the radius R,
+  which takes the shorter of the two possible arcs when positive and the
+  longer one when negative. The third axis moves linearly along, which makes
+  a helix. Start and end at the same point make a full circle.
+
+  Queues the first chord right away, the rest is left to arc_segment().
+*/
+void arc_start(GCODE_COMMAND *cmd, uint8_t ccw) {
+  int32_t start_0, start_1, end_0, end_1, offset_0, offset_1;
+  uint32_t hi, lo, radius, chord, sweep, full;
+
+  memcpy(&arc.target, &cmd->target, sizeof(TARGET));
+  arc.axis_0 = (arc_plane == ARC_PLANE_XY) ? 0 :
+               ((arc_plane == ARC_PLANE_ZX) ? 2 : 1);
+  arc.axis_1 = (arc_plane == ARC_PLANE_XY) ? 1 :
+               ((arc_plane == ARC_PLANE_ZX) ? 0 : 2);
+  arc.linear = 3 - arc.axis_0 - arc.axis_1;
+
+  start_0 = *axis(&startpoint, arc.axis_0);
+  start_1 = *axis(&startpoint, arc.axis_1);
+  end_0 = *axis(&arc.target, arc.axis_0) - start_0;
+  end_1 = *axis(&arc.target, arc.axis_1) - start_1;
+  arc.linear_start = *axis(&startpoint, arc.linear);
+  arc.linear_delta = *axis(&arc.target, arc.linear) - arc.linear_start;
+
+  if (cmd->seen_R) {
+    // center is on the perpendicular bisector of the chord, h away from it
+    uint32_t d, h, r_hi, r_lo;
+    int8_t side;
+
+    hi = square_sum(end_0, end_1, &lo);
+    d = sqrt_wide(hi, lo);
+    if (d == 0) {
+      sersendf_P(PSTR("E: Bad arc"));
+      return;
+    }
+    // h^2 = R^2 - (d / 2)^2, zero for a half circle or a radius too small
+    radius = (cmd->R < 0) ? -cmd->R : cmd->R;
+    r_hi = mul_wide(radius, radius, &r_lo);
+    lo = (lo >> 2) | (hi << 30);
+    hi >>= 2;
+    if (r_hi > hi || (r_hi == hi && r_lo > lo))
+      h = sqrt_wide(r_hi - hi - (r_lo < lo), r_lo - lo);
+    else
+      h = 0;
+    // left of the chord for the short way counterclockwise
+    side = ((cmd->R < 0) == (ccw != 0)) ? -1 : 1;
+    offset_0 = end_0 / 2 - side * muldiv(end_1, h, d);
+    offset_1 = end_1 / 2 + side * muldiv(end_0, h, d);
+  }
+  else {
+    offset_0 = (arc.axis_0 == 0) ? cmd->I : ((arc.axis_0 == 1) ? cmd->J : cmd->K);
+    offset_1 = (arc.axis_1 == 0) ? cmd->I : ((arc.axis_1 == 1) ? cmd->J : cmd->K);
+  }
+
+  hi = square_sum(offset_0, offset_1, &lo);
+  radius = sqrt_wide(hi, lo);
+  end_0 -= offset_0;
+  end_1 -= offset_1;
+  // positions are kept with fractional bits, so there's a limit
+  if (radius == 0 || radius >= (1UL << (31 - ARC_FRACTION)) ||
+      end_0 >= 0x40000000L || end_0 <= -0x40000000L ||
+      end_1 >= 0x40000000L || end_1 <= -0x40000000L) {
+    sersendf_P(PSTR("E: Bad arc"));
+    return;
+  }
+
+  arc.center_0 = start_0 + offset_0;
+  arc.center_1 = start_1 + offset_1;
+  arc.point_0 = -offset_0 * (1L << ARC_FRACTION);
+  arc.point_1 = -offset_1 * (1L << ARC_FRACTION);
+
+  // angle from start to end in the direction of travel, zero is a full turn
+  sweep = cordic_atan2(end_1, end_0) - cordic_atan2(-offset_1, -offset_0);
+  if ( ! ccw)
+    sweep = -sweep;
+  full = (sweep == 0);
+
+  // The sagitta of a chord of angle a is r * (1 - cos(a / 2)), about
+  // r * a^2 / 8. Keeping it below the tolerance e gives a = 2 * sqrt(2e / r).
+  if (2UL * ARC_TOLERANCE >= radius)
+    chord = CHORD_ANGLE_MAX;
+  else {
+    chord = mul_shift(int_sqrt(div_wide(2UL * ARC_TOLERANCE, 0, radius)),
+                      ANGLE_PER_RADIAN, 15);
+    if (chord > CHORD_ANGLE_MAX)
+      chord = CHORD_ANGLE_MAX;
+    if (chord == 0)
+      chord = 1;
+  }
+  if (full)
+    arc.count = div_wide(0, 0xFFFFFFFF, chord) + 1;
+  else
+    arc.count = (sweep - 1) / chord + 1;
+  chord = div_wide(full, sweep, arc.count);
+
+#ifdef ARC_NATIVE
+  // the step generator does flat XY arcs by itself, in one go
+  if (arc_plane == ARC_PLANE_XY && arc.linear_delta == 0) {
+    // length is radius times sweep in radians
+    hi = mul_wide(radius, sweep, &lo);
+    if (full)
+      hi += radius;
+    enqueue_arc(&arc.target, arc.center_0, arc.center_1,
+                div_wide(hi, lo, ANGLE_PER_RADIAN), ccw,
+                full || sweep >= 0x80000000UL);
+    return;
+  }
+#endif
+
+#ifdef INVERSE_TIME
+  // G93, each chord takes its share of the time
+  if (arc.target.F & F_INVERSE_TIME) {
+    hi = mul_wide(arc.target.F & ~F_INVERSE_TIME, arc.count, &lo);
+    arc.target.F = F_INVERSE_TIME |
+                   ((hi || lo > ~F_INVERSE_TIME) ? ~F_INVERSE_TIME : lo);
+  }
+#endif
+
+  cordic_sincos(chord, &arc.cos, &arc.sin);
+  if ( ! ccw)
+    arc.sin = -arc.sin;
+
+  arc_segments = arc.count;
+  arc_segment();
+}
+
+/** queue the next chord of the arc
+
+  Call this whenever \ref arc_segments isn't zero and the movebuffer isn't
+  full, before processing any other commands.
+*/
+void arc_segment() {
+  TARGET t;
+  int32_t p;
+
+  if (arc_segments == 0)
+    return;
+
+  if (--arc_segments == 0) {
+    enqueue(&arc.target);
+    return;
+  }
+
+  // rotate the point around the center
+  p = mul_q30(arc.point_0, arc.cos) - mul_q30(arc.point_1, arc.sin);
+  arc.point_1 = mul_q30(arc.point_0, arc.sin) + mul_q30(arc.point_1, arc.cos);
+  arc.point_0 = p;
+
+  memcpy(&t, &arc.target, sizeof(TARGET));
+  *axis(&t, arc.axis_0) = arc.center_0 +
+    ((arc.point_0 + (1L << (ARC_FRACTION - 1))) >> ARC_FRACTION);
+  *axis(&t, arc.axis_1) = arc.center_1 +
+    ((arc.point_1 + (1L << (ARC_FRACTION - 1))) >> ARC_FRACTION);
+  *axis(&t, arc.linear) = arc.linear_start +
+    muldiv(arc.linear_delta, arc.count - arc_segments, arc.count);
+
+  enqueue(&t);
+}
+
+#endif /* ARC_TOLERANCE */
@@ -0,0 +1,32 @@
+#ifndef _ARC_H
+#define _ARC_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "gcode_parse.h"
+
+#ifdef ARC_TOLERANCE
+
+/// planes selected by G17, G18 and G19
+enum {
+  ARC_PLANE_XY,
+  ARC_PLANE_ZX,
+  ARC_PLANE_YZ
+};
+
+/// the plane arcs are in, one of the above
+extern uint8_t arc_plane;
+
+/// chords of the current arc still to be queued, see arc_segment()
+extern uint32_t arc_segments;
+
+// start an arc from startpoint to cmd->target
+void arc_start(GCODE_COMMAND *cmd, uint8_t ccw);
+
+// queue the next chord of the current arc
+void arc_segment(void);
+
+#endif /* ARC_TOLERANCE */
+
+#endif  /* _ARC_H */
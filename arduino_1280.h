@@ -16,6 +16,7 @@
 #define  OC0A        DIO13
 #define  OC0B        DIO4
 #define  OC1A        DIO11
+#define  OC1A_IS_DIO11 1 // see IS_OC1A() in pinio.h
 #define  OC1B        DIO12
 #define  OC2A        DIO10
 #define  OC2B        DIO9
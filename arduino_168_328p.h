@@ -16,6 +16,7 @@
 #define OC0A DIO6
 #define OC0B DIO5
 #define OC1A DIO9
+#define OC1A_IS_DIO9 1 // see IS_OC1A() in pinio.h
 #define OC1B DIO10
 #define OC2A DIO11
 #define OC2B DIO3
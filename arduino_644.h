@@ -21,6 +21,7 @@
 #define  OC0A        DIO3
 #define  OC0B        DIO4
 #define  OC1A        DIO13
+#define  OC1A_IS_DIO13 1 // see IS_OC1A() in pinio.h
 #define  OC1B        DIO12
 #define  OC2A        DIO15
 #define  OC2B        DIO14
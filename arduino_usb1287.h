@@ -4,6 +4,10 @@
 #define  MOSI        DIO10
 #define  SS          DIO8
 
+// timers and PWM
+#define  OC1A        DIO13
+#define  OC1A_IS_DIO13 1 // see IS_OC1A() in pinio.h
+
 // change for your board
 #define  DEBUG_LED    DIO31 /* led D5 red */
 
@@ -0,0 +1,200 @@
+#include "comp.h"
+
+/** \file
+  \brief Cutter radius compensation - G40, G41 and G42
+
+  With compensation on, the tool runs parallel to the programmed path, its
+  radius to the left (G41) or right (G42) of it, so the edge of the cutter
+  follows the path. Straight moves in the XY plane are compensated, Z moves
+  along as programmed.
+
+  Where two moves meet, the offset paths either cross, on the inside of the
+  corner, or leave a gap, on the outside. Which one it is shows only when
+  the next move arrives, so each move is held back until then, a lookahead
+  of one move. On the inside, the first move ends and the next one starts
+  where the offset paths cross. On the outside, an arc around the corner
+  closes the gap, keeping the tool at exactly its radius from it.
+
+  The first move after G41 or G42 goes straight onto the offset path, the
+  first one after G40 straight back to the programmed path. Anything else
+  than a G0 or G1 lets the move held back go first; the corner after it is
+  then resolved from where the tool stopped, which is fine on the outside
+  and backs up along the offset path on the inside.
+*/
+
+#include <string.h>
+
+#include "dda_queue.h"
+#include "dda_maths.h"
+#include "arc.h"
+
+#ifdef CUTTER_COMP
+
+#ifndef TOOL_TABLE
+  #error CUTTER_COMP needs TOOL_TABLE for the tool radius
+#endif
+
+/// what's become of the last move
+enum {
+  COMP_NONE,  ///< there was none since G41/G42
+  COMP_HELD,  ///< held back, where it ends depends on the next one
+  COMP_QUEUED ///< queued up to its offset end already
+};
+
+int8_t comp_side = COMP_OFF;
+
+uint8_t comp_engaged = 0;
+
+TARGET comp_target;
+
+/// everything about the move held back
+static struct {
+  int32_t radius; ///< of the tool, in micrometers
+  int32_t offset_x; ///< of the last move, radius long, towards the tool
+  int32_t offset_y; ///< of the last move, radius long, towards the tool
+  TARGET held; ///< the last move as programmed, for Z and F of the moves made from it
+  uint8_t state; ///< one of the above
+} comp;
+
+/// queue a move like the one held back, but ending at (x, y)
+static void comp_goto(int32_t x, int32_t y) {
+  TARGET t;
+
+  memcpy(&t, &comp.held, sizeof(TARGET));
+  t.X = x;
+  t.Y = y;
+  enqueue(&t);
+}
+
+/** get around the corner at the end of the move held back
+  \param x offset of the next move, X
+  \param y offset of the next move, Y
+*/
+static void comp_corner(int32_t x, int32_t y) {
+  int64_t cross, dot;
+  uint32_t r2, d;
+
+  // both offsets are radius long, so these are r^2 sin and r^2 cos of
+  // the angle the path turns by, counterclockwise
+  cross = (int64_t)comp.offset_x * y - (int64_t)comp.offset_y * x;
+  dot = (int64_t)comp.offset_x * x + (int64_t)comp.offset_y * y;
+
+  if (cross == 0 && dot >= 0) {
+    // straight on, or no radius at all
+    comp_flush();
+  }
+  else if (cross != 0 && (cross > 0) == (comp_side > 0)) {
+    // Inside. The offset paths cross on the bisector, at
+    // (o1 + o2) * r^2 / (r^2 + o1 * o2) from the corner. A path doubling
+    // back has them cross far away, don't go further than about ten radii.
+    r2 = comp.radius * comp.radius;
+    d = r2 + dot;
+    if (d < r2 / 64)
+      d = r2 / 64;
+    comp_goto(comp_target.X + muldiv(comp.offset_x + x, r2, d),
+              comp_target.Y + muldiv(comp.offset_y + y, r2, d));
+    comp.state = COMP_QUEUED;
+  }
+  else {
+    // outside, around the corner
+    comp_flush();
+#ifdef ARC_TOLERANCE
+    {
+      GCODE_COMMAND cmd;
+
+      // arc_start() reads the offsets of whatever plane is selected
+      memset(&cmd, 0, sizeof(GCODE_COMMAND));
+      memcpy(&cmd.target, &comp.held, sizeof(TARGET));
+      cmd.target.X = comp_target.X + x;
+      cmd.target.Y = comp_target.Y + y;
+      cmd.I = -comp.offset_x;
+      cmd.J = -comp.offset_y;
+      arc_start(&cmd, comp_side < 0);
+    }
+#else
+    // without arcs, cut the corner off
+    comp_goto(comp_target.X + x, comp_target.Y + y);
+#endif
+  }
+}
+
+/** start compensation, or change side or radius
+  \param side COMP_LEFT or COMP_RIGHT
+  \param radius of the tool, 0 to TOOL_RADIUS_MAX
+
+  The next move goes straight onto the new offset path.
+*/
+void comp_start(int8_t side, int32_t radius) {
+  comp_flush();
+  if ( ! comp_engaged) {
+    memcpy(&comp_target, &startpoint, sizeof(TARGET));
+    comp_engaged = 1;
+  }
+  comp_side = side;
+  comp.radius = radius;
+  comp.state = COMP_NONE;
+}
+
+/// end compensation, the next move goes back to the programmed path
+void comp_stop() {
+  comp_flush();
+  comp_side = COMP_OFF;
+}
+
+/** a G0 or G1 while compensating
+  \param t where it goes, as programmed
+
+  Resolves the corner at the end of the move held back and holds back this
+  one instead.
+*/
+void comp_move(TARGET *t) {
+  int32_t dx, dy, x, y;
+  uint32_t hi, lo, length;
+
+  if (comp_side == COMP_OFF) {
+    // the move after G40
+    enqueue(t);
+    comp_engaged = 0;
+    return;
+  }
+
+  dx = t->X - comp_target.X;
+  dy = t->Y - comp_target.Y;
+  if (dx == 0 && dy == 0) {
+    // nothing to offset, but Z can't wait for the next move
+    if (t->Z != comp_target.Z) {
+      comp_flush();
+      x = startpoint.X;
+      y = startpoint.Y;
+      memcpy(&comp.held, t, sizeof(TARGET));
+      comp_goto(x, y);
+    }
+    memcpy(&comp_target, t, sizeof(TARGET));
+    return;
+  }
+
+  // radius long, at a right angle to the move, towards the tool
+  hi = square_sum(dx, dy, &lo);
+  length = sqrt_wide(hi, lo);
+  x = muldiv((comp_side > 0) ? -dy : dy, comp.radius, length);
+  y = muldiv((comp_side > 0) ? dx : -dx, comp.radius, length);
+
+  if (comp.state != COMP_NONE)
+    comp_corner(x, y);
+
+  memcpy(&comp.held, t, sizeof(TARGET));
+  memcpy(&comp_target, t, sizeof(TARGET));
+  comp.offset_x = x;
+  comp.offset_y = y;
+  comp.state = COMP_HELD;
+}
+
+/// queue the move held back, up to its offset end
+void comp_flush() {
+  if (comp.state == COMP_HELD) {
+    comp_goto(comp_target.X + comp.offset_x, comp_target.Y + comp.offset_y);
+    comp.state = COMP_QUEUED;
+  }
+}
+
+#endif /* CUTTER_COMP */
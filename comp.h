@@ -0,0 +1,41 @@
+#ifndef _COMP_H
+#define _COMP_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "dda.h"
+
+#ifdef CUTTER_COMP
+
+/// tool left of the path (G41), right of it (G42) or no compensation (G40)
+enum {
+  COMP_RIGHT = -1,
+  COMP_OFF = 0,
+  COMP_LEFT = 1
+};
+
+/// one of the above
+extern int8_t comp_side;
+
+/// set from G41/G42 until the first move after G40, see comp_move()
+extern uint8_t comp_engaged;
+
+/// end of the last programmed move, where the tool isn't while compensating
+extern TARGET comp_target;
+
+// start compensation, or change side or radius
+void comp_start(int8_t side, int32_t radius);
+
+// end compensation
+void comp_stop(void);
+
+// a G0 or G1 to t, while compensation is engaged
+void comp_move(TARGET *t);
+
+// queue the move held back, before anything else happens
+void comp_flush(void);
+
+#endif /* CUTTER_COMP */
+
+#endif  /* _COMP_H */
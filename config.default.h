@@ -76,6 +76,8 @@
     All numbers are integers, no decimals allowed.
 
     Units are mm/min
+
+    A single step takes 4.2 seconds at most (0xFFFF << 10 CPU clocks at 16 MHz), longer ones are cut short to that. So a move so slow that its steps come further apart than that runs faster than asked for.
 */
 
 /// used for G0 rapid moves and as a cap for all other feedrates
@@ -232,6 +234,16 @@
 //#define  STEPPER_ENABLE_PIN    xxxx
 //#define  STEPPER_INVERT_ENABLE
 
+/** \def STEP_OC1A_AXIS
+  Let timer 1 raise the step pin of this axis ('X', 'Y' or 'Z') in hardware, right on time, whenever it steps on every step interrupt. The step pin of that axis must be OC1A: DIO9 on the ATmega168/328, DIO13 on the ATmega644/1284 and the AT90USB1287, DIO11 on the ATmega1280/2560. On the ATmega168/328, move PS_ON_PIN off DIO9 then. Doesn't work with ACCELERATION_TEMPORAL.
+*/
+// #define STEP_OC1A_AXIS 'X'
+
+/** \def STEP_PULSE_WIDTH
+  Minimum step pulse length in microseconds. When defined, timer 2 ends step pulses after this time, else they last as long as the step interrupt happens to run. Some drivers need 2.5 microseconds or more. Up to 126 microseconds at 16 MHz.
+*/
+// #define STEP_PULSE_WIDTH 3
+
 
 
 /***************************************************************************\
@@ -379,6 +391,30 @@ DEFINE_HEATER(bed,      PB4)
 */
 // #define  XONXOFF
 
+/** \def STREAMING
+  Acknowledge each line with "ok" as soon as it's parsed, instead of after it's processed.
+    Lets a host keep the line busy by counting characters: it may send as long as the lines not acknowledged yet add up to no more than RX_BUFFER_SIZE (reported by M115, 63 characters) including their newlines. Each newline and carriage return ends a line, so send one of them only. Replies like that of M114 arrive later, on lines of their own. XONXOFF isn't needed then. See sender-stream.sh.
+*/
+// #define STREAMING
+
+/** \def REQUIRE_LINENUMBER
+  Drop lines without a line number (N word) and ask for a resend.
+    Lines which have one are always checked to follow the previous one. Blank lines and lines with nothing but a comment need none. Handy together with REQUIRE_CHECKSUM on a noisy connection.
+*/
+// #define REQUIRE_LINENUMBER
+
+/** \def REQUIRE_CHECKSUM
+  Drop lines without a checksum and ask for a resend. Blank lines and lines with nothing but a comment need none.
+    The checksum is the XOR of all characters of the line before the '*', e.g. "N1 G1 X5*100". Lines which have one are always checked.
+*/
+// #define REQUIRE_CHECKSUM
+
+/** \def GCODE_BINARY
+  Accept commands as compact binary frames, after the host switched to them with M252.
+    Coordinates are sent as integer micrometers, which saves about a third of the bytes of a typical G1 line and all of the decimal parsing. See gcode_binary.c for the frame layout.
+*/
+// #define GCODE_BINARY
+
 
 
 /***************************************************************************\
@@ -419,6 +455,12 @@ PWM value for 'off'
 */
 #define  MOVEBUFFER_SIZE  8
 
+/**
+  command buffer size, in number of parsed commands
+    lines are parsed into this buffer while the movebuffer is full, so the next move can be created as soon as a slot frees up. Each command takes about 70 bytes of ram. MUST be a power of 2, 4 is a good value.
+*/
+#define  CMDBUFFER_SIZE  4
+
 /** \def DC_EXTRUDER
   DC extruder
     If you have a DC motor extruder, configure it as a "heater" above and define this value as the index or name. You probably also want to comment out E_STEP_PIN and E_DIR_PIN in the Pinouts section above.
@@ -444,6 +486,83 @@ PWM value for 'off'
 */
 #define    STEP_INTERRUPT_INTERRUPTIBLE  1
 
+/** \def APPROX_DISTANCE
+  use linear approximations for the length of a move instead of an exact square root.
+    Move length goes straight into move duration, so its error shows up as feedrate error depending on move direction: up to 3.8% for XY moves, up to 17% for XYZ moves. The exact calculation is below 0.007% for moves longer than 32 mm, but takes several hundred cycles more per move. Only worth it if you run out of time in dda_create().
+*/
+// #define APPROX_DISTANCE
+
+/** \def PROFILE_STEP_ISR
+  measure the step interrupt.
+    Keeps histograms of how late the step interrupt fires and how long it runs, and of how long dda_create() takes, readable with M251. Costs 238 bytes of RAM and a little extra time in every step interrupt.
+*/
+// #define PROFILE_STEP_ISR
+
+/** \def PROFILE_MATHS
+  time the maths functions.
+    M254 reports how many CPU clocks each function of dda_maths.c takes, for comparing implementations and builds. Costs some flash, nothing else.
+*/
+// #define PROFILE_MATHS
+
+/** \def ARC_TOLERANCE
+  how far the straight moves G2 and G3 arcs are cut into may deviate from the true arc, in micrometers.
+    Smaller values give smoother arcs made of more, shorter moves; 10 is plenty for milling. Comment out to drop arc support (G2, G3, G17-G19) and save the flash it takes.
+*/
+#define ARC_TOLERANCE 10
+
+/** \def ARC_NATIVE
+  step G17 arcs without helical motion along the circle right in the step interrupt, instead of cutting them into chords.
+    An arc takes a single movebuffer entry and has no corners at all. Needs ARC_TOLERANCE for the other arcs, the same STEPS_PER_M_X and STEPS_PER_M_Y and doesn't work with ACCELERATION_TEMPORAL.
+    Direction outputs of an arc change right after a step, not just before the next one. Drivers wanting a long direction hold time after the step might not like that.
+*/
+//#define ARC_NATIVE
+
+/** \def SPLINE_TOLERANCE
+  how far the straight moves G5 and G5.1 splines are cut into may deviate from the true curve, in micrometers.
+    Moves get shorter where the curve bends more and longer where it's straighter. Comment out to drop spline support and save the flash it takes.
+*/
+#define SPLINE_TOLERANCE 10
+
+/** \def TOOL_TABLE
+  number of tools in the tool table, see G10 L1. Tools are numbered from 1, each takes 8 bytes of RAM and 10 bytes of EEPROM for its length and radius. Comment out to drop the tool table, along with G43 and G44.
+*/
+#define TOOL_TABLE 8
+
+/** \def TOOL_CHANGE_X
+  \def TOOL_CHANGE_Y
+  \def TOOL_CHANGE_Z
+  where M6 goes to have the tool changed, in mm of machine coordinates. Z goes up first, then X and Y. Without TOOL_CHANGE_Z, M6 just takes note of the new tool. X and Y are optional.
+*/
+//#define TOOL_CHANGE_X 0.0
+//#define TOOL_CHANGE_Y 0.0
+//#define TOOL_CHANGE_Z 50.0
+
+/** \def WORK_OFFSETS
+  work coordinate systems G54 to G59, set with G10 L2 or L20 and kept in EEPROM, along with the local offset of G52. They take 84 bytes of EEPROM and 24 bytes of RAM. Comment out to save the flash they take, G53 works either way.
+*/
+#define WORK_OFFSETS
+
+/** \def TRANSFORM
+  rotation with G68, scaling with G51 and mirroring with M21 and M22 of X and Y. They make up a single transform worked out when one of them changes, moves cost nothing extra while all are off. Comment out to save the flash it takes.
+*/
+#define TRANSFORM
+
+/** \def CANNED_CYCLES
+  drilling cycles G73 and G81 to G83, with G80, G98 and G99. Each hole is a single line, its moves are queued as the movebuffer has room. Comment out to save the flash they take.
+*/
+#define CANNED_CYCLES
+
+/** \def INVERSE_TIME
+  inverse time feed, G93, where F gives the time each move takes. Comment out to save the flash it takes.
+*/
+#define INVERSE_TIME
+
+/** \def CUTTER_COMP
+  cutter radius compensation, G40 to G42. Straight moves in the XY plane are offset by the tool radius from TOOL_TABLE, corners on the outside get arcs if ARC_TOLERANCE is defined.
+    Each move waits for the next one before it's queued, to see how the corner between them goes. Comment out to save the flash and RAM it takes.
+*/
+#define CUTTER_COMP
+
 /**
   temperature history count. This is how many temperature readings to keep in order to calculate derivative in PID loop
   higher values make PID derivative term more stable at the expense of reaction time
@@ -474,8 +593,9 @@ PWM value for 'off'
 *                                                                           *
 *                                                                           *
 * list of PWM-able pins and corresponding timers                            *
-* timer1 is used for step timing so don't use OC1A/OC1B                     *
-* they are omitted from this listing for that reason                        *
+* timer1 is used for step timing so don't use OC1A/OC1B for PWM, they      *
+* are omitted from this listing for that reason. OC1A can still be a step   *
+* pin, see STEP_OC1A_AXIS                                                   *
 *                                                                           *
 * For the atmega168/328, timer/pin mappings are as follows                  *
 *                                                                           *
@@ -0,0 +1,184 @@
+#include "coord.h"
+
+/** \file
+  \brief Coordinate systems - G52, G54 to G59 and the offsets in effect
+
+  Programmed coordinates are off those of the machine by the offset of the
+  work coordinate system in use, G54 to G59, plus the local offset from G52,
+  plus the tool length offset from G43 or G44 on Z. All these are summed up
+  into \ref coord_offset whenever one of them changes, so an absolute move
+  costs three additions, no matter how many offsets are in effect.
+
+  Work offsets are kept in EEPROM, each along with its CRC, and survive a
+  reset. Only the one in use is kept in RAM. After a reset, G54 is in use
+  and the local offset is cleared.
+
+  As moves leave out axes which stay where they are, changing offsets also
+  changes the position held in \ref next_target. Commands doing so are
+  processed before the next line is parsed, see gcode_command_done().
+*/
+
+#include <string.h>
+#include <avr/eeprom.h>
+
+#include "crc.h"
+#include "tool.h"
+#include "comp.h"
+
+OFFSET coord_offset;
+
+#ifdef WORK_OFFSETS
+
+/// number of work coordinate systems, G54 to G59
+#define COORD_SYSTEMS 6
+
+/// a work offset as kept in EEPROM
+typedef struct {
+  OFFSET offset;
+  uint16_t crc; ///< of offset
+} EE_offset;
+
+EE_offset EEMEM EE_work_offsets[COORD_SYSTEMS];
+
+uint8_t coord_system;
+
+/// work offset of the coordinate system in use
+static OFFSET work;
+
+/// local offset, G52
+static OFFSET local;
+
+/// read a work offset from EEPROM, zeros if its CRC is bad
+static void coord_read(uint8_t system, OFFSET *o) {
+  uint16_t crc;
+
+  eeprom_read_block(o, &EE_work_offsets[system].offset, sizeof(OFFSET));
+  eeprom_read_block(&crc, &EE_work_offsets[system].crc, sizeof(uint16_t));
+  if (crc_block(o, sizeof(OFFSET)) != crc)
+    memset(o, 0, sizeof(OFFSET));
+}
+
+#endif /* WORK_OFFSETS */
+
+/// start with G54 and no offsets other than those from EEPROM
+void coord_init() {
+#ifdef WORK_OFFSETS
+  coord_system = 0;
+  coord_read(0, &work);
+  memset(&local, 0, sizeof(OFFSET));
+#endif
+  coord_update();
+}
+
+/** sum up the offsets in effect
+
+  Call this whenever one of them changed. Also sets the position in
+  \ref next_target to where the machine is in the new coordinates, so axes
+  left out of the next move stay put.
+*/
+void coord_update() {
+  TARGET *position = &startpoint;
+
+  memset(&coord_offset, 0, sizeof(OFFSET));
+#ifdef WORK_OFFSETS
+  coord_offset.X = work.X + local.X;
+  coord_offset.Y = work.Y + local.Y;
+  coord_offset.Z = work.Z + local.Z;
+#endif
+#ifdef TOOL_TABLE
+  coord_offset.Z += tool_length_offset;
+#endif
+
+#ifdef CUTTER_COMP
+  // the tool is off the programmed path
+  if (comp_engaged)
+    position = &comp_target;
+#endif
+  if (next_target.option_all_relative) {
+    next_target.target.X = next_target.target.Y = next_target.target.Z = 0;
+  }
+  else {
+    next_target.target.X = position->X - coord_offset.X;
+    next_target.target.Y = position->Y - coord_offset.Y;
+    next_target.target.Z = position->Z - coord_offset.Z;
+  }
+}
+
+#ifdef WORK_OFFSETS
+
+/** switch to another coordinate system
+  \param system 0 for G54 to 5 for G59
+*/
+void coord_select(uint8_t system) {
+  if (system >= COORD_SYSTEMS)
+    return;
+
+  coord_system = system;
+  coord_read(system, &work);
+  coord_update();
+}
+
+/** set a work offset and save it to EEPROM
+  \param system 1 for G54 to 6 for G59, 0 for the one in use
+  \param cmd X, Y and Z of the offset, axes left out are kept
+  \param here set to have X, Y and Z be where the machine is now, G10 L20,
+  instead of the offset itself, G10 L2
+  \return zero if there's no such coordinate system
+*/
+uint8_t coord_set_work(uint8_t system, GCODE_COMMAND *cmd, uint8_t here) {
+  OFFSET o, others;
+  uint16_t crc;
+
+  if (system > COORD_SYSTEMS)
+    return 0;
+  system = system ? system - 1 : coord_system;
+
+  coord_read(system, &o);
+  if (here) {
+    // the machine is at o + others + X, others are those besides work
+    others.X = coord_offset.X - work.X;
+    others.Y = coord_offset.Y - work.Y;
+    others.Z = coord_offset.Z - work.Z;
+    if (cmd->seen_X)
+      o.X = startpoint.X - others.X - cmd->target.X;
+    if (cmd->seen_Y)
+      o.Y = startpoint.Y - others.Y - cmd->target.Y;
+    if (cmd->seen_Z)
+      o.Z = startpoint.Z - others.Z - cmd->target.Z;
+  }
+  else {
+    if (cmd->seen_X)
+      o.X = cmd->target.X;
+    if (cmd->seen_Y)
+      o.Y = cmd->target.Y;
+    if (cmd->seen_Z)
+      o.Z = cmd->target.Z;
+  }
+
+  // only bytes which changed are written, to spare the EEPROM
+  crc = crc_block(&o, sizeof(OFFSET));
+  eeprom_update_block(&o, &EE_work_offsets[system].offset, sizeof(OFFSET));
+  eeprom_update_block(&crc, &EE_work_offsets[system].crc, sizeof(uint16_t));
+
+  if (system == coord_system) {
+    memcpy(&work, &o, sizeof(OFFSET));
+    coord_update();
+  }
+
+  return 1;
+}
+
+/** set the local offset
+  \param cmd X, Y and Z of the offset, axes left out are kept
+*/
+void coord_set_local(GCODE_COMMAND *cmd) {
+  if (cmd->seen_X)
+    local.X = cmd->target.X;
+  if (cmd->seen_Y)
+    local.Y = cmd->target.Y;
+  if (cmd->seen_Z)
+    local.Z = cmd->target.Z;
+  coord_update();
+}
+
+#endif /* WORK_OFFSETS */
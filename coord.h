@@ -0,0 +1,41 @@
+#ifndef _COORD_H
+#define _COORD_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "gcode_parse.h"
+
+/// how far programmed coordinates are off those of the machine
+typedef struct {
+  int32_t X;
+  int32_t Y;
+  int32_t Z;
+} OFFSET;
+
+/// added to all absolute targets, the sum of all offsets in effect
+extern OFFSET coord_offset;
+
+// start with G54 and no offsets other than those from EEPROM
+void coord_init(void);
+
+// sum up the offsets in effect, after any of them changed
+void coord_update(void);
+
+#ifdef WORK_OFFSETS
+
+/// coordinate system in use, 0 for G54 to 5 for G59
+extern uint8_t coord_system;
+
+// switch to another coordinate system, G54 to G59
+void coord_select(uint8_t system);
+
+// set a work offset, G10 L2 and L20
+uint8_t coord_set_work(uint8_t system, GCODE_COMMAND *cmd, uint8_t here);
+
+// set the local offset, G52
+void coord_set_local(GCODE_COMMAND *cmd);
+
+#endif /* WORK_OFFSETS */
+
+#endif  /* _COORD_H */
@@ -0,0 +1,240 @@
+#include "cycle.h"
+
+/** \file
+  \brief Canned cycles - G73 and G81 to G83 drilling
+
+  A single line drills a hole: rapid to X and Y, rapid down to the R plane,
+  feed down to Z, then rapid back up. G82 waits at the bottom for P, G83
+  pecks, going back up to the R plane after each Q of depth, and G73 just
+  backs off a bit after each Q to break the chip. L drills that many holes,
+  each X and Y further in G91.
+
+  Lines after it with just X and Y drill more holes the same way, as the
+  parser keeps the cycle until G80 or another motion, see
+  GCODE_COMMAND::cycle. R, Z, Q and P are kept too and can be left out.
+
+  Like the chords of an arc, the moves of a hole are queued one at a time by
+  cycle_segment(), called from the main loop as the movebuffer has room, so
+  any number of pecks take no more than a single line on the wire.
+
+  Cycles are in the XY plane, drilling down along Z. In G91, R is from
+  where the cycle started and Z is from R.
+*/
+
+#include <string.h>
+
+#include "dda.h"
+#include "dda_queue.h"
+#include "coord.h"
+#include "sersendf.h"
+
+#ifdef CANNED_CYCLES
+
+/// how far G73 backs off to break the chip, and how far above the last peck
+/// G83 stops going back down rapidly, in micrometers
+#define CYCLE_CLEARANCE 500
+
+/// feedrate of rapids, like G0
+#define CYCLE_RAPID (MAXIMUM_FEEDRATE_X * 2L)
+
+/// what's next in a cycle
+enum {
+  CYCLE_CLEAR, ///< up to the R plane, if below it
+  CYCLE_XY, ///< rapid to the hole
+  CYCLE_R, ///< rapid down to the R plane
+  CYCLE_FEED, ///< feed down to Z, or one peck deeper
+  CYCLE_PECK_UP, ///< G73 backs off, G83 goes up to the R plane
+  CYCLE_PECK_DOWN, ///< G83 goes back down to the last peck
+  CYCLE_DWELL, ///< G82 waits at the bottom
+  CYCLE_RETRACT ///< up to the R plane or where the cycle started
+};
+
+uint8_t cycle_active = 0;
+
+/// set from the first hole of a cycle on, until G80 or another motion
+static uint8_t cycle_running = 0;
+
+/// everything about the hole being drilled
+static struct {
+  uint8_t g; ///< 73, 81, 82 or 83
+  uint8_t step; ///< one of the above
+  uint16_t holes; ///< still to drill after this one
+  int32_t dx; ///< from hole to hole, X
+  int32_t dy; ///< from hole to hole, Y
+  int32_t initial; ///< Z where the cycle started
+  int32_t r; ///< Z of the R plane
+  int32_t z; ///< Z of the bottom
+  int32_t q; ///< depth of each peck
+  int32_t p; ///< dwell for G82, in milliseconds
+  int32_t depth; ///< Z drilled to so far
+  uint8_t retract_r; ///< retract to the R plane (G99) rather than to where the cycle started (G98)
+  TARGET target; ///< X and Y of the hole, feedrate for drilling
+} cycle;
+
+/// queue a move to Z at the hole, or to X and Y of the hole at the current Z
+static void cycle_goto(uint8_t xy, int32_t z, uint8_t rapid) {
+  TARGET t;
+
+  memcpy(&t, &cycle.target, sizeof(TARGET));
+  if ( ! xy) {
+    t.X = startpoint.X;
+    t.Y = startpoint.Y;
+  }
+  t.Z = z;
+  if (rapid)
+    t.F = CYCLE_RAPID;
+  // already there, e.g. at the R plane when starting from it
+  if (t.X != startpoint.X || t.Y != startpoint.Y || t.Z != startpoint.Z)
+    enqueue(&t);
+}
+
+/** drill a hole, or L holes
+  \param cmd the G73 or G81 to G83, with X and Y made absolute already
+
+  Z of the line is where the cycle ends, see gcode_command_done(), the
+  bottom of the hole comes in GCODE_COMMAND::cycle_z.
+
+  R and Z are needed on the first line of a cycle, later lines can leave
+  them out to keep them, like Q and P. A line with neither X, Y, Z nor R
+  does nothing, so words like F alone don't drill another hole.
+
+  Queues the first move right away, the rest is left to cycle_segment().
+*/
+void cycle_start(GCODE_COMMAND *cmd) {
+  if ( ! (cmd->seen_X || cmd->seen_Y || cmd->seen_Z || cmd->seen_R))
+    return;
+
+  if ( ! cycle_running) {
+    if ( ! cmd->seen_R || ! cmd->seen_Z) {
+      sersendf_P(PSTR("E: Bad cycle"));
+      return;
+    }
+    cycle.initial = startpoint.Z;
+  }
+
+  if (cmd->seen_R)
+    cycle.r = cmd->R + (cmd->option_all_relative ? cycle.initial :
+                                                   coord_offset.Z);
+  if (cmd->seen_Z) {
+    cycle.z = cmd->cycle_z + (cmd->option_all_relative ? cycle.r :
+                                                         coord_offset.Z);
+  #ifdef Z_MIN
+    if (cycle.z < (int32_t)(Z_MIN * 1000.))
+      cycle.z = (int32_t)(Z_MIN * 1000.);
+  #endif
+  }
+  if (cmd->seen_Q)
+    cycle.q = (cmd->Q < 0) ? -cmd->Q : cmd->Q;
+  if (cmd->seen_P)
+    cycle.p = cmd->P;
+  if (cycle.z > cycle.r ||
+      ((cmd->G == 73 || cmd->G == 83) && cycle.q == 0)) {
+    sersendf_P(PSTR("E: Bad cycle"));
+    return;
+  }
+  cycle_running = 1;
+
+  memcpy(&cycle.target, &cmd->target, sizeof(TARGET));
+  cycle.g = cmd->G;
+  cycle.retract_r = cmd->option_retract_r;
+  cycle.holes = (cmd->seen_L && cmd->L > 1) ? cmd->L - 1 : 0;
+  if (cmd->option_all_relative) {
+    cycle.dx = cmd->target.X - startpoint.X;
+    cycle.dy = cmd->target.Y - startpoint.Y;
+  }
+  else
+    cycle.dx = cycle.dy = 0;
+  cycle.step = CYCLE_CLEAR;
+
+  cycle_active = 1;
+  cycle_segment();
+}
+
+/// forget where the cycle started, the next one starts afresh
+void cycle_stop() {
+  cycle_running = 0;
+}
+
+/** queue the next move of the current cycle
+
+  Call this whenever \ref cycle_active is set and the movebuffer isn't full,
+  before processing any other commands.
+*/
+void cycle_segment() {
+  int32_t z;
+
+  while (cycle_active) {
+    switch (cycle.step++) {
+      case CYCLE_CLEAR:
+        if (startpoint.Z < cycle.r) {
+          cycle_goto(0, cycle.r, 1);
+          return;
+        }
+        break;
+
+      case CYCLE_XY:
+        cycle_goto(1, startpoint.Z, 1);
+        return;
+
+      case CYCLE_R:
+        cycle.depth = cycle.r;
+        cycle_goto(1, cycle.r, 1);
+        return;
+
+      case CYCLE_FEED:
+        z = cycle.z;
+        if ((cycle.g == 73 || cycle.g == 83) && cycle.depth - cycle.q > z)
+          z = cycle.depth - cycle.q;
+        cycle.depth = z;
+        if (z != cycle.z)
+          cycle.step = CYCLE_PECK_UP;
+        else
+          cycle.step = (cycle.g == 82) ? CYCLE_DWELL : CYCLE_RETRACT;
+        cycle_goto(1, z, 0);
+        return;
+
+      case CYCLE_PECK_UP:
+        z = cycle.r;
+        if (cycle.g == 73) {
+          if (cycle.depth + CYCLE_CLEARANCE < z)
+            z = cycle.depth + CYCLE_CLEARANCE;
+          cycle.step = CYCLE_FEED;
+        }
+        cycle_goto(1, z, 1);
+        return;
+
+      case CYCLE_PECK_DOWN:
+        z = cycle.r;
+        if (cycle.depth + CYCLE_CLEARANCE < z)
+          z = cycle.depth + CYCLE_CLEARANCE;
+        cycle.step = CYCLE_FEED;
+        cycle_goto(1, z, 1);
+        return;
+
+      case CYCLE_DWELL:
+        // like G4
+        if (cycle.p > 0) {
+          enqueue_dwell(cycle.p);
+          return;
+        }
+        break;
+
+      case CYCLE_RETRACT:
+        z = cycle.r;
+        if ( ! cycle.retract_r && cycle.initial > z)
+          z = cycle.initial;
+        cycle_goto(1, z, 1);
+        if (cycle.holes) {
+          cycle.holes--;
+          cycle.target.X += cycle.dx;
+          cycle.target.Y += cycle.dy;
+          cycle.step = CYCLE_XY;
+        }
+        else
+          cycle_active = 0;
+        return;
+    }
+  }
+}
+
+#endif /* CANNED_CYCLES */
@@ -0,0 +1,25 @@
+#ifndef _CYCLE_H
+#define _CYCLE_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "gcode_parse.h"
+
+#ifdef CANNED_CYCLES
+
+/// set while moves of a canned cycle are still to be queued, see cycle_segment()
+extern uint8_t cycle_active;
+
+// drill a hole, or L holes, with G73 or G81 to G83
+void cycle_start(GCODE_COMMAND *cmd);
+
+// forget where the cycle started, G80 or any other motion
+void cycle_stop(void);
+
+// queue the next move of the current cycle
+void cycle_segment(void);
+
+#endif /* CANNED_CYCLES */
+
+#endif  /* _CYCLE_H */
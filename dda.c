@@ -6,7 +6,6 @@
 
 #include  <string.h>
 #include  <stdlib.h>
-#include  <math.h>
 #include  <avr/interrupt.h>
 
 #include  "dda_maths.h"
@@ -19,6 +18,53 @@
 #include  "sersendf.h"
 #include  "pinio.h"
 #include  "config.h"
+#include  "profile.h"
+
+#ifdef STEP_OC1A_AXIS
+  #ifdef ACCELERATION_TEMPORAL
+    #error STEP_OC1A_AXIS does not work with ACCELERATION_TEMPORAL
+  #endif
+  // delta and steps left of the axis stepped by timer hardware
+  #if STEP_OC1A_AXIS == 'X'
+    #define OC1A_DELTA x_delta
+    #define OC1A_STEPS x_steps
+  #elif STEP_OC1A_AXIS == 'Y'
+    #define OC1A_DELTA y_delta
+    #define OC1A_STEPS y_steps
+  #elif STEP_OC1A_AXIS == 'Z'
+    #define OC1A_DELTA z_delta
+    #define OC1A_STEPS z_steps
+  #else
+    #error STEP_OC1A_AXIS must be 'X', 'Y' or 'Z'
+  #endif
+#endif
+
+#ifdef ARC_NATIVE
+  #ifdef ACCELERATION_TEMPORAL
+    #error ARC_NATIVE does not work with ACCELERATION_TEMPORAL
+  #endif
+  #if STEPS_PER_M_X != STEPS_PER_M_Y
+    #error ARC_NATIVE needs STEPS_PER_M_X and STEPS_PER_M_Y to be the same
+  #endif
+  // steps of the next step interrupt of an arc, see dda_arc_next()
+  #define ARC_STEP_X 0x01
+  #define ARC_STEP_Y 0x02
+  #define ARC_DIR_X  0x04 ///< X steps in positive direction
+  #define ARC_DIR_Y  0x08 ///< Y steps in positive direction
+  /// fastest feedrate along an arc, as it has both axes at full speed at times
+  #define ARC_FEEDRATE_MAX ((MAXIMUM_FEEDRATE_X < MAXIMUM_FEEDRATE_Y) ? \
+                            MAXIMUM_FEEDRATE_X : MAXIMUM_FEEDRATE_Y)
+#endif
+
+/// longest wait of a dwell in one timer round, in milliseconds, well within
+/// the longest delay setTimer() can do
+#define DWELL_CHUNK 1000
+
+#ifdef ACCELERATION_RAMPING
+/// ramp length is \f$v^2 / 2a\f$, which is F * F * RAMPUP_FACTOR with F in
+/// mm/min and the result in steps. 8.24 fixed point, for mul_shift().
+#define RAMPUP_FACTOR ((uq8_24)(STEPS_PER_M_X / (7200000. * ACCELERATION) * 16777216. + .5))
+#endif
 
 /*
   position tracking
@@ -49,7 +95,10 @@ void dda_init(void) {
 
 #ifdef ACCELERATION_RAMPING
   move_state.n = 1;
-  move_state.c = ((uint32_t)((double)F_CPU / sqrt((double)(STEPS_PER_M_X * ACCELERATION / 1000.)))) << 8;
+  move_state.n_recip = 0xFFFFFFFF;
+  // F_CPU / sqrt(STEPS_PER_M_X * ACCELERATION / 1000), as 24.8
+  move_state.c = div_wide((uint32_t)F_CPU >> 16, (uint32_t)F_CPU << 16,
+                          fixed_sqrt((uint32_t)(STEPS_PER_M_X * ACCELERATION / 1000.)));
 #endif
 }
 
@@ -63,6 +112,131 @@ void dda_new_startpoint(void) {
   startpoint_steps.Z = um_to_steps_z(startpoint.Z);
 }
 
+/*! Work out step timing and acceleration of a DDA
+  \param *dda the DDA, with total_steps set already
+  \param f feedrate in mm/min
+  \param move_duration step time at a feedrate of 1 mm/min, see dda_create()
+  \param c_limit shortest step time the axes can do, 24.8 fixed point
+
+  Shared by straight moves and arcs.
+*/
+static void dda_set_speed(DDA *dda, uint32_t f, uint32_t move_duration,
+                          uint32_t c_limit) {
+  uint32_t f_recip = reciprocal(f);
+
+#ifdef ACCELERATION_REPRAP
+  // c is initial step time in IOclk ticks
+  dda->c = div_by_reciprocal(move_duration, startpoint.F, reciprocal(startpoint.F)) << 8;
+  if (dda->c < c_limit)
+    dda->c = c_limit;
+  dda->end_c = div_by_reciprocal(move_duration, f, f_recip) << 8;
+  if (dda->end_c < c_limit)
+    dda->end_c = c_limit;
+
+  if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
+    sersendf_P(PSTR(",md:%lu,c:%lu"), move_duration, dda->c >> 8);
+
+  if (dda->c != dda->end_c) {
+    uint32_t stF = startpoint.F / 4;
+    uint32_t enF = f / 4;
+    // now some constant acceleration stuff, courtesy of http://www.embedded.com/columns/technicalinsights/56800129?printable=true
+    uint32_t ssq = (stF * stF);
+    uint32_t esq = (enF * enF);
+    int32_t dsq = (int32_t) (esq - ssq) / 4;
+
+    uint32_t prod_hi, prod_lo, q;
+
+    // total_steps * ssq easily exceeds 32 bits, so keep all 64 of them
+    prod_hi = mul_wide(dda->total_steps, ssq, &prod_lo);
+    q = div_wide(prod_hi, prod_lo, (dsq < 0) ? -dsq : dsq);
+    // dsq can be zero if F differs only a little, this gives constant speed
+    if (q > 0x3FFFFFFF)
+      q = 0x3FFFFFFF;
+    dda->n = ((dsq < 0) ? -((int32_t)q) : (int32_t)q) + 1;
+
+    if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
+      sersendf_P(PSTR("\n{DDA:CA end_c:%lu, n:%ld, md:%lu, ssq:%lu, esq:%lu, dsq:%lu}\n"), dda->end_c >> 8, dda->n, move_duration, ssq, esq, dsq);
+
+    dda->n_recip = reciprocal((dda->n < 0) ? -dda->n : dda->n);
+    dda->accel = 1;
+  }
+  else
+    dda->accel = 0;
+#elif defined ACCELERATION_RAMPING
+  // yes, this assumes always the x axis as the critical one regarding acceleration. If we want to implement per-axis acceleration, things get tricky ...
+  dda->c_min = div_by_reciprocal(move_duration, f, f_recip) << 8;
+  if (dda->c_min < c_limit)
+    dda->c_min = c_limit;
+  // steps needed to accelerate to F: v^2 / 2a, F^2 has to fit into 32 bits
+  if (f > 65535)
+    f = 65535;
+  dda->rampup_steps = mul_shift(f * f, RAMPUP_FACTOR, 24);
+  if (dda->rampup_steps > dda->total_steps / 2)
+    dda->rampup_steps = dda->total_steps / 2;
+  dda->rampdown_steps = dda->total_steps - dda->rampup_steps;
+#elif defined ACCELERATION_TEMPORAL
+  // TODO: limit speed of individual axes to MAXIMUM_FEEDRATE
+  // TODO: calculate acceleration/deceleration for each axis
+  dda->x_step_interval = dda->y_step_interval = \
+    dda->z_step_interval = dda->e_step_interval = 0xFFFFFFFF;
+  if (dda->x_delta)
+    dda->x_step_interval = move_duration / dda->x_delta;
+  if (dda->y_delta)
+    dda->y_step_interval = move_duration / dda->y_delta;
+  if (dda->z_delta)
+    dda->z_step_interval = move_duration / dda->z_delta;
+  if (dda->e_delta)
+    dda->e_step_interval = move_duration / dda->e_delta;
+
+  dda->axis_to_step = 'x';
+  dda->c = dda->x_step_interval;
+  if (dda->y_step_interval < dda->c) {
+    dda->axis_to_step = 'y';
+    dda->c = dda->y_step_interval;
+  }
+  if (dda->z_step_interval < dda->c) {
+    dda->axis_to_step = 'z';
+    dda->c = dda->z_step_interval;
+  }
+  if (dda->e_step_interval < dda->c) {
+    dda->axis_to_step = 'e';
+    dda->c = dda->e_step_interval;
+  }
+
+  dda->c <<= 8;
+#else
+  dda->c = div_by_reciprocal(move_duration, f, f_recip) << 8;
+  if (dda->c < c_limit)
+    dda->c = c_limit;
+#endif
+}
+
+#ifdef INVERSE_TIME
+/*! Work out step timing for inverse time feed, G93
+  \param *dda the DDA, with total_steps set already
+  \param *f F of the move, receives the feedrate in mm/min it comes down to
+  \return step time at a feedrate of 1 mm/min, as for dda_set_speed()
+
+  The move takes 1 / F minutes however long it is, so each step takes that
+  divided by total_steps, no distance needed. The feedrate is that of the
+  leading axis, as if it were X, which is what acceleration goes by anyway.
+*/
+static uint32_t dda_inverse_time(DDA *dda, uint32_t *f) {
+  uint32_t hi, lo, c, fi = *f & ~F_INVERSE_TIME;
+
+  // thousandths of ticks per minute, divided by F in thousandths
+  hi = mul_wide(60000UL, F_CPU, &lo);
+  c = (hi >= fi) ? 0xFFFFFFFF : div_wide(hi, lo, fi);
+  c /= dda->total_steps;
+
+  *f = muldiv(dda->total_steps, fi, STEPS_PER_M_X);
+  if (*f == 0)
+    *f = 1;
+
+  return c * *f;
+}
+#endif
+
 /*! CREATE a dda given current_position and a target, save to passed location so we can write directly into the queue
   \param *dda pointer to a dda_queue entry to overwrite
   \param *target the target position of this move
@@ -77,7 +251,8 @@ void dda_new_startpoint(void) {
 */
 void dda_create(DDA *dda, TARGET *target) {
   uint32_t steps, x_delta_um, y_delta_um, z_delta_um;
-  uint32_t distance, c_limit, c_limit_calc;
+  uint32_t distance, c_limit, c_limit_calc, steps_recip, move_duration;
+  uint32_t f = target->F;
 
   // initialise DDA to a known state
   dda->allflags = 0;
@@ -121,20 +296,44 @@ void dda_create(DDA *dda, TARGET *target) {
 
   if (!dda->total_steps) dda->nullmove = 1;
   else {
+    // we divide by these a couple of times, multiplying by their reciprocals
+    // is cheaper
+    steps_recip = reciprocal(dda->total_steps);
+
+#ifdef INVERSE_TIME
+    if (f & F_INVERSE_TIME) {
+      move_duration = dda_inverse_time(dda, &f);
+  #ifdef ACCELERATION_TEMPORAL
+      // the whole move, not a single step
+      move_duration = div_by_reciprocal(move_duration, f, reciprocal(f)) *
+                      dda->total_steps;
+  #endif
+    }
+    else {
+#endif
     //check if we can use simpler approximations before trying the full 3d approximation.
+#ifdef APPROX_DISTANCE
     if (z_delta_um == 0)
       distance = approx_distance(x_delta_um, y_delta_um);
     else if (x_delta_um == 0 && y_delta_um == 0)
       distance = z_delta_um;
     else
       distance = approx_distance_3(x_delta_um, y_delta_um, z_delta_um);
+#else
+    if (z_delta_um == 0)
+      distance = exact_distance(x_delta_um, y_delta_um);
+    else if (x_delta_um == 0 && y_delta_um == 0)
+      distance = z_delta_um;
+    else
+      distance = exact_distance_3(x_delta_um, y_delta_um, z_delta_um);
+#endif
 
     if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
       sersendf_P(PSTR(",ds:%lu"), distance);
 
 #ifdef ACCELERATION_TEMPORAL
       // bracket part of this equation in an attempt to avoid overflow: 60 * 16MHz * 5mm is >32 bits
-      uint32_t move_duration, md_candidate;
+      uint32_t md_candidate;
 
       move_duration = distance * ((60 * F_CPU) / (target->F * 1000UL));
       md_candidate = dda->x_delta * ((60 * F_CPU) / (MAXIMUM_FEEDRATE_X * 1000UL));
@@ -165,134 +364,344 @@ void dda_create(DDA *dda, TARGET *target) {
 
       // changed distance * 6000 .. * F_CPU / 100000 to
       //         distance * 2400 .. * F_CPU / 40000 so we can move a distance of up to 1800mm without overflowing
-      uint32_t move_duration = ((distance * 2400) / dda->total_steps) * (F_CPU / 40000);
+      move_duration = div_by_reciprocal(distance * 2400, dda->total_steps, steps_recip) * (F_CPU / 40000);
+#endif
+#ifdef INVERSE_TIME
+    }
 #endif
 
     // similarly, find out how fast we can run our axes.
     // do this for each axis individually, as the combined speed of two or more axes can be higher than the capabilities of a single one.
     c_limit = 0;
     // check X axis
-    c_limit_calc = ((x_delta_um * 2400L) / dda->total_steps * (F_CPU / 40000) / MAXIMUM_FEEDRATE_X) << 8;
+    c_limit_calc = div_by_reciprocal(div_by_reciprocal(x_delta_um * 2400L, dda->total_steps, steps_recip) * (F_CPU / 40000), MAXIMUM_FEEDRATE_X, RECIPROCAL(MAXIMUM_FEEDRATE_X)) << 8;
     if (c_limit_calc > c_limit)
       c_limit = c_limit_calc;
     // check Y axis
-    c_limit_calc = ((y_delta_um * 2400L) / dda->total_steps * (F_CPU / 40000) / MAXIMUM_FEEDRATE_Y) << 8;
+    c_limit_calc = div_by_reciprocal(div_by_reciprocal(y_delta_um * 2400L, dda->total_steps, steps_recip) * (F_CPU / 40000), MAXIMUM_FEEDRATE_Y, RECIPROCAL(MAXIMUM_FEEDRATE_Y)) << 8;
     if (c_limit_calc > c_limit)
       c_limit = c_limit_calc;
     // check Z axis
-    c_limit_calc = ((z_delta_um * 2400L) / dda->total_steps * (F_CPU / 40000) / MAXIMUM_FEEDRATE_Z) << 8;
+    c_limit_calc = div_by_reciprocal(div_by_reciprocal(z_delta_um * 2400L, dda->total_steps, steps_recip) * (F_CPU / 40000), MAXIMUM_FEEDRATE_Z, RECIPROCAL(MAXIMUM_FEEDRATE_Z)) << 8;
     if (c_limit_calc > c_limit)
       c_limit = c_limit_calc;
 
-#ifdef ACCELERATION_REPRAP
-    // c is initial step time in IOclk ticks
-    dda->c = (move_duration / startpoint.F) << 8;
-    if (dda->c < c_limit)
-      dda->c = c_limit;
-    dda->end_c = (move_duration / target->F) << 8;
-    if (dda->end_c < c_limit)
-      dda->end_c = c_limit;
-
-    if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
-      sersendf_P(PSTR(",md:%lu,c:%lu"), move_duration, dda->c >> 8);
-
-    if (dda->c != dda->end_c) {
-      uint32_t stF = startpoint.F / 4;
-      uint32_t enF = target->F / 4;
-      // now some constant acceleration stuff, courtesy of http://www.embedded.com/columns/technicalinsights/56800129?printable=true
-      uint32_t ssq = (stF * stF);
-      uint32_t esq = (enF * enF);
-      int32_t dsq = (int32_t) (esq - ssq) / 4;
-
-      uint8_t msb_ssq = msbloc(ssq);
-      uint8_t msb_tot = msbloc(dda->total_steps);
-
-      // the raw equation WILL overflow at high step rates, but 64 bit math routines take waay too much space
-      // at 65536 mm/min (1092mm/s), ssq/esq overflows, and dsq is also close to overflowing if esq/ssq is small
-      // but if ssq-esq is small, ssq/dsq is only a few bits
-      // we'll have to do it a few different ways depending on the msb locations of each
-      if ((msb_tot + msb_ssq) <= 30) {
-        // we have room to do all the multiplies first
-        if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
-          serial_writechar('A');
-        dda->n = ((int32_t) (dda->total_steps * ssq) / dsq) + 1;
-      }
-      else if (msb_tot >= msb_ssq) {
-        // total steps has more precision
-        if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
-          serial_writechar('B');
-        dda->n = (((int32_t) dda->total_steps / dsq) * (int32_t) ssq) + 1;
-      }
-      else {
-        // otherwise
-        if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
-          serial_writechar('C');
-        dda->n = (((int32_t) ssq / dsq) * (int32_t) dda->total_steps) + 1;
-      }
+    dda_set_speed(dda, f, move_duration, c_limit);
+  }
 
-      if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
-        sersendf_P(PSTR("\n{DDA:CA end_c:%lu, n:%ld, md:%lu, ssq:%lu, esq:%lu, dsq:%lu, msbssq:%u, msbtot:%u}\n"), dda->end_c >> 8, dda->n, move_duration, ssq, esq, dsq, msb_ssq, msb_tot);
+  if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
+    serial_writestr_P(PSTR("] }\n"));
 
-      dda->accel = 1;
-    }
-    else
-      dda->accel = 0;
-#elif defined ACCELERATION_RAMPING
-      // yes, this assumes always the x axis as the critical one regarding acceleration. If we want to implement per-axis acceleration, things get tricky ...
-      dda->c_min = (move_duration / target->F) << 8;
-      if (dda->c_min < c_limit)
-        dda->c_min = c_limit;
-// This section is plain wrong, like in it's only half of what we need. This factor 960000 is dependant on STEPS_PER_MM.
-      // overflows at target->F > 65535; factor 16. found by try-and-error; will overshoot target speed a bit
-      dda->rampup_steps = target->F * target->F / (uint32_t)(STEPS_PER_M_X * ACCELERATION / 960000.);
-//sersendf_P(PSTR("rampup calc %lu\n"), dda->rampup_steps);
-      dda->rampup_steps = 100000; // replace mis-calculation by a safe value
-// End of wrong section.
-      if (dda->rampup_steps > dda->total_steps / 2)
-        dda->rampup_steps = dda->total_steps / 2;
-      dda->rampdown_steps = dda->total_steps - dda->rampup_steps;
-#elif defined ACCELERATION_TEMPORAL
-      // TODO: limit speed of individual axes to MAXIMUM_FEEDRATE
-      // TODO: calculate acceleration/deceleration for each axis
-      dda->x_step_interval = dda->y_step_interval = \
-        dda->z_step_interval = dda->e_step_interval = 0xFFFFFFFF;
-      if (dda->x_delta)
-        dda->x_step_interval = move_duration / dda->x_delta;
-      if (dda->y_delta)
-        dda->y_step_interval = move_duration / dda->y_delta;
-      if (dda->z_delta)
-        dda->z_step_interval = move_duration / dda->z_delta;
-      if (dda->e_delta)
-        dda->e_step_interval = move_duration / dda->e_delta;
-
-      dda->axis_to_step = 'x';
-      dda->c = dda->x_step_interval;
-      if (dda->y_step_interval < dda->c) {
-        dda->axis_to_step = 'y';
-        dda->c = dda->y_step_interval;
-      }
-      if (dda->z_step_interval < dda->c) {
-        dda->axis_to_step = 'z';
-        dda->c = dda->z_step_interval;
-      }
-      if (dda->e_step_interval < dda->c) {
-        dda->axis_to_step = 'e';
-        dda->c = dda->e_step_interval;
-      }
+#ifdef INVERSE_TIME
+  // the speed in mm/min it ends with, for the next one to accelerate from;
+  // a null move doesn't change that
+  if (f & F_INVERSE_TIME)
+    f = startpoint.F;
+#endif
 
-      dda->c <<= 8;
-#else
-      dda->c = (move_duration / target->F) << 8;
-      if (dda->c < c_limit)
-        dda->c = c_limit;
+  // next dda starts where we finish
+  memcpy(&startpoint, target, sizeof(TARGET));
+#ifdef INVERSE_TIME
+  startpoint.F = f;
 #endif
+}
+
+#ifdef ARC_NATIVE
+/// octant of (x, y), 0 to 7 counterclockwise from the positive X axis
+static uint8_t arc_octant(int32_t x, int32_t y) {
+  int32_t u, v;
+  uint8_t q;
+
+  // rotate into the first quadrant
+  if (x > 0 && y >= 0) {
+    q = 0; u = x; v = y;
+  }
+  else if (x <= 0 && y > 0) {
+    q = 2; u = y; v = -x;
+  }
+  else if (x < 0 && y <= 0) {
+    q = 4; u = -x; v = -y;
+  }
+  else {
+    q = 6; u = -y; v = x;
+  }
+
+  return (v >= u) ? q + 1 : q;
+}
+
+/*! CREATE a dda running along an arc in the XY plane
+  \param *dda pointer to a dda_queue entry to overwrite
+  \param *target end of the arc, Z and F as for a straight move
+  \param center_x center of the arc, in micrometers
+  \param center_y center of the arc, in micrometers
+  \param length length of the arc, in micrometers
+  \param ccw counterclockwise or clockwise
+  \param long_arc set for arcs of more than half a turn, full circles included
+
+  \ref startpoint the beginning position of this move, Z must stay as it is
+
+  The whole arc becomes a single entry in the queue, stepped along the
+  circle through the start by dda_arc_next(), so there are no chords at all.
+  Timing and acceleration work as for a straight move as long as the arc,
+  counted in steps of arc length.
+*/
+void dda_create_arc(DDA *dda, TARGET *target, int32_t center_x,
+                    int32_t center_y, uint32_t length, uint8_t ccw,
+                    uint8_t long_arc) {
+  int32_t cx, cy;
+  uint32_t hi, lo, steps_recip, move_duration, c_limit;
+  uint32_t f = target->F;
+  uint8_t octants;
+
+  cx = um_to_steps_x(center_x);
+  cy = um_to_steps_y(center_y);
+  dda->arc_x = startpoint_steps.X - cx;
+  dda->arc_y = startpoint_steps.Y - cy;
+  hi = square_sum(dda->arc_x, dda->arc_y, &lo);
+  dda->arc_radius = sqrt_wide(hi, lo);
+  // too small to be stepped along, with the steps rounded to a straight line
+  if (dda->arc_radius < 2) {
+    dda_create(dda, target);
+    return;
   }
 
+  // initialise DDA to a known state
+  dda->allflags = 0;
+  dda->arc = 1;
+  dda->arc_ccw = ccw;
+
+  // we end at the passed target
+  memcpy(&(dda->endpoint), target, sizeof(TARGET));
+
+  startpoint_steps.X = um_to_steps_x(target->X);
+  startpoint_steps.Y = um_to_steps_y(target->Y);
+  dda->arc_x_end = startpoint_steps.X - cx;
+  dda->arc_y_end = startpoint_steps.Y - cy;
+
+  if (ccw)
+    octants = arc_octant(dda->arc_x_end, dda->arc_y_end) -
+              arc_octant(dda->arc_x, dda->arc_y);
+  else
+    octants = arc_octant(dda->arc_x, dda->arc_y) -
+              arc_octant(dda->arc_x_end, dda->arc_y_end);
+  octants &= 7;
+  if (octants == 0 && long_arc)
+    octants = 8;
+  dda->arc_octants = octants;
+
   if (DEBUG_DDA && (debug_flags & DEBUG_DDA))
-    serial_writestr_P(PSTR("] }\n"));
+    sersendf_P(PSTR("\n{DDA_ARC: [%ld,%ld] [%ld,%ld] r:%lu o:%u l:%lu}\n"),
+               dda->arc_x, dda->arc_y, dda->arc_x_end, dda->arc_y_end,
+               dda->arc_radius, octants, length);
+
+  dda->total_steps = um_to_steps_x(length);
+  if (dda->total_steps == 0) {
+    if (dda->arc_x == dda->arc_x_end && dda->arc_y == dda->arc_y_end)
+      dda->nullmove = 1;
+    else
+      dda->total_steps = 1;
+  }
+
+  if ( ! dda->nullmove) {
+    // same as for straight moves, see there
+  #ifdef INVERSE_TIME
+    if (f & F_INVERSE_TIME)
+      move_duration = dda_inverse_time(dda, &f);
+    else
+  #endif
+    {
+      steps_recip = reciprocal(dda->total_steps);
+      move_duration = div_by_reciprocal(length * 2400, dda->total_steps, steps_recip) * (F_CPU / 40000);
+    }
+    // neither axis ever moves faster than the tool along the arc
+    c_limit = div_by_reciprocal(move_duration, ARC_FEEDRATE_MAX, RECIPROCAL(ARC_FEEDRATE_MAX)) << 8;
+    dda_set_speed(dda, f, move_duration, c_limit);
+  }
+
+  #ifdef INVERSE_TIME
+  // see dda_create()
+  if (f & F_INVERSE_TIME)
+    f = startpoint.F;
+  #endif
 
   // next dda starts where we finish
   memcpy(&startpoint, target, sizeof(TARGET));
+  #ifdef INVERSE_TIME
+  startpoint.F = f;
+  #endif
+}
+
+/*! Work out the steps of the next step interrupt of an arc
+  \param *dda the arc
+
+  Midpoint circle algorithm: each step of the leading axis, the one moving
+  faster in the current octant, comes with a step of the other axis if that
+  brings the position closer to the circle, i.e. \f$|x^2 + y^2 - r^2|\f$
+  smaller. That error is kept up to date by additions only.
+
+  Step interrupts are paced by arc length, one step each, so the leading axis
+  steps only on a fraction \f$|y| / r\f$ (for X leading) of them, counted
+  with a Bresenham style accumulator. This keeps the speed along the arc
+  constant and the cost of each step interrupt the same.
+
+  The arc ends once it passed as many octant boundaries as there are between
+  start and end and the leading axis got as far as the end, which is then
+  stepped to directly.
+  Direction outputs are set here already, one step interrupt ahead of the
+  step they're for.
+*/
+static void dda_arc_next(DDA *dda) {
+  int32_t x = move_state.arc_x, y = move_state.arc_y;
+  int32_t e = move_state.arc_error, e_other;
+  uint8_t next = 0, x_leads, reached;
+  int8_t dx, dy;
+
+  // direction of travel counterclockwise, by quadrant
+  if (x > 0 && y >= 0) {
+    dx = -1; dy = 1;
+  }
+  else if (x <= 0 && y > 0) {
+    dx = -1; dy = -1;
+  }
+  else if (x < 0 && y <= 0) {
+    dx = 1; dy = -1;
+  }
+  else {
+    dx = 1; dy = 1;
+  }
+  if ( ! dda->arc_ccw) {
+    dx = -dx;
+    dy = -dy;
+  }
+  x_leads = (labs(y) >= labs(x));
+
+  // In the octant of the end, the leading axis runs straight towards it.
+  if (x_leads)
+    reached = (dx > 0) ? (x >= dda->arc_x_end) : (x <= dda->arc_x_end);
+  else
+    reached = (dy > 0) ? (y >= dda->arc_y_end) : (y <= dda->arc_y_end);
+
+  if (move_state.arc_passed > dda->arc_octants ||
+      (move_state.arc_passed == dda->arc_octants && reached)) {
+    // as far as the end, which can be off the circle by a few steps when
+    // start and end weren't exactly the same distance from the center:
+    // step to it directly
+    if (x != dda->arc_x_end) {
+      dx = (x < dda->arc_x_end) ? 1 : -1;
+      x += dx;
+      next = ARC_STEP_X | ((dx > 0) ? ARC_DIR_X : 0);
+    }
+    if (y != dda->arc_y_end) {
+      dy = (y < dda->arc_y_end) ? 1 : -1;
+      y += dy;
+      next |= ARC_STEP_Y | ((dy > 0) ? ARC_DIR_Y : 0);
+    }
+    if ( ! next)
+      move_state.x_steps = 0;
+  }
+  else if (x_leads) {
+    move_state.arc_acc += labs(y);
+    if (move_state.arc_acc >= dda->arc_radius) {
+      move_state.arc_acc -= dda->arc_radius;
+      e += (dx > 0) ? 2 * x + 1 : 1 - 2 * x;
+      x += dx;
+      next = ARC_STEP_X | ((dx > 0) ? ARC_DIR_X : 0);
+      e_other = e + ((dy > 0) ? 2 * y + 1 : 1 - 2 * y);
+      if (labs(e_other) < labs(e)) {
+        e = e_other;
+        y += dy;
+        next |= ARC_STEP_Y | ((dy > 0) ? ARC_DIR_Y : 0);
+      }
+    }
+  }
+  else {
+    move_state.arc_acc += labs(x);
+    if (move_state.arc_acc >= dda->arc_radius) {
+      move_state.arc_acc -= dda->arc_radius;
+      e += (dy > 0) ? 2 * y + 1 : 1 - 2 * y;
+      y += dy;
+      next = ARC_STEP_Y | ((dy > 0) ? ARC_DIR_Y : 0);
+      e_other = e + ((dx > 0) ? 2 * x + 1 : 1 - 2 * x);
+      if (labs(e_other) < labs(e)) {
+        e = e_other;
+        x += dx;
+        next |= ARC_STEP_X | ((dx > 0) ? ARC_DIR_X : 0);
+      }
+    }
+  }
+
+  if (next) {
+    uint8_t octant = arc_octant(x, y);
+
+    if (octant != move_state.arc_octant) {
+      move_state.arc_octant = octant;
+      move_state.arc_passed++;
+    }
+  }
+
+  if (next & ARC_STEP_X)
+    x_direction(next & ARC_DIR_X);
+  if (next & ARC_STEP_Y)
+    y_direction(next & ARC_DIR_Y);
+
+  move_state.arc_x = x;
+  move_state.arc_y = y;
+  move_state.arc_error = e;
+  move_state.arc_next = next;
+}
+
+/// initialise move_state for an arc and set up its first step
+static void dda_arc_start(DDA *dda) {
+  move_state.arc_x = dda->arc_x;
+  move_state.arc_y = dda->arc_y;
+  move_state.arc_error = 0;
+  move_state.arc_acc = dda->arc_radius >> 1;
+  move_state.arc_octant = arc_octant(dda->arc_x, dda->arc_y);
+  move_state.arc_passed = 0;
+  // x_steps tells whether the arc is done, see dda_arc_next()
+  move_state.x_steps = 1;
+  move_state.y_steps = move_state.z_steps = 0;
+#ifdef ACCELERATION_RAMPING
+  move_state.step_no = 0;
+#endif
+  dda_arc_next(dda);
+}
+#endif /* ARC_NATIVE */
+
+/*! CREATE a dda which just waits
+  \param *dda pointer to a dda_queue entry to overwrite
+  \param ms how long to wait, in milliseconds
+
+  A dwell stays where \ref startpoint is. As the movebuffer runs moves one
+  after another, the move before it ends before it starts, the same stop as
+  between any two moves, and the move after it starts right when the timer
+  fires at the end of it. No need to empty the queue for that.
+*/
+void dda_create_dwell(DDA *dda, uint32_t ms) {
+  // initialise DDA to a known state
+  dda->allflags = 0;
+
+  memcpy(&(dda->endpoint), &startpoint, sizeof(TARGET));
+
+  if (ms)
+    dda->dwell = 1;
+  else
+    dda->nullmove = 1;
+  dda->c = ms;
+}
+
+/// wait for the next part of a dwell, or end it if there's nothing left
+static void dda_dwell_next(DDA *dda) {
+  uint32_t ms = dda->c;
+
+  if (ms == 0) {
+    dda->live = 0;
+    return;
+  }
+  if (ms > DWELL_CHUNK)
+    ms = DWELL_CHUNK;
+  dda->c -= ms;
+  setTimer(ms * (F_CPU / 1000));
 }
 
 /*! Start a prepared DDA
@@ -308,22 +717,34 @@ void dda_create(DDA *dda, TARGET *target) {
 */
 void dda_start(DDA *dda) {
   // called from interrupt context: keep it simple!
-  if (!dda->nullmove) {
-    // set direction outputs
-    x_direction(dda->x_direction);
-    y_direction(dda->y_direction);
-    z_direction(dda->z_direction);
-
-    // initialise state variable
-    move_state.x_counter = move_state.y_counter = move_state.z_counter = \
-      -(dda->total_steps >> 1);
-    memcpy(&move_state.x_steps, &dda->x_delta, sizeof(uint32_t) * 4);
+  profile_mark(PROFILE_START);
+  if (dda->dwell) {
+    dda->live = 1;
+    dda_dwell_next(dda);
+  }
+  else if (!dda->nullmove) {
+#ifdef ARC_NATIVE
+    if (dda->arc)
+      dda_arc_start(dda);
+    else
+#endif
+    {
+      // set direction outputs
+      x_direction(dda->x_direction);
+      y_direction(dda->y_direction);
+      z_direction(dda->z_direction);
+
+      // initialise state variable
+      move_state.x_counter = move_state.y_counter = move_state.z_counter = \
+        -(dda->total_steps >> 1);
+      memcpy(&move_state.x_steps, &dda->x_delta, sizeof(uint32_t) * 4);
 #ifdef ACCELERATION_RAMPING
-    move_state.step_no = 0;
+      move_state.step_no = 0;
 #endif
 #ifdef ACCELERATION_TEMPORAL
-    move_state.x_time = move_state.y_time = move_state.z_time = 0UL;
+      move_state.x_time = move_state.y_time = move_state.z_time = 0UL;
 #endif
+    }
 
     // ensure this dda starts
     dda->live = 1;
@@ -337,23 +758,25 @@ void dda_start(DDA *dda) {
 #else
     setTimer(dda->c >> 8);
 #endif
+
+#ifdef STEP_OC1A_AXIS
+    // The compare unit can do the steps of the axis which steps on every
+    // step interrupt. Not when homing, though, as the endstop is checked
+    // only after the step, nor on arcs. Only now that setTimer() has set
+    // the compare value for the first step, else a stale one could step.
+    // Interrupts are still off and the match is STEP_MARGIN away at least.
+    step_oc1a_start( ! dda->arc && dda->OC1A_DELTA == dda->total_steps &&
+                    ! dda->endstop_check);
+#endif
   }
   // else just a speed change, keep dda->live = 0
 
   current_position.F = dda->endpoint.F;
 }
 
-/*! STEP
-  \param *dda the current move
-
-  This is called from our timer interrupt every time a step needs to occur. Keep it as simple as possible!
-  We first work out which axes need to step, and generate step pulses for them
-  Then we re-enable global interrupts so serial data reception and other important things can occur while we do some math.
-  Next, we work out how long until our next step using the selected acceleration algorithm and set the timer.
-  Then we decide if this was the last step for this move, and if so mark this dda as dead so next timer interrupt we can start a new one.
-  Finally we de-assert any asserted step pins.
-*/
-void dda_step(DDA *dda) {
+/// step the axes of a straight move, returns which haven't finished homing
+static uint8_t dda_step_axes(DDA *) __attribute__ ((always_inline));
+inline uint8_t dda_step_axes(DDA *dda) {
   uint8_t endstop_stop; ///< Stop due to endstop trigger
   uint8_t endstop_not_done = 0; ///< Which axes haven't finished homing
 
@@ -435,6 +858,52 @@ void dda_step(DDA *dda) {
   }
 #endif
 
+  return endstop_not_done;
+}
+
+/*! STEP
+  \param *dda the current move
+
+  This is called from our timer interrupt every time a step needs to occur. Keep it as simple as possible!
+  We first work out which axes need to step, and generate step pulses for them
+  Then we re-enable global interrupts so serial data reception and other important things can occur while we do some math.
+  Next, we work out how long until our next step using the selected acceleration algorithm and set the timer.
+  Then we decide if this was the last step for this move, and if so mark this dda as dead so next timer interrupt we can start a new one.
+  Finally we de-assert any asserted step pins.
+*/
+void dda_step(DDA *dda) {
+  uint8_t endstop_not_done; ///< Which axes haven't finished homing
+
+  // a dwell has no steps, the timer just fired for its next part
+  if (dda->dwell) {
+    dda_dwell_next(dda);
+    return;
+  }
+
+#ifdef ARC_NATIVE
+  if (dda->arc) {
+    // steps were worked out in the previous step interrupt already
+    if (move_state.arc_next & ARC_STEP_X)
+      x_step();
+    if (move_state.arc_next & ARC_STEP_Y)
+      y_step();
+    endstop_not_done = 0;
+  }
+  else
+#endif
+  endstop_not_done = dda_step_axes(dda);
+
+#ifdef STEP_OC1A_AXIS
+  // the compare unit is disarmed when the pulse of the last step ends
+  if (move_state.OC1A_STEPS == 0)
+    step_oc1a = 0;
+#endif
+
+#ifdef STEP_PULSE_WIDTH
+  // all step pins which step are up now, timer 2 takes them down again
+  step_pulse_start();
+#endif
+
 #if STEP_INTERRUPT_INTERRUPTIBLE
   // Since we have sent steps to all the motors that will be stepping
   // and the rest of this function isn't so time critical, this interrupt
@@ -447,18 +916,27 @@ void dda_step(DDA *dda) {
 #ifdef ACCELERATION_REPRAP
   // linear acceleration magic, courtesy of http://www.embedded.com/columns/technicalinsights/56800129?printable=true
   if (dda->accel) {
+    profile_mark(PROFILE_RAMP);
     if ((dda->c > dda->end_c) && (dda->n > 0)) {
-      uint32_t new_c = dda->c - (dda->c * 2) / dda->n;
+      uint32_t new_c = dda->c - mul_hi(dda->c * 2, dda->n_recip);
       if (new_c <= dda->c && new_c > dda->end_c) {
         dda->c = new_c;
         dda->n += 4;
+        if (dda->n < 64)
+          dda->n_recip = reciprocal(dda->n);
+        else
+          dda->n_recip = reciprocal_update(dda->n_recip, dda->n);
       } else dda->c = dda->end_c;
     }
     else if ((dda->c < dda->end_c) && (dda->n < 0)) {
-      uint32_t new_c = dda->c + ((dda->c * 2) / -dda->n);
+      uint32_t new_c = dda->c + mul_hi(dda->c * 2, dda->n_recip);
       if (new_c >= dda->c && new_c < dda->end_c) {
         dda->c = new_c;
         dda->n += 4;
+        if (dda->n > -64)
+          dda->n_recip = reciprocal(-dda->n);
+        else
+          dda->n_recip = reciprocal_update(dda->n_recip, -dda->n);
       } else dda->c = dda->end_c;
     }
     else if (dda->c != dda->end_c) dda->c = dda->end_c;
@@ -487,9 +965,24 @@ void dda_step(DDA *dda) {
     recalc_speed = 1;
   }
   if (recalc_speed) {
+    uint32_t n_abs;
+
+    profile_mark(PROFILE_RAMP);
+
     move_state.n += 4;
-    // be careful of signedness!
-    move_state.c = (int32_t)move_state.c - ((int32_t)(move_state.c * 2) / (int32_t)move_state.n);
+    n_abs = (move_state.n < 0) ? -move_state.n : move_state.n;
+    // |n| changes by only 2 or 4 per step, so a single Newton-Raphson step
+    // from the previous reciprocal is sufficient once |n| is large enough
+    if (n_abs < 64)
+      move_state.n_recip = reciprocal(n_abs);
+    else
+      move_state.n_recip = reciprocal_update(move_state.n_recip, n_abs);
+    // c = c - 2c / n
+    if (move_state.n < 0)
+      move_state.c = add_sat(move_state.c,
+                             mul_hi(move_state.c * 2, move_state.n_recip));
+    else
+      move_state.c -= mul_hi(move_state.c * 2, move_state.n_recip);
   }
   move_state.step_no++;
 // Print the number of steps actually needed for ramping up
@@ -555,6 +1048,11 @@ void dda_step(DDA *dda) {
   dda->c <<= 8;
 #endif
 
+#ifdef ARC_NATIVE
+  if (dda->arc)
+    dda_arc_next(dda);
+#endif
+
   // If there are no steps left, we have finished.
   if (!(move_state.x_steps || move_state.y_steps || move_state.z_steps))
     dda->live = 0;
@@ -571,10 +1069,15 @@ void dda_step(DDA *dda) {
   setTimer(dda->c >> 8);
 #endif
 
+#ifndef STEP_PULSE_WIDTH
   // turn off step outputs, hopefully they've been on long enough by now to register with the drivers
-  // if not, too bad. or insert a (very!) small delay here, or fire up a spare timer or something.
+  // if not, too bad. or define STEP_PULSE_WIDTH to have them timed.
   // we also hope that we don't step before the drivers register the low- limit maximum speed if you think this is a problem.
   unstep();
+#ifdef STEP_OC1A_AXIS
+  step_oc1a_end();
+#endif
+#endif
 }
 
 /// update global current_position struct
@@ -585,7 +1088,22 @@ void update_current_position() {
     current_position.X = startpoint.X;
     current_position.Y = startpoint.Y;
     current_position.Z = startpoint.Z;
-  } else if (dda->live) {
+  }
+  else if (dda->dwell) {
+    current_position.X = dda->endpoint.X;
+    current_position.Y = dda->endpoint.Y;
+    current_position.Z = dda->endpoint.Z;
+  }
+#ifdef ARC_NATIVE
+  else if (dda->live && dda->arc) {
+    current_position.X = dda->endpoint.X -
+                         (dda->arc_x_end - move_state.arc_x) * 1000 / ((STEPS_PER_M_X + 500) / 1000);
+    current_position.Y = dda->endpoint.Y -
+                         (dda->arc_y_end - move_state.arc_y) * 1000 / ((STEPS_PER_M_Y + 500) / 1000);
+    current_position.Z = dda->endpoint.Z;
+  }
+#endif
+  else if (dda->live) {
     if (dda->x_direction)
       // (STEPS_PER_M_X / 1000) is a bit inaccurate for low STEPS_PER_M numbers
       current_position.X = dda->endpoint.X -
@@ -18,7 +18,8 @@
   \struct TARGET
   \brief target is simply a point in space/time
 
-  X, Y, Z are in micrometers unless explicitly stated. F is in mm/min.
+  X, Y, Z are in micrometers unless explicitly stated. F is in mm/min, or
+  inverse time with F_INVERSE_TIME set.
 */
 typedef struct {
 // TODO: We should really make up a loop for all axes.
@@ -26,6 +27,10 @@ typedef struct {
   uint32_t F;
 } TARGET;
 
+/// set in TARGET::F for inverse time feed, G93; the rest of F is how many
+/// times the move could be done per minute, in thousandths
+#define F_INVERSE_TIME 0x80000000UL
+
 /**
   \struct MOVE_STATE
   \brief this struct is made for tracking the current state of the movement
@@ -50,6 +55,18 @@ typedef struct {
   uint32_t c;
   /// tracking variable
   int32_t n;
+  /// 2^32 / |n|, kept up to date along with n
+  uint32_t n_recip;
+#endif
+#ifdef ARC_NATIVE
+  // arcs, see dda_create_arc()
+  int32_t arc_x; ///< position relative to the center, including the next step
+  int32_t arc_y; ///< position relative to the center, including the next step
+  int32_t arc_error; ///< \f$x^2 + y^2 - r^2\f$
+  uint32_t arc_acc; ///< paces the leading axis, see dda_arc_next()
+  uint8_t arc_octant; ///< octant the position is in
+  uint8_t arc_passed; ///< octant boundaries passed so far
+  uint8_t arc_next; ///< steps of the next step interrupt, ARC_STEP_* bits
 #endif
 #ifdef ACCELERATION_TEMPORAL
   uint32_t x_time; ///< time of the last x step
@@ -81,20 +98,36 @@ typedef struct {
       uint8_t x_direction:1; ///< direction flag for X axis
       uint8_t y_direction:1; ///< direction flag for Y axis
       uint8_t z_direction:1; ///< direction flag for Z axis
+      uint8_t arc:1; ///< bool: a circular move, see dda_create_arc()
+      uint8_t dwell:1; ///< bool: no axes move, wait for c milliseconds, see dda_create_dwell()
     };
     uint8_t allflags;  ///< used for clearing all flags
   };
-  // distances
-  uint32_t x_delta; ///< number of steps on X axis
-  uint32_t y_delta; ///< number of steps on Y axis
-  uint32_t z_delta; ///< number of steps on Z axis
-  /// total number of steps: set to \f$\max(\Delta x, \Delta y, \Delta z, \Delta e)\f$
+  union {
+    struct {
+      // distances
+      uint32_t x_delta; ///< number of steps on X axis
+      uint32_t y_delta; ///< number of steps on Y axis
+      uint32_t z_delta; ///< number of steps on Z axis
+    };
+#ifdef ARC_NATIVE
+    struct {
+      // arcs have no use for the above
+      int32_t arc_x; ///< start relative to the center, in steps
+      int32_t arc_y; ///< start relative to the center, in steps
+      uint32_t arc_radius; ///< in steps
+    };
+#endif
+  };
+  /// total number of steps: set to \f$\max(\Delta x, \Delta y, \Delta z, \Delta e)\f$,
+  /// for arcs to their length in steps
   uint32_t total_steps;
-  uint32_t c; ///< time until next step, 24.8 fixed point
+  uint32_t c; ///< time until next step, 24.8 fixed point; for a dwell, milliseconds still to wait
 
 #ifdef ACCELERATION_REPRAP
   uint32_t end_c; ///< time between 2nd last step and last step
   int32_t n; ///< precalculated step time offset variable. At every step we calculate \f$c = c - (2 c / n)\f$; \f$n+=4\f$. See http://www.embedded.com/columns/technicalinsights/56800129?printable=true for full description
+  uint32_t n_recip; ///< \f$2^{32} / |n|\f$, kept up to date along with n
 #endif
 #ifdef ACCELERATION_RAMPING
   /// number of steps accelerating
@@ -109,6 +142,12 @@ typedef struct {
   uint32_t y_step_interval; ///< time between steps on Y axis
   uint32_t z_step_interval; ///< time between steps on Z axis
   uint8_t axis_to_step;    ///< axis to be stepped on the next interrupt
+#endif
+#ifdef ARC_NATIVE
+  int32_t arc_x_end; ///< end relative to the center, in steps
+  int32_t arc_y_end; ///< end relative to the center, in steps
+  uint8_t arc_octants:4; ///< octant boundaries between start and end
+  uint8_t arc_ccw:1; ///< bool: counterclockwise
 #endif
   /// Endstop homing
   uint8_t endstop_check; ///< Do we need to check endstops? 0x1=Check X, 0x2=Check Y, 0x4=Check Z
@@ -137,6 +176,16 @@ void dda_new_startpoint(void);
 // create a DDA
 void dda_create(DDA *dda, TARGET *target);
 
+#ifdef ARC_NATIVE
+// create a DDA running along an arc in the XY plane
+void dda_create_arc(DDA *dda, TARGET *target, int32_t center_x,
+                    int32_t center_y, uint32_t length, uint8_t ccw,
+                    uint8_t long_arc);
+#endif
+
+// create a DDA doing nothing but waiting
+void dda_create_dwell(DDA *dda, uint32_t ms);
+
 // start a created DDA (called from timer interrupt)
 void dda_start(DDA *dda) __attribute__ ((hot));
 
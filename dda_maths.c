@@ -6,60 +6,332 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <avr/pgmspace.h>
 
-/*!
-  Integer multiply-divide algorithm. Returns the same as muldiv(multiplicand, multiplier, divisor), but also allowing to use precalculated quotients and remainders.
+/*! 32 x 32 bit multiplication with 64 bit result
+  \param a
+  \param b
+  \param lo receives the lower 32 bits of the product
+  \return upper 32 bits of the product
+
+  On AVRs with a hardware multiplier the product is put together from 16
+  MUL instructions, which is much faster and smaller than pulling in the
+  64-bit math routines. Elsewhere it's built from four 16 x 16 bit products.
+*/
+uint32_t mul_wide(uint32_t a, uint32_t b, uint32_t *lo) {
+#ifdef __AVR_HAVE_MUL__
+  uint32_t hi, l;
+  uint8_t zero;
+
+  // diagonal byte products go straight into place, the other twelve are
+  // added with carries rippled all the way up
+  __asm__ (
+    "clr   %2 \n\t"
+    "mul   %A3, %A4 \n\t"
+    "movw  %A1, r0 \n\t"
+    "mul   %B3, %B4 \n\t"
+    "movw  %C1, r0 \n\t"
+    "mul   %C3, %C4 \n\t"
+    "movw  %A0, r0 \n\t"
+    "mul   %D3, %D4 \n\t"
+    "movw  %C0, r0 \n\t"
+    "mul   %A3, %B4 \n\t"
+    "add   %B1, r0 \n\t"
+    "adc   %C1, r1 \n\t"
+    "adc   %D1, %2 \n\t"
+    "adc   %A0, %2 \n\t"
+    "adc   %B0, %2 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %B3, %A4 \n\t"
+    "add   %B1, r0 \n\t"
+    "adc   %C1, r1 \n\t"
+    "adc   %D1, %2 \n\t"
+    "adc   %A0, %2 \n\t"
+    "adc   %B0, %2 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %A3, %C4 \n\t"
+    "add   %C1, r0 \n\t"
+    "adc   %D1, r1 \n\t"
+    "adc   %A0, %2 \n\t"
+    "adc   %B0, %2 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %C3, %A4 \n\t"
+    "add   %C1, r0 \n\t"
+    "adc   %D1, r1 \n\t"
+    "adc   %A0, %2 \n\t"
+    "adc   %B0, %2 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %A3, %D4 \n\t"
+    "add   %D1, r0 \n\t"
+    "adc   %A0, r1 \n\t"
+    "adc   %B0, %2 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %D3, %A4 \n\t"
+    "add   %D1, r0 \n\t"
+    "adc   %A0, r1 \n\t"
+    "adc   %B0, %2 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %B3, %C4 \n\t"
+    "add   %D1, r0 \n\t"
+    "adc   %A0, r1 \n\t"
+    "adc   %B0, %2 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %C3, %B4 \n\t"
+    "add   %D1, r0 \n\t"
+    "adc   %A0, r1 \n\t"
+    "adc   %B0, %2 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %B3, %D4 \n\t"
+    "add   %A0, r0 \n\t"
+    "adc   %B0, r1 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %D3, %B4 \n\t"
+    "add   %A0, r0 \n\t"
+    "adc   %B0, r1 \n\t"
+    "adc   %C0, %2 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %C3, %D4 \n\t"
+    "add   %B0, r0 \n\t"
+    "adc   %C0, r1 \n\t"
+    "adc   %D0, %2 \n\t"
+    "mul   %D3, %C4 \n\t"
+    "add   %B0, r0 \n\t"
+    "adc   %C0, r1 \n\t"
+    "adc   %D0, %2 \n\t"
+    "clr   __zero_reg__ \n\t"
+    : "=&r" (hi), "=&r" (l), "=&r" (zero)
+    : "r" (a), "r" (b)
+  );
+  *lo = l;
+  return hi;
+#else
+  uint16_t ah = a >> 16, al = a & 0xFFFF;
+  uint16_t bh = b >> 16, bl = b & 0xFFFF;
+  uint32_t ll = (uint32_t)al * bl;
+  uint32_t lh = (uint32_t)al * bh;
+  uint32_t hl = (uint32_t)ah * bl;
+  uint32_t mid;
+
+  mid = (ll >> 16) + (lh & 0xFFFF) + (hl & 0xFFFF);
+  *lo = (mid << 16) | (ll & 0xFFFF);
+
+  return (uint32_t)ah * bh + (lh >> 16) + (hl >> 16) + (mid >> 16);
+#endif
+}
+
+/*! multiply-high
+  \param a
+  \param b
+  \return \f$(a \cdot b) / 2^{32}\f$, truncated
+*/
+uint32_t mul_hi(uint32_t a, uint32_t b) {
+  uint32_t lo;
+
+  return mul_wide(a, b, &lo);
+}
+
+/*! multiply-shift
+  \param a
+  \param b
+  \param shift 1 to 32
+  \return \f$(a \cdot b) / 2^{shift}\f$, rounded
+
+  For multiplying by fixed point constants, e.g. shift = 24 with b in 8.24
+  format. The result must fit into 32 bits.
+*/
+uint32_t mul_shift(uint32_t a, uint32_t b, uint8_t shift) {
+  uint32_t hi, lo;
+
+  hi = mul_wide(a, b, &lo);
+  if (shift == 32)
+    return hi + (lo >> 31);
+
+  // round by adding the highest bit shifted out
+  return ((hi << (32 - shift)) | (lo >> shift)) + ((lo >> (shift - 1)) & 1);
+}
+
+/*! 64 by 32 bit division
+  \param hi upper 32 bits of the dividend
+  \param lo lower 32 bits of the dividend
+  \param d divisor
+  \return \f$\lfloor (hi \cdot 2^{32} + lo) / d \rfloor\f$, 0xFFFFFFFF if
+          that doesn't fit into 32 bits or d = 0
+
+  Estimates the quotient by multiplying with reciprocal(d), which never
+  overshoots, subtracts, and repeats with what's left. Each pass leaves less
+  than \f$d / 2^{32}\f$ of the quotient to do, plus two for truncation. That's
+  up to three passes for divisors below \f$2^{16}\f$, five below \f$2^{24}\f$
+  and nine below \f$2^{28}\f$. Just above \f$2^{31}\f$, where reciprocal(d) is
+  1 for almost 2, a pass may only halve it, which makes up to 33 passes in
+  the worst case, each with two 32 x 32 bit multiplications.
+*/
+uint32_t div_wide(uint32_t hi, uint32_t lo, uint32_t d) {
+  uint32_t r, q = 0, q1, ph, pl;
 
+  if (hi >= d)
+    return 0xFFFFFFFF;
+
+  r = reciprocal(d);
+  while (hi || lo >= d) {
+    // hi < d, so hi * r can't overflow
+    q1 = hi * r + mul_hi(lo, r);
+    if (q1 == 0)
+      q1 = 1;
+    ph = mul_wide(q1, d, &pl);
+    hi -= ph + (lo < pl);
+    lo -= pl;
+    q += q1;
+  }
+
+  return q;
+}
+
+/*! multiply-divide
   \param multiplicand
-  \param qn ( = multiplier / divisor )
-  \param rn ( = multiplier % divisor )
+  \param multiplier
   \param divisor
   \return rounded result of multiplicand * multiplier / divisor
 
-  Calculate a * b / c, without overflowing and without using 64-bit integers.
-  Doing this the standard way, a * b could easily overflow, even if the correct
-  overall result fits into 32 bits. This algorithm avoids this intermediate
-  overflow and delivers valid results for all cases where each of the three
-  operators as well as the result fits into 32 bits.
-
-  Found on  http://stackoverflow.com/questions/4144232/
-  how-to-calculate-a-times-b-divided-by-c-only-using-32-bit-integer-types-even-i
-*/
-const int32_t muldivQR(int32_t multiplicand, uint32_t qn, uint32_t rn,
-                       uint32_t divisor) {
-  uint32_t quotient = 0;
-  uint32_t remainder = 0;
-  uint8_t negative_flag = 0;
-
-  if (multiplicand < 0) {
-    negative_flag = 1;
-    multiplicand = -multiplicand;
-  }
-
-  while(multiplicand) {
-    if (multiplicand & 1) {
-      quotient += qn;
-      remainder += rn;
-      if (remainder >= divisor) {
-        quotient++;
-        remainder -= divisor;
-      }
-    }
-    multiplicand  >>= 1;
-    qn <<= 1;
-    rn <<= 1;
-    if (rn >= divisor) {
-      qn++; 
-      rn -= divisor;
-    }
-  }
+  Uses a full 64 bit intermediate product, so it's exact for all cases where
+  the result fits into 32 bits.
+*/
+int32_t muldiv(int32_t multiplicand, uint32_t multiplier, uint32_t divisor) {
+  uint32_t hi, lo, h, q;
+
+  hi = mul_wide((multiplicand < 0) ? -multiplicand : multiplicand,
+                multiplier, &lo);
+
+  // rounding, halves down
+  h = (divisor - 1) / 2;
+  lo += h;
+  if (lo < h)
+    hi++;
+
+  q = div_wide(hi, lo, divisor);
+
+  return (multiplicand < 0) ? -((int32_t)q) : (int32_t)q;
+}
+
+/*! multiply by a fixed point constant
+  \param multiplicand
+  \param integer integer part of the constant
+  \param frac_hi upper 32 bits of the fractional part
+  \param frac_lo lower 32 bits of the fractional part
+  \return rounded result of multiplicand * (integer + fraction / 2^64)
+
+  The fraction is 64 bits wide and truncated, see FRACTION_HI() and
+  FRACTION_LO(), so the error is far below the distance of any non-tie result
+  to the next rounding boundary. This gives the same results as a true
+  multiply-divide, ties rounded down.
+*/
+int32_t mul_fixed(int32_t multiplicand, uint32_t integer, uint32_t frac_hi,
+                  uint32_t frac_lo) {
+  uint32_t a, q, lo, frac;
+
+  a = (multiplicand < 0) ? -multiplicand : multiplicand;
+
+  q = mul_wide(a, frac_hi, &lo);
+  frac = lo + mul_hi(a, frac_lo);
+  if (frac < lo)
+    q++;
+  q += a * integer;
 
   // rounding
-  if (remainder > divisor / 2)
-    quotient++;
+  if (frac > 0x80000000)
+    q++;
+
+  return (multiplicand < 0) ? -((int32_t)q) : (int32_t)q;
+}
+
+/// seeds for reciprocal(): \f$(1 / x - 1) \cdot 256\f$ for the middle of
+/// each of 128 intervals of \f$0.5 \leq x < 1\f$
+static const uint8_t recip_seed[128] PROGMEM = {
+  254, 250, 246, 242, 239, 235, 231, 228, 224, 221, 217, 214, 210, 207, 204, 201,
+  198, 194, 191, 188, 185, 182, 179, 177, 174, 171, 168, 165, 163, 160, 157, 155,
+  152, 150, 147, 145, 142, 140, 138, 135, 133, 131, 128, 126, 124, 122, 120, 117,
+  115, 113, 111, 109, 107, 105, 103, 101,  99,  97,  95,  94,  92,  90,  88,  86,
+   84,  83,  81,  79,  78,  76,  74,  73,  71,  69,  68,  66,  64,  63,  61,  60,
+   58,  57,  55,  54,  52,  51,  50,  48,  47,  45,  44,  43,  41,  40,  39,  37,
+   36,  35,  33,  32,  31,  30,  28,  27,  26,  25,  23,  22,  21,  20,  19,  18,
+   16,  15,  14,  13,  12,  11,  10,   9,   8,   7,   6,   5,   4,   3,   2,   1
+};
+
+/*! fixed point reciprocal
+  \param d divisor
+  \return \f$\lfloor 2^{32} / d \rfloor\f$, 0xFFFFFFFF for d = 0 or 1
+
+  The result is a 0.32 fixed point number, so mul_hi() of a 24.8 or 16.16
+  value and this reciprocal is their quotient in the same format as the
+  value. See div_by_reciprocal() for exact results.
+
+  d is normalised to \f$0.5 \leq x < 1\f$, an 8 bit seed taken from a table
+  and refined with two Newton-Raphson iterations
+  \f$y_{n+1} = y_n (2 - x y_n)\f$. Each iteration doubles the number of
+  correct bits. Rounding errors are fixed with a few compares at the end.
+*/
+uq0_32 reciprocal(uint32_t d) {
+  uint32_t n, y, r;
+  uint8_t k;
+
+  // powers of two are trivial, and the only case where 2^32 / d has no
+  // remainder, which the correction below relies on
+  if ((d & (d - 1)) == 0) {
+    if (d < 2)
+      return 0xFFFFFFFF;
+    return 1UL << (32 - msbloc(d));
+  }
+
+  // above 2^31 the quotient is between 1 and 2, and r below can start at 0,
+  // where 0 - r * d wraps and the correction never kicks in
+  if (d > 0x80000000)
+    return 1;
+
+  // d = n * 2^(k - 31), with n in [2^31, 2^32) representing x as 0.32
+  k = msbloc(d);
+  n = d << (31 - k);
+
+  // y is 1 / x as 1.31 fixed point
+  y = ((uint32_t)pgm_read_byte(&recip_seed[(n >> 24) & 0x7F]) << 23) |
+      0x80000000;
+  y = mul_hi(y, 0 - mul_hi(n, y)) << 1;
+  y = mul_hi(y, 0 - mul_hi(n, y)) << 1;
+
+  // truncation above can leave y a few ulps too high, so step back to make
+  // sure r doesn't exceed the exact result, then count up to it
+  r = (y - 4) >> k;
+  while ((uint32_t)(0 - r * d) >= d)
+    r++;
+
+  return r;
+}
+
+/*! refine the reciprocal of a value close to the one given
+  \param r \f$2^{32} / d_{old}\f$
+  \param d new divisor, close to \f$d_{old}\f$
+  \return approximately \f$2^{32} / d\f$
+
+  One Newton-Raphson iteration, starting from r. Relative error of the
+  result is the square of \f$(d - d_{old}) / d_{old}\f$, so this is good for
+  quantities counting up or down slowly, like n in the acceleration ramp.
+  Error of r has to be less than 50%.
+*/
+uq0_32 reciprocal_update(uq0_32 r, uint32_t d) {
+  // r * d is close to 2^32, so the truncated product is the distance to it
+  uint32_t p = r * d;
 
-  // remainder is valid here, but not returned
-  return negative_flag ? -((int32_t)quotient) : (int32_t)quotient;
+  if (p < 0x80000000)
+    return r - mul_hi(r, p);
+  else
+    return r + mul_hi(r, 0 - p);
 }
 
 // courtesy of http://www.flipcode.com/archives/Fast_Approximate_Distance_Functions.shtml
@@ -129,6 +401,76 @@ uint32_t approx_distance_3(uint32_t dx, uint32_t dy, uint32_t dz) {
   return (( approx + 512 ) >> 10 );
 }
 
+/*! exact 2d distance formula
+  \param dx distance in X plane
+  \param dy distance in Y plane
+  \return \f$\sqrt{\Delta x^2 + \Delta y^2}\f$, rounded
+
+  Built on int_sqrt(), so without 64-bit math. Arguments are scaled down to
+  15 bits first, which keeps the sum of squares within 32 bits. Below 32.767 mm
+  this costs no precision at all, above it the error stays below 0.007%.
+  Compare to up to 3.8% for approx_distance().
+*/
+uint32_t exact_distance(uint32_t dx, uint32_t dy) {
+  uint32_t max, sum;
+  uint16_t root;
+  uint8_t shift = 0;
+
+  max = (dx > dy) ? dx : dy;
+  if (max > 0x7FFF) {
+    shift = msbloc(max) - 14;
+    // round instead of truncate, in case a scaled argument becomes 0x8000
+    // the sum of squares still fits
+    dx = (dx + (1UL << (shift - 1))) >> shift;
+    dy = (dy + (1UL << (shift - 1))) >> shift;
+  }
+
+  // 16 x 16 bit multiplications are a lot cheaper than 32 x 32 bit ones
+  sum = (uint32_t)(uint16_t)dx * (uint16_t)dx +
+        (uint32_t)(uint16_t)dy * (uint16_t)dy;
+  root = int_sqrt(sum);
+  // int_sqrt() truncates, round to nearest
+  if (sum - (uint32_t)root * root > root)
+    root++;
+
+  return (uint32_t)root << shift;
+}
+
+/*! exact 3d distance formula
+  \param dx distance in X plane
+  \param dy distance in Y plane
+  \param dz distance in Z plane
+  \return \f$\sqrt{\Delta x^2 + \Delta y^2 + \Delta z^2}\f$, rounded
+
+  Same as exact_distance(), three squares of 15 bits each still fit into
+  32 bits. Error is below 0.007% above 32.767 mm, compare to up to 17% for
+  approx_distance_3().
+*/
+uint32_t exact_distance_3(uint32_t dx, uint32_t dy, uint32_t dz) {
+  uint32_t max, sum;
+  uint16_t root;
+  uint8_t shift = 0;
+
+  max = (dx > dy) ? dx : dy;
+  if (dz > max)
+    max = dz;
+  if (max > 0x7FFF) {
+    shift = msbloc(max) - 14;
+    dx = (dx + (1UL << (shift - 1))) >> shift;
+    dy = (dy + (1UL << (shift - 1))) >> shift;
+    dz = (dz + (1UL << (shift - 1))) >> shift;
+  }
+
+  sum = (uint32_t)(uint16_t)dx * (uint16_t)dx +
+        (uint32_t)(uint16_t)dy * (uint16_t)dy +
+        (uint32_t)(uint16_t)dz * (uint16_t)dz;
+  root = int_sqrt(sum);
+  if (sum - (uint32_t)root * root > root)
+    root++;
+
+  return (uint32_t)root << shift;
+}
+
 /*!
   integer square root algorithm
   \param a find square root of this number
@@ -157,6 +499,193 @@ uint16_t int_sqrt(uint32_t a) {
   return (uint16_t) ((root >> 1) & 0xFFFFL);
 }
 
+/*!
+  fixed point square root
+  \param a find square root of this number
+  \return \f$\sqrt{a}\f$ in 24.8 format, truncated
+
+  Same algorithm as int_sqrt(), continued for another 8 bits worth of zeros
+  behind the binary point.
+*/
+uq24_8 fixed_sqrt(uint32_t a) {
+  uint32_t rem = 0;
+  uint32_t root = 0;
+  uint8_t i;
+
+  for (i = 0; i < 24; i++) {
+    root <<= 1;
+    rem = ((rem << 2) + (a >> 30));
+    a <<= 2;
+    root++;
+    if (root <= rem) {
+      rem -= root;
+      root++;
+    }
+    else
+      root--;
+  }
+  return root >> 1;
+}
+
+/*!
+  square root of a 64 bit number
+  \param hi upper 32 bits
+  \param lo lower 32 bits
+  \return \f$\lfloor \sqrt{hi \cdot 2^{32} + lo} \rfloor\f$
+
+  For lengths with squares exceeding 32 bits, like the radius of an arc.
+  Newton's iteration from a power of two above the root, each pass costs a
+  div_wide().
+*/
+uint32_t sqrt_wide(uint32_t hi, uint32_t lo) {
+  uint32_t x, y, q;
+  uint8_t half;
+
+  if (hi == 0)
+    return int_sqrt(lo);
+
+  half = (64 - clz(hi) + 1) / 2;
+  x = (half == 32) ? 0xFFFFFFFF : 1UL << half;
+  for (;;) {
+    q = div_wide(hi, lo, x);
+    // (x + q) / 2 without overflowing
+    y = (x >> 1) + (q >> 1) + (x & q & 1);
+    if (y >= x)
+      return x;
+    x = y;
+  }
+}
+
+/*!
+  square of the length of a vector
+  \param a first component
+  \param b second component
+  \param lo receives the lower 32 bits
+  \return upper 32 bits of \f$a^2 + b^2\f$
+
+  Goes together with sqrt_wide() for lengths of vectors in micrometers.
+*/
+uint32_t square_sum(int32_t a, int32_t b, uint32_t *lo) {
+  uint32_t hi, hi_b, lo_b;
+
+  hi = mul_wide((a < 0) ? -a : a, (a < 0) ? -a : a, lo);
+  hi_b = mul_wide((b < 0) ? -b : b, (b < 0) ? -b : b, &lo_b);
+  *lo += lo_b;
+
+  return hi + hi_b + (*lo < lo_b);
+}
+
+/// number of CORDIC iterations, one bit of precision each
+#define CORDIC_STEPS 30
+
+/// CORDIC gain compensation, \f$\prod 1 / \sqrt{1 + 2^{-2i}}\f$, 2.30 format
+#define CORDIC_GAIN 652032874L
+
+/// arc tangents of \f$2^{-i}\f$, in binary angle units
+static const uint32_t atan_table[CORDIC_STEPS] PROGMEM = {
+  536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838,
+  5340245, 2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861,
+  10430, 5215, 2608, 1304, 652, 326, 163, 81, 41, 20, 10, 5, 3, 1
+};
+
+/// a * b / 2^30, rounded, for multiplying with sine and cosine
+int32_t mul_q30(int32_t a, int32_t b) {
+  uint32_t hi, lo, r;
+
+  hi = mul_wide((a < 0) ? -a : a, (b < 0) ? -b : b, &lo);
+  r = (hi << 2) + (lo >> 30) + ((lo >> 29) & 1);
+
+  return ((a < 0) != (b < 0)) ? -((int32_t)r) : (int32_t)r;
+}
+
+/** cosine and sine by CORDIC
+  \param angle binary angle, a full turn is \f$2^{32}\f$
+  \param c receives the cosine, 2.30
+  \param s receives the sine, 2.30
+*/
+void cordic_sincos(int32_t angle, int32_t *c, int32_t *s) {
+  int32_t x = CORDIC_GAIN, y = 0, t;
+  uint8_t i;
+
+  // CORDIC converges within a quarter turn only, turn by half a turn
+  // otherwise, which just flips the signs
+  if (angle > 0x40000000L || angle < -0x40000000L) {
+    x = -x;
+    angle += 0x80000000UL;
+  }
+
+  for (i = 0; i < CORDIC_STEPS; i++) {
+    int32_t a = pgm_read_dword(&atan_table[i]);
+
+    t = x;
+    if (angle >= 0) {
+      x -= y >> i;
+      y += t >> i;
+      angle -= a;
+    }
+    else {
+      x += y >> i;
+      y -= t >> i;
+      angle += a;
+    }
+  }
+  *c = x;
+  *s = y;
+}
+
+/** arc tangent by CORDIC
+  \param y
+  \param x
+  \return angle of (x, y) as binary angle, counterclockwise from the x axis
+
+  Both must be below \f$2^{30}\f$ either way.
+*/
+uint32_t cordic_atan2(int32_t y, int32_t x) {
+  uint32_t angle = 0, m;
+  int32_t t;
+  uint8_t i;
+
+  // CORDIC converges in the right half plane only
+  if (x < 0) {
+    x = -x;
+    y = -y;
+    angle = 0x80000000UL;
+  }
+
+  // scale to 28 bits, precise enough and leaving room for the CORDIC gain
+  m = (uint32_t)x | (uint32_t)((y < 0) ? -y : y);
+  if (m == 0)
+    return 0;
+  while (m < 0x10000000UL) {
+    x *= 2;
+    y *= 2;
+    m <<= 1;
+  }
+  while (m >= 0x20000000UL) {
+    x >>= 1;
+    y >>= 1;
+    m >>= 1;
+  }
+
+  for (i = 0; i < CORDIC_STEPS; i++) {
+    uint32_t a = pgm_read_dword(&atan_table[i]);
+
+    t = x;
+    if (y > 0) {
+      x += y >> i;
+      y -= t >> i;
+      angle += a;
+    }
+    else {
+      x -= y >> i;
+      y += t >> i;
+      angle -= a;
+    }
+  }
+
+  return angle;
+}
+
 // this is an ultra-crude pseudo-logarithm routine, such that:
 // 2 ^ msbloc(v) >= v
 /*! crude logarithm algorithm
@@ -164,12 +693,5 @@ uint16_t int_sqrt(uint32_t a) {
   \return floor(log(v) / log(2))
 */
 const uint8_t msbloc (uint32_t v) {
-  uint8_t i;
-  uint32_t c;
-  for (i = 31, c = 0x80000000; i; i--) {
-    if (v & c)
-      return i;
-    c >>= 1;
-  }
-  return 0;
+  return v ? 31 - clz(v) : 0;
 }
@@ -5,16 +5,85 @@
 
 #include "config.h"
 
-// return rounded result of multiplicand * multiplier / divisor
-// this version is with quotient and remainder precalculated elsewhere
-const int32_t muldivQR(int32_t multiplicand, uint32_t qn, uint32_t rn,
-                       uint32_t divisor);
+/*
+  fixed point formats, named by their integer and fractional bits
+*/
+typedef uint32_t uq24_8;   ///< e.g. step times in timer ticks
+typedef uint32_t uq8_24;   ///< constant factors, see mul_shift()
+typedef uint32_t uq0_32;   ///< reciprocals, see reciprocal()
+
+/*
+  saturating arithmetics
+*/
+static uint32_t add_sat(uint32_t, uint32_t) __attribute__ ((always_inline));
+inline uint32_t add_sat(uint32_t a, uint32_t b) {
+  uint32_t sum = a + b;
+
+  return (sum < a) ? 0xFFFFFFFF : sum;
+}
+
+static uint32_t sub_sat(uint32_t, uint32_t) __attribute__ ((always_inline));
+inline uint32_t sub_sat(uint32_t a, uint32_t b) {
+  return (a > b) ? a - b : 0;
+}
+
+// number of leading zero bits, 32 for v = 0
+static uint8_t clz(uint32_t) __attribute__ ((always_inline));
+inline uint8_t clz(uint32_t v) {
+  // the builtins are undefined for 0
+  if ( ! v)
+    return 32;
+#if __SIZEOF_INT__ >= 4
+  return __builtin_clz(v) - (__SIZEOF_INT__ * 8 - 32);
+#else
+  return __builtin_clzl(v);
+#endif
+}
+
+// 64 bit product, returns the upper and stores the lower 32 bits in *lo
+uint32_t mul_wide(uint32_t a, uint32_t b, uint32_t *lo);
+
+// upper 32 bits of a * b
+uint32_t mul_hi(uint32_t a, uint32_t b);
+
+// a * b / 2^shift, rounded
+uint32_t mul_shift(uint32_t a, uint32_t b, uint8_t shift);
+
+// 64 bit (hi, lo) divided by 32 bit d
+uint32_t div_wide(uint32_t hi, uint32_t lo, uint32_t d);
 
 // return rounded result of multiplicand * multiplier / divisor
-static int32_t muldiv(int32_t, uint32_t, uint32_t) __attribute__ ((always_inline));
-inline int32_t muldiv(int32_t multiplicand, uint32_t multiplier,
-                      uint32_t divisor) {
-  return muldivQR(multiplicand, multiplier / divisor, multiplier % divisor, divisor);
+int32_t muldiv(int32_t multiplicand, uint32_t multiplier, uint32_t divisor);
+
+// return rounded result of multiplicand * (integer + fraction / 2^64)
+int32_t mul_fixed(int32_t multiplicand, uint32_t integer, uint32_t frac_hi,
+                  uint32_t frac_lo);
+
+// fractional part of n / d in 0.64 format, for constants only
+#define FRACTION_HI(n, d) \
+  ((uint32_t)((((uint64_t)((n) % (d))) << 32) / (d)))
+#define FRACTION_LO(n, d) \
+  ((uint32_t)((((((uint64_t)((n) % (d))) << 32) % (d)) << 32) / (d)))
+
+// 0.32 fixed point reciprocal, 2^32 / d
+uq0_32 reciprocal(uint32_t d);
+
+// reciprocal of a constant, for div_by_reciprocal(). At most one less than
+// reciprocal(), which is fine there.
+#define RECIPROCAL(d) (0xFFFFFFFFUL / (d))
+
+// Newton-Raphson step from the reciprocal of a nearby value
+uq0_32 reciprocal_update(uq0_32 r, uint32_t d);
+
+// return a / d, exact, with r = reciprocal(d) precalculated elsewhere
+static uint32_t div_by_reciprocal(uint32_t, uint32_t, uq0_32) __attribute__ ((always_inline));
+inline uint32_t div_by_reciprocal(uint32_t a, uint32_t d, uq0_32 r) {
+  uint32_t q = mul_hi(a, r);
+
+  // r is at most one less than exact, so q is at most one less as well
+  if (a - q * d >= d)
+    q++;
+  return q;
 }
 
 /*
@@ -22,25 +91,29 @@ inline int32_t muldiv(int32_t multiplicand, uint32_t multiplier,
 */
 // Like shown in the patch attached to this post:
 // http://forums.reprap.org/read.php?147,89710,130225#msg-130225 ,
-// it might be worth pre-calculating muldivQR()'s qn and rn in dda_init()
-// as soon as STEPS_PER_M_{XYZE} is no longer a compile-time variable.
+// it might be worth pre-calculating mul_fixed()'s integer and fraction in
+// dda_init() as soon as STEPS_PER_M_{XYZE} is no longer a compile-time
+// variable.
 
 static int32_t um_to_steps_x(int32_t) __attribute__ ((always_inline));
 inline int32_t um_to_steps_x(int32_t distance) {
-  return muldivQR(distance, STEPS_PER_M_X / 1000000UL,
-                  STEPS_PER_M_X % 1000000UL, 1000000UL);
+  return mul_fixed(distance, STEPS_PER_M_X / 1000000UL,
+                   FRACTION_HI(STEPS_PER_M_X, 1000000UL),
+                   FRACTION_LO(STEPS_PER_M_X, 1000000UL));
 }
 
 static int32_t um_to_steps_y(int32_t) __attribute__ ((always_inline));
 inline int32_t um_to_steps_y(int32_t distance) {
-  return muldivQR(distance, STEPS_PER_M_Y / 1000000UL,
-                  STEPS_PER_M_Y % 1000000UL, 1000000UL);
+  return mul_fixed(distance, STEPS_PER_M_Y / 1000000UL,
+                   FRACTION_HI(STEPS_PER_M_Y, 1000000UL),
+                   FRACTION_LO(STEPS_PER_M_Y, 1000000UL));
 }
 
 static int32_t um_to_steps_z(int32_t) __attribute__ ((always_inline));
 inline int32_t um_to_steps_z(int32_t distance) {
-  return muldivQR(distance, STEPS_PER_M_Z / 1000000UL,
-                  STEPS_PER_M_Z % 1000000UL, 1000000UL);
+  return mul_fixed(distance, STEPS_PER_M_Z / 1000000UL,
+                   FRACTION_HI(STEPS_PER_M_Z, 1000000UL),
+                   FRACTION_LO(STEPS_PER_M_Z, 1000000UL));
 }
 
 // approximate 2D distance
@@ -49,9 +122,33 @@ uint32_t approx_distance(uint32_t dx, uint32_t dy);
 // approximate 3D distance
 uint32_t approx_distance_3(uint32_t dx, uint32_t dy, uint32_t dz);
 
+// exact 2D distance
+uint32_t exact_distance(uint32_t dx, uint32_t dy);
+
+// exact 3D distance
+uint32_t exact_distance_3(uint32_t dx, uint32_t dy, uint32_t dz);
+
 // integer square root algorithm
 uint16_t int_sqrt(uint32_t a);
 
+// square root with 8 bits of fraction
+uq24_8 fixed_sqrt(uint32_t a);
+
+// square root of the 64 bit (hi, lo), truncated
+uint32_t sqrt_wide(uint32_t hi, uint32_t lo);
+
+// a^2 + b^2, 64 bits in the result and *lo
+uint32_t square_sum(int32_t a, int32_t b, uint32_t *lo);
+
+// a * b / 2^30, rounded, for multiplying with sine and cosine
+int32_t mul_q30(int32_t a, int32_t b);
+
+// cosine and sine of a binary angle, 2.30
+void cordic_sincos(int32_t angle, int32_t *c, int32_t *s);
+
+// angle of (x, y) as binary angle
+uint32_t cordic_atan2(int32_t y, int32_t x);
+
 // this is an ultra-crude pseudo-logarithm routine, such that:
 // 2 ^ msbloc(v) >= v
 const uint8_t msbloc(uint32_t v);
@@ -15,6 +15,7 @@
 #include  "sersendf.h"
 #include  "clock.h"
 #include  "memory_barrier.h"
+#include  "profile.h"
 
 /// movebuffer head pointer. Points to the last move in the queue.
 /// this variable is used both in and out of interrupts, but is
@@ -74,9 +75,11 @@ void queue_step() {
 
   // fall directly into dda_start instead of waiting for another step
   // the dda dies not directly after its last step, but when the timer fires and there's no steps to do
-  if (current_movebuffer->live) next_move();
+  if (current_movebuffer->live == 0) next_move();
 }
 
+static void enqueue_start(uint8_t h);
+
 /// add a move to the movebuffer
 /// \note this function waits for space to be available if necessary, check queue_full() first if waiting is a problem
 /// This is the only function that modifies mb_head and it always called from outside an interrupt.
@@ -92,11 +95,59 @@ void enqueue_home(TARGET *t, uint8_t endstop_check, uint8_t endstop_stop_cond) {
   h &= (MOVEBUFFER_SIZE - 1);
 
   DDA* new_movebuffer = &(movebuffer[h]);
-  
+
+#ifdef PROFILE_STEP_ISR
+  uint32_t profile_entry = timer_clocks();
+#endif
   dda_create(new_movebuffer, t);
+#ifdef PROFILE_STEP_ISR
+  profile_record_create(timer_clocks() - profile_entry);
+#endif
   new_movebuffer->endstop_check = endstop_check;
   new_movebuffer->endstop_stop_cond = endstop_stop_cond;
 
+  enqueue_start(h);
+}
+
+#ifdef ARC_NATIVE
+/// add an arc in the XY plane to the movebuffer, see dda_create_arc()
+/// \note this function waits for space to be available if necessary, like enqueue()
+void enqueue_arc(TARGET *t, int32_t center_x, int32_t center_y,
+                 uint32_t length, uint8_t ccw, uint8_t long_arc) {
+  while (queue_full()) delay(WAITING_DELAY);
+
+  uint8_t h = mb_head + 1;
+  h &= (MOVEBUFFER_SIZE - 1);
+
+  DDA* new_movebuffer = &(movebuffer[h]);
+
+  dda_create_arc(new_movebuffer, t, center_x, center_y, length, ccw, long_arc);
+  new_movebuffer->endstop_check = 0;
+  new_movebuffer->endstop_stop_cond = 0;
+
+  enqueue_start(h);
+}
+#endif
+
+/// add a dwell to the movebuffer, see dda_create_dwell()
+/// \note this function waits for space to be available if necessary, like enqueue()
+void enqueue_dwell(uint32_t ms) {
+  while (queue_full()) delay(WAITING_DELAY);
+
+  uint8_t h = mb_head + 1;
+  h &= (MOVEBUFFER_SIZE - 1);
+
+  DDA* new_movebuffer = &(movebuffer[h]);
+
+  dda_create_dwell(new_movebuffer, ms);
+  new_movebuffer->endstop_check = 0;
+  new_movebuffer->endstop_stop_cond = 0;
+
+  enqueue_start(h);
+}
+
+/// hand the move just created in slot h over to the step interrupt
+static void enqueue_start(uint8_t h) {
   // make certain all writes to global memory
   // are flushed before modifying mb_head.
   MEMORY_BARRIER();
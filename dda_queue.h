@@ -25,6 +25,11 @@ void queue_step(void);
 // add a new target to the queue
 void enqueue(TARGET *t);
 void enqueue_home(TARGET *t, uint8_t endstop_check, uint8_t endstop_stop_cond);
+#ifdef ARC_NATIVE
+void enqueue_arc(TARGET *t, int32_t center_x, int32_t center_y,
+                 uint32_t length, uint8_t ccw, uint8_t long_arc);
+#endif
+void enqueue_dwell(uint32_t ms);
 
 // called from step timer when current move is complete
 void next_move(void) __attribute__ ((hot));
@@ -0,0 +1,283 @@
+#include "gcode_binary.h"
+
+/** \file
+  \brief Parse binary command frames, a compact alternative to G-code text
+
+  M252 switches from G-code text to binary frames, M252 S0 sent as a frame
+  switches back. Each frame carries one command:
+
+  <pre>
+  0xA5              start of frame
+  sequence          1 byte, 0 for the first frame after M252, then counting up
+  mask              3 bytes, which words follow, see below
+  words             in order of their mask bits
+  crc               2 bytes, CRC-16 (poly 0xA001, init 0) of all but the start
+  </pre>
+
+  All values are little endian integers.
+
+  <pre>
+  bit  word  bytes  unit
+   0    G     1
+   1    M     1
+   2    X     4     micrometers, signed
+   3    Y     4     micrometers, signed
+   4    Z     4     micrometers, signed
+   5    F     4     mm/min, 1/1000 per minute after G93
+   6    S     2     signed
+   7    P     2     milliseconds
+   8    T     1
+   9    -           unused, the sequence number takes the place of N
+  10    I     4     micrometers, signed
+  11    J     4     micrometers, signed
+  12    K     4     micrometers, signed
+  13    R     4     micrometers, signed
+  14    Q     4     micrometers, signed
+  15    L     2
+  16    D     1
+  17    H     1
+  </pre>
+
+  "G1 X123.456 Y78.901 F1500" becomes 20 bytes instead of 26 plus newline,
+  and is queued without any decimal conversion. Frames are acknowledged
+  with "ok" like lines of text, replies are text as well.
+
+  A frame failing its CRC is dropped and answered with "rs S" and the
+  sequence number of the frame expected next, like "rs S17". So are frames
+  with another sequence number than that, but only the first of them asks
+  for a resend. Before sending frames again from the one asked for, the
+  host sends FRAME_MAX zero bytes: should a lost start byte have left the
+  parser reading a frame at a wrong place, that frame is over by then, and
+  zeros are skipped while looking for the next start byte.
+*/
+
+#include <util/crc16.h>
+
+#include "serial.h"
+#include "sersendf.h"
+#include "gcode_parse.h"
+
+#ifdef GCODE_BINARY
+
+/// byte starting each frame
+#define FRAME_START 0xA5
+/// number of mask bits, including the unused one
+#define FRAME_WORDS 18
+/// mask bits of words which exist, the same as the seen_ flags
+#define FRAME_MASK 0x3FDFFUL
+/// longest frame possible, in bytes
+#define FRAME_MAX 54
+
+/// size of each word in a frame, in bytes
+static const uint8_t word_size[FRAME_WORDS] PROGMEM = {
+  1, 1, 4, 4, 4, 4, 2, 2, 1, 0, 4, 4, 4, 4, 4, 2, 1, 1
+};
+
+/// states of the frame parser
+enum {
+  FRAME_HUNT,      ///< waiting for FRAME_START
+  FRAME_SEQUENCE,
+  FRAME_MASK_0,
+  FRAME_MASK_1,
+  FRAME_MASK_2,
+  FRAME_WORD,      ///< reading frame_word
+  FRAME_CRC_LO,
+  FRAME_CRC_HI
+};
+
+uint8_t binary_mode = 0;
+
+/// current state of the frame parser
+uint8_t frame_state = FRAME_HUNT;
+/// sequence number of the current frame
+uint8_t frame_sequence;
+/// sequence number the next frame should have
+uint8_t frame_expected = 0;
+/// set after asking for a resend, until the frame asked for arrives
+uint8_t frame_resend = 0;
+/// words still to come in the current frame
+uint32_t frame_mask;
+/// word being read
+uint8_t frame_word;
+/// bytes of it read so far
+uint8_t frame_byte;
+/// its value so far
+uint32_t frame_value;
+/// CRC of the frame so far, then the CRC received
+uint16_t frame_crc;
+/// low byte of the CRC received
+uint8_t frame_crc_lo;
+
+/// find the next word in the frame, set frame_state accordingly
+static void next_word(void) {
+  frame_byte = 0;
+  frame_value = 0;
+  while (frame_word < FRAME_WORDS) {
+    if (frame_mask & (1UL << frame_word)) {
+      frame_state = FRAME_WORD;
+      return;
+    }
+    frame_word++;
+  }
+  frame_state = FRAME_CRC_LO;
+}
+
+/// store a complete word into \ref next_target
+static void store_word(void) {
+  switch (frame_word) {
+    case 0:
+      next_target.G = frame_value;
+#ifdef INVERSE_TIME
+      // applies to F in the same frame, which comes after G
+      if (frame_value == 93 || frame_value == 94)
+        gcode_feed_mode(frame_value == 93);
+#endif
+      break;
+    case 1:
+      next_target.M = frame_value;
+      break;
+    case 2:
+      next_target.target.X = (int32_t)frame_value;
+      break;
+    case 3:
+      next_target.target.Y = (int32_t)frame_value;
+      break;
+    case 4:
+      next_target.target.Z = (int32_t)frame_value;
+      break;
+    case 5:
+      next_target.target.F = frame_value;
+#ifdef INVERSE_TIME
+      // G93, in thousandths like text, see store_field()
+      if (next_target.option_inverse_time) {
+        if ((int32_t)frame_value <= 0)
+          next_target.target.F = 1;
+        next_target.target.F |= F_INVERSE_TIME;
+      }
+#endif
+      break;
+    case 6:
+      next_target.S = (int16_t)frame_value;
+      break;
+    case 7:
+      next_target.P = frame_value;
+      break;
+    case 8:
+      next_target.T = frame_value;
+      break;
+    case 10:
+      next_target.I = (int32_t)frame_value;
+      break;
+    case 11:
+      next_target.J = (int32_t)frame_value;
+      break;
+    case 12:
+      next_target.K = (int32_t)frame_value;
+      break;
+    case 13:
+      next_target.R = (int32_t)frame_value;
+      break;
+    case 14:
+      next_target.Q = (int32_t)frame_value;
+      break;
+    case 15:
+      next_target.L = frame_value;
+      break;
+    case 16:
+      next_target.D = frame_value;
+      break;
+    case 17:
+      next_target.H = frame_value;
+      break;
+  }
+}
+
+/// the next frame is the first one, number 0
+void gcode_binary_start() {
+  frame_state = FRAME_HUNT;
+  frame_expected = 0;
+  frame_resend = 0;
+}
+
+/// Byte received - add it to the current frame
+/// \param c the next byte to process
+void gcode_binary_char(uint8_t c) {
+  if (frame_state != FRAME_CRC_LO && frame_state != FRAME_CRC_HI)
+    frame_crc = _crc16_update(frame_crc, c);
+
+  switch (frame_state) {
+    case FRAME_HUNT:
+      if (c == FRAME_START) {
+        gcode_command_begin();
+        frame_crc = 0;
+        frame_state = FRAME_SEQUENCE;
+      }
+      break;
+
+    case FRAME_SEQUENCE:
+      frame_sequence = c;
+      frame_state = FRAME_MASK_0;
+      break;
+
+    case FRAME_MASK_0:
+      frame_mask = c;
+      frame_state = FRAME_MASK_1;
+      break;
+
+    case FRAME_MASK_1:
+      frame_mask |= (uint16_t)c << 8;
+      frame_state = FRAME_MASK_2;
+      break;
+
+    case FRAME_MASK_2:
+      frame_mask |= (uint32_t)c << 16;
+      frame_mask &= FRAME_MASK;
+      // the mask bits match the seen_ flags of next_target;
+      // a frame with neither G nor M is a G1, like a line of text
+      if (frame_mask & 0x3) {
+        next_target.seen_G = 0;
+        next_target.G = 0;
+        next_target.M = 0;
+      }
+      next_target.flags |= frame_mask;
+      frame_word = 0;
+      next_word();
+      break;
+
+    case FRAME_WORD:
+      frame_value |= (uint32_t)c << (frame_byte << 3);
+      if (++frame_byte == pgm_read_byte(&word_size[frame_word])) {
+        store_word();
+        frame_word++;
+        next_word();
+      }
+      break;
+
+    case FRAME_CRC_LO:
+      frame_crc_lo = c;
+      frame_state = FRAME_CRC_HI;
+      break;
+
+    case FRAME_CRC_HI:
+      frame_state = FRAME_HUNT;
+      if (frame_crc == (frame_crc_lo | ((uint16_t)c << 8)) &&
+          frame_sequence == frame_expected) {
+        frame_expected++;
+        frame_resend = 0;
+        gcode_command_done();
+      }
+      else {
+        // Drop the frame and ask for a resend, once, as for lines of text.
+        // A bad CRC may have come from a lost start byte as well, so go by
+        // the sequence number only if the CRC is fine.
+        if ( ! frame_resend)
+          sersendf_P(PSTR("rs S%u\n"), frame_expected);
+        frame_resend = 1;
+        serial_writestr_P(PSTR("ok\n"));
+        gcode_command_drop();
+      }
+      break;
+  }
+}
+
+#endif /* GCODE_BINARY */
@@ -0,0 +1,21 @@
+#ifndef _GCODE_BINARY_H
+#define _GCODE_BINARY_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+#ifdef GCODE_BINARY
+
+/// set while the host sends binary frames instead of G-code text
+extern uint8_t binary_mode;
+
+/// accept the next byte of a binary frame
+void gcode_binary_char(uint8_t c);
+
+/// start over with frame number 0, after switching to binary frames
+void gcode_binary_start(void);
+
+#endif /* GCODE_BINARY */
+
+#endif  /* _GCODE_BINARY_H */
@@ -2,9 +2,14 @@
 
 /** \file
   \brief Parse received G-Codes
+
+  Which words exist, how their values are scaled and where they're stored
+  is all in words[], so handling a letter is a single table lookup, no matter
+  how many words there are.
 */
 
 #include <string.h>
+#include <stddef.h>
 
 #include "serial.h"
 #include "sermsg.h"
@@ -12,7 +17,9 @@
 #include "debug.h"
 #include "sersendf.h"
 
-#include "gcode_process.h"
+#include "gcode_queue.h"
+#include "gcode_binary.h"
+#include "dda_maths.h"
 
 /// current or previous gcode word
 /// for working out what to do with data just received
@@ -24,26 +31,52 @@ decfloat read_digit  __attribute__ ((__section__ (".bss")));
 /// this is where we store all the data for the current command before we work out what to do with it
 GCODE_COMMAND next_target __attribute__ ((__section__ (".bss")));
 
-/*
-  decfloat_to_int() is the weakest subject to variable overflow. For evaluation, we assume a build room of +-1000 mm and STEPS_PER_MM_x between 1.000 and 4096. Accordingly for metric units:
+/// line number of the current line, if it has an N word
+int32_t line_number = 0;
+/// line number the next line should have, hosts usually start with N1
+int32_t line_expected = 1;
+/// set after asking for a resend, until the line asked for arrives
+uint8_t resend_pending = 0;
+
+/// set while no character of the current line has been seen yet
+uint8_t line_start = 1;
+/// set while no word of the current line has been seen yet
+uint8_t line_blank = 1;
+
+/// \ref next_target target as before the current command, to drop it again
+TARGET target_backup __attribute__ ((__section__ (".bss")));
 
-    df->mantissa:  +-0..1048075    (20 bit - 500 for rounding)
-    df->exponent:  0, 2, 3, 4 or 5 (10 bit)
-    multiplicand:  1000            (10 bit)
+#ifdef INVERSE_TIME
+/// F in mm/min as of G93, for G94 to go back to
+static uint32_t feedrate;
+/// F of the current line as read, to scale it again for G93 or G94 after it
+static decfloat feed_digit;
+/// G93 or G94 in effect before the current command, to drop it again
+static uint8_t inverse_backup;
+#endif
+
+#ifdef CANNED_CYCLES
+/// Z where the canned cycle in effect started, as programmed
+static int32_t cycle_initial;
+/// R plane of the canned cycle in effect, as programmed
+static int32_t cycle_r;
+#endif
 
-  imperial units:
+/// checksum sent with the current line, after the '*'
+uint16_t checksum_read = 0;
+/// XOR of all characters of the current line before the '*'
+uint8_t checksum_calculated = 0;
 
-    df->mantissa:  +-0..32267      (15 bit - 500 for rounding)
-    df->exponent:  0, 2, 3, 4 or 5 (10 bit)
-    multiplicand:  25400           (15 bit)
+/*
+  Digits are added to the mantissa as long as it doesn't overflow, up to
+  DECFLOAT_EXP_MAX of them after the decimal point. Too many digits before
+  the point saturate the mantissa, and decfloat_to_int() saturates its
+  result, so a value out of range is as large as possible, but never wraps
+  around to a small or negative one.
 */
-// decfloat_to_int() can handle a bit more:
 #define DECFLOAT_EXP_MAX 3 // more is pointless, as 1 um is our presision
-// (2^^32 - 1) / multiplicand - powers[DECFLOAT_EXP_MAX] / 2 =
-// 4294967295 / 1000 - 5000 =
-#define DECFLOAT_MANT_MM_MAX 4289967 // = 4290 mm
-// 4294967295 / 25400 - 5000 =
-#define DECFLOAT_MANT_IN_MAX 164093 // = 164 inches = 4160 mm
+// (2^^32 - 1) / 10, so another digit fits
+#define DECFLOAT_MANT_MAX 429496729
 
 /*
   utility functions
@@ -54,10 +87,9 @@ extern const uint32_t powers[];  // defined in sermsg.c
 /// \param *df pointer to floating point structure that holds fp value to convert
 /// \param multiplicand multiply by this amount during conversion to integer
 ///
-/// Tested for up to 42'000 mm (accurate), 420'000 mm (precision 10 um) and
-/// 4'200'000 mm (precision 100 um).
+/// Values which don't fit into an int32_t saturate.
 static int32_t decfloat_to_int(decfloat *df, uint16_t multiplicand) {
-  uint32_t r = df->mantissa;
+  uint32_t hi, lo, r = df->mantissa;
   uint8_t e = df->exponent;
 
   // e=1 means we've seen a decimal point but no digits after it, and e=2 means we've seen a decimal point with one digit so it's too high by one if not zero
@@ -70,22 +102,239 @@ static int32_t decfloat_to_int(decfloat *df, uint16_t multiplicand) {
     e--;
   }
 
-  r *= multiplicand;
-  if (e) r = (r + powers[e] / 2) / powers[e];
+  // 64 bit intermediate, so digits after the point don't overflow
+  hi = mul_wide(r, multiplicand, &lo);
+  if (e) {
+    r = powers[e] / 2;
+    lo += r;
+    if (lo < r)
+      hi++;
+    r = div_wide(hi, lo, powers[e]);
+  }
+  else
+    r = hi ? 0xFFFFFFFFUL : lo;
+  if (r > INT32_MAX)
+    r = INT32_MAX;
 
   return df->sign ? -(int32_t)r : (int32_t)r;
 }
 
+/// scale F and store it into \ref next_target
+static void store_feed(decfloat *df) {
+  int32_t v;
+
+#ifdef INVERSE_TIME
+  // G93, in thousandths, whatever the units, and flagged, so it can't be
+  // taken for mm/min further on
+  if (next_target.option_inverse_time) {
+    v = decfloat_to_int(df, 1000);
+    next_target.target.F = ((v > 0) ? v : 1) | F_INVERSE_TIME;
+    return;
+  }
+#endif
+  // 25.4 mm per inch, in tenths, rounded
+  if (next_target.option_inches)
+    v = (decfloat_to_int(df, 254) / 5 + 1) / 2;
+  else
+    v = decfloat_to_int(df, 1);
+  next_target.target.F = v;
+}
+
+/// how a word's value is scaled and where it's stored, see words[]
+typedef struct {
+  uint8_t type;   ///< WORD_ constant
+  uint8_t offset; ///< of its field in GCODE_COMMAND
+  uint8_t seen;   ///< number of its seen_ flag
+} gcode_word;
+
+#define WORD_NONE   0 ///< unknown, ignored
+#define WORD_CODE   1 ///< G or M, uint8_t, a decimal goes to subcode
+#define WORD_LENGTH 2 ///< int32_t micrometers
+#define WORD_MILLI  3 ///< int32_t thousandths, e.g. degrees or seconds
+#define WORD_FEED   4 ///< uint32_t mm/min
+#define WORD_INT8   5 ///< uint8_t integer
+#define WORD_INT16  6 ///< int16_t integer
+#define WORD_LINE   7 ///< N, the line number
+
+#define WORD(type, field, seen) \
+  { type, offsetof(GCODE_COMMAND, field), seen }
+#define NO_WORD { WORD_NONE, 0, 0 }
+
+/// all words, indexed by letter; bit numbers of seen_ flags as in gcode_parse.h
+static const gcode_word words[26] PROGMEM = {
+  WORD(WORD_MILLI,  A,        18), // A
+  WORD(WORD_MILLI,  B,        19), // B
+  WORD(WORD_MILLI,  C,        20), // C
+  WORD(WORD_INT8,   D,        16), // D
+  NO_WORD,                         // E
+  WORD(WORD_FEED,   target.F,  5), // F
+  WORD(WORD_CODE,   G,         0), // G
+  WORD(WORD_INT8,   H,        17), // H
+  WORD(WORD_LENGTH, I,        10), // I
+  WORD(WORD_LENGTH, J,        11), // J
+  WORD(WORD_LENGTH, K,        12), // K
+  WORD(WORD_INT16,  L,        15), // L
+  WORD(WORD_CODE,   M,         1), // M
+  { WORD_LINE, 0, 9 },             // N
+  NO_WORD,                         // O
+  WORD(WORD_MILLI,  P,         7), // P
+  WORD(WORD_LENGTH, Q,        14), // Q
+  WORD(WORD_LENGTH, R,        13), // R
+  WORD(WORD_INT16,  S,         6), // S
+  WORD(WORD_INT8,   T,         8), // T
+  NO_WORD,                         // U
+  NO_WORD,                         // V
+  NO_WORD,                         // W
+  WORD(WORD_LENGTH, target.X,  2), // X
+  WORD(WORD_LENGTH, target.Y,  3), // Y
+  WORD(WORD_LENGTH, target.Z,  4)  // Z
+};
+
+/// the word being read, a copy of its entry in words[]
+gcode_word field;
+
+/// store the word just read into \ref next_target
+static void store_field(void) {
+  int32_t v;
+  uint8_t *slot = (uint8_t *)&next_target + field.offset;
+
+  switch (field.type) {
+    case WORD_NONE:
+      return;
+    case WORD_CODE: {
+      uint32_t m = read_digit.mantissa;
+      uint8_t e = read_digit.exponent;
+
+      // keep one digit after the point, as subcode
+      next_target.subcode = 0;
+      if (e > 1) {
+        m /= powers[e - 2];
+        next_target.subcode = m % 10;
+        m /= 10;
+      }
+      // an unknown code, rather than a wrapped around known one
+      v = (m > 255) ? 255 : m;
+      break;
+    }
+    case WORD_LENGTH:
+      v = decfloat_to_int(&read_digit,
+                          next_target.option_inches ? 25400 : 1000);
+      break;
+    case WORD_MILLI:
+      v = decfloat_to_int(&read_digit, 1000);
+      break;
+    case WORD_FEED:
+#ifdef INVERSE_TIME
+      feed_digit = read_digit;
+#endif
+      store_feed(&read_digit);
+      v = next_target.target.F;
+      break;
+    case WORD_INT8:
+      v = decfloat_to_int(&read_digit, 1);
+      if (v < 0)
+        v = 0;
+      if (v > 255)
+        v = 255;
+      break;
+    case WORD_INT16:
+      v = decfloat_to_int(&read_digit, 1);
+      if (v < -32767)
+        v = -32767;
+      if (v > 32767)
+        v = 32767;
+      break;
+    default:
+      v = decfloat_to_int(&read_digit, 1);
+  }
+
+  if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
+    serwrite_int32(v);
+
+  switch (field.type) {
+    case WORD_LINE:
+      line_number = v;
+      break;
+    case WORD_CODE:
+#ifdef INVERSE_TIME
+      // Only the last G of a line is left at its end, but G93 comes with G1
+      // on the same line and applies to its F. So it's applied right here,
+      // and an F before it on the line is scaled again.
+      if (slot == &next_target.G && (v == 93 || v == 94)) {
+        gcode_feed_mode(v == 93);
+        if (next_target.seen_F)
+          store_feed(&feed_digit);
+      }
+#endif
+      // fall through
+    case WORD_INT8:
+      *slot = v;
+      break;
+    case WORD_INT16:
+      *(int16_t *)slot = v;
+      break;
+    case WORD_FEED:
+      // stored by store_feed() already
+      break;
+    default:
+      *(int32_t *)slot = v;
+  }
+}
+
+/// check line number and checksum of the line just ended
+/// \return nonzero if the line is good to process
+static uint8_t line_check(void) {
+  if (next_target.seen_checksum) {
+    if (checksum_read != checksum_calculated)
+      return 0;
+  }
+#ifdef REQUIRE_CHECKSUM
+  else
+    return 0;
+#endif
+
+  // M110 sets the line number instead of checking it
+  if (next_target.seen_M && next_target.M == 110)
+    return 1;
+
+  if (next_target.seen_N) {
+    if (line_number != line_expected)
+      return 0;
+  }
+#ifdef REQUIRE_LINENUMBER
+  else
+    return 0;
+#endif
+
+  return 1;
+}
+
 void gcode_init(void) {
+  // options are kept, they're not part of the flags
   next_target.flags = 0;
-  // assume a G1 by default
+  // assume a G1 by default, or another hole of a canned cycle
   next_target.seen_G = 1;
   next_target.G = 1;
+#ifdef CANNED_CYCLES
+  if (next_target.cycle)
+    next_target.G = next_target.cycle;
+#endif
+  next_target.subcode = 0;
 }
 
 /// Character Received - add it to our command
 /// \param c the next character to process
 void gcode_parse_char(uint8_t c) {
+  if (line_start) {
+    gcode_command_begin();
+    line_start = 0;
+  }
+
+  // the checksum covers the line as sent, so do this before anything else;
+  // the '*' itself is taken out again below
+  if (next_target.seen_checksum == 0)
+    checksum_calculated ^= c;
+
   // uppercase
   if (c >= 'a' && c <= 'z') c &= ~32;
 
@@ -93,66 +342,16 @@ void gcode_parse_char(uint8_t c) {
   if (last_field) {
     // check if we're seeing a new field or end of line
     // any character will start a new field, even invalid/unknown ones
-    if ((c >= 'A' && c <= 'Z') || c == 10 || c == 13) {
-      switch (last_field) {
-        case 'G':
-          next_target.G = read_digit.mantissa;
-          if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
-            serwrite_uint8(next_target.G);
-          break;
-        case 'M':
-          next_target.M = read_digit.mantissa;
-          if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
-            serwrite_uint8(next_target.M);
-          break;
-        case 'X':
-          if (next_target.option_inches)
-            next_target.target.X = decfloat_to_int(&read_digit, 25400);
-          else
-            next_target.target.X = decfloat_to_int(&read_digit, 1000);
-          if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
-            serwrite_int32(next_target.target.X);
-          break;
-        case 'Y':
-          if (next_target.option_inches)
-            next_target.target.Y = decfloat_to_int(&read_digit, 25400);
-          else
-            next_target.target.Y = decfloat_to_int(&read_digit, 1000);
-          if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
-            serwrite_int32(next_target.target.Y);
-          break;
-        case 'Z':
-          if (next_target.option_inches)
-            next_target.target.Z = decfloat_to_int(&read_digit, 25400);
-          else
-            next_target.target.Z = decfloat_to_int(&read_digit, 1000);
-          if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
-            serwrite_int32(next_target.target.Z);
-          break;
-        case 'F':
-          // just use raw integer, we need move distance and n_steps to convert it to a useful value, so wait until we have those to convert it
-          if (next_target.option_inches)
-            next_target.target.F = decfloat_to_int(&read_digit, 25400);
-          else
-            next_target.target.F = decfloat_to_int(&read_digit, 1);
-          if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
-            serwrite_uint32(next_target.target.F);
-          break;
-        case 'P':
-          //According to the standard, P is float and in seconds!
-          next_target.P = decfloat_to_int(&read_digit, 1000);
-          if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
-            serwrite_uint16(next_target.P);
-          break;
-        case 'T':
-          next_target.T = read_digit.mantissa;
-          if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
-            serwrite_uint8(next_target.T);
-          break;
-        case 'N':
-          //TODO: evaluate whether we always want to ignore line numbers
-          break;
+    if ((c >= 'A' && c <= 'Z') || c == '*' || c == 10 || c == 13) {
+      if (last_field == '*') {
+        // a checksum out of range never matches
+        checksum_read = (read_digit.mantissa > 255) ? 0xFFFF :
+                        read_digit.mantissa;
+        if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
+          serwrite_uint16(checksum_read);
       }
+      else
+        store_field();
       // reset for next field
       last_field = 0;
       read_digit.sign = read_digit.mantissa = read_digit.exponent = 0;
@@ -164,46 +363,34 @@ void gcode_parse_char(uint8_t c) {
     // new field?
     if ((c >= 'A' && c <= 'Z') || c == '*') {
       last_field = c;
+      line_blank = 0;
       if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
         serial_writechar(c);
     }
 
+    // one table lookup tells how to handle any letter
+    if (c >= 'A' && c <= 'Z') {
+      memcpy_P(&field, &words[c - 'A'], sizeof(gcode_word));
+      if (field.type != WORD_NONE)
+        ((uint8_t *)&next_target.flags)[field.seen >> 3] |=
+          1 << (field.seen & 0x07);
+    }
+
     // process character
     switch (c) {
       // each currently known command is either G or M, so preserve previous G/M unless a new one has appeared
       // FIXME: same for T command
       case 'G':
-        next_target.seen_G = 1;
         next_target.seen_M = 0;
         next_target.M = 0;
         break;
       case 'M':
-        next_target.seen_M = 1;
         next_target.seen_G = 0;
         next_target.G = 0;
         break;
-      case 'X':
-        next_target.seen_X = 1;
-        break;
-      case 'Y':
-        next_target.seen_Y = 1;
-        break;
-      case 'Z':
-        next_target.seen_Z = 1;
-        break;
-      case 'F':
-        next_target.seen_F = 1;
-        break;
-      case 'S':
-        next_target.seen_S = 1;
-        break;
-      case 'P':
-        next_target.seen_P = 1;
-        break;
-      case 'T':
-        next_target.seen_T = 1;
-        break;
-      case 'N':
+      case '*':
+        next_target.seen_checksum = 1;
+        checksum_calculated ^= '*';
         break;
       // comments
       case '(':
@@ -220,31 +407,24 @@ void gcode_parse_char(uint8_t c) {
         if (read_digit.exponent == 0)
           read_digit.exponent = 1;
         break;
-#ifdef DEBUG
-      case '%':
-      case ' ':
-      case '\t':
-      case 10:
-      case 13:
-        // ignore
-        break;
-#endif
       default:
         // can't do ranges in switch..case, so process actual digits here.
         if (c >= '0' && c <= '9') {
           if (read_digit.exponent < DECFLOAT_EXP_MAX + 1 &&
-              ((next_target.option_inches == 0 &&
-              read_digit.mantissa < DECFLOAT_MANT_MM_MAX) ||
-              (next_target.option_inches &&
-              read_digit.mantissa < DECFLOAT_MANT_IN_MAX))) {
+              read_digit.mantissa < DECFLOAT_MANT_MAX) {
             // this is simply mantissa = (mantissa * 10) + atoi(c) in different clothes
             read_digit.mantissa = (read_digit.mantissa << 3) + (read_digit.mantissa << 1) + (c - '0');
             if (read_digit.exponent)
               read_digit.exponent++;
           }
+          else if (read_digit.exponent == 0) {
+            // too many digits before the point, dropping one would make
+            // the value ten times smaller, so saturate instead
+            read_digit.mantissa = 0xFFFFFFFFUL;
+          }
         }
 #ifdef DEBUG
-        else {
+        else if (c != '%' && c != ' ' && c != '\t' && c != 10 && c != 13) {
           // invalid
           serial_writechar('?');
           serial_writechar(c);
@@ -260,16 +440,177 @@ void gcode_parse_char(uint8_t c) {
     if (DEBUG_ECHO && (debug_flags & DEBUG_ECHO))
       serial_writechar(c);
 
-    // process
-    serial_writestr_P(PSTR("ok "));
-    process_gcode_command();
-    serial_writechar('\n');
+    // Blank lines, comments and the LF after a CR have neither line number
+    // nor checksum, there's nothing to check. They don't end a resend either.
+    if (line_blank)
+      gcode_command_done();
+    else if (line_check()) {
+      if (next_target.seen_N)
+        line_expected = line_number + 1;
+      resend_pending = 0;
 
-    // reset variables
-    gcode_init(); // last_field and read_digit are reset above already
-    
-    if (next_target.option_all_relative) {
-      next_target.target.X = next_target.target.Y = next_target.target.Z = 0;
+      gcode_command_done();
     }
+    else {
+      // Drop the line and ask for a resend. Lines following a bad one are
+      // dropped as well, but asked for only once, else a streaming host
+      // would see a resend request for each line it had sent meanwhile.
+      if ( ! resend_pending ||
+          (next_target.seen_N && line_number == line_expected))
+        sersendf_P(PSTR("rs N%ld\n"), line_expected);
+      resend_pending = 1;
+      // every line gets its "ok", a host counting characters relies on it
+      serial_writestr_P(PSTR("ok\n"));
+      gcode_command_drop();
+    }
+
+    // reset variables, last_field and read_digit are reset above already
+    checksum_calculated = 0;
+    line_start = 1;
+    line_blank = 1;
   }
 }
+
+/// start a new command in \ref next_target
+///
+/// Words are written to next_target as they come in, so remember what's
+/// needed to drop the command again.
+void gcode_command_begin() {
+  memcpy(&target_backup, &next_target.target, sizeof(TARGET));
+#ifdef INVERSE_TIME
+  inverse_backup = next_target.option_inverse_time;
+#endif
+}
+
+/// the command in \ref next_target is complete, queue it for processing
+void gcode_command_done() {
+  uint8_t sync = 0;
+
+  // Units, positioning mode and the canned cycle in effect affect how the
+  // following lines are parsed, so these can't wait in the queue until
+  // process_gcode_command() gets to them. Homing, setting position and
+  // changing offsets write to next_target, so parsing has to wait for
+  // them instead.
+  if (next_target.seen_G) {
+    switch (next_target.G) {
+      case 20:
+        next_target.option_inches = 1;
+        break;
+      case 21:
+        next_target.option_inches = 0;
+        break;
+      case 90:
+        next_target.option_all_relative = 0;
+        break;
+      case 91:
+        next_target.option_all_relative = 1;
+        break;
+      case 98:
+        next_target.option_retract_r = 0;
+        break;
+      case 99:
+        next_target.option_retract_r = 1;
+        break;
+#ifdef CANNED_CYCLES
+      // canned cycles are modal, like G0 to G3 in RS274NGC
+      case 73:
+      case 81:
+      case 82:
+      case 83:
+        if ( ! next_target.cycle)
+          cycle_initial = target_backup.Z;
+        next_target.cycle = next_target.G;
+        // Z is the bottom of the hole, but the line ends where the cycle
+        // retracts to, which is where the lines after it start from
+        next_target.cycle_z = next_target.target.Z;
+        if (next_target.seen_R)
+          cycle_r = next_target.R;
+        if ( ! next_target.option_all_relative &&
+            (next_target.seen_X || next_target.seen_Y ||
+             next_target.seen_Z || next_target.seen_R))
+          next_target.target.Z =
+            (next_target.option_retract_r || cycle_initial < cycle_r) ?
+            cycle_r : cycle_initial;
+        break;
+      case 0:
+      case 1:
+      case 2:
+      case 3:
+      case 80:
+        next_target.cycle = 0;
+        break;
+#endif
+      case 10:
+      case 28:
+      case 30:
+      case 43:
+      case 44:
+      case 49:
+      case 52:
+      case 53:
+      case 54:
+      case 55:
+      case 56:
+      case 57:
+      case 58:
+      case 59:
+      case 92:
+        sync = 1;
+        break;
+    }
+  }
+#if defined TOOL_TABLE && defined TOOL_CHANGE_Z
+  // so does a tool change, it moves the machine
+  if (next_target.seen_M && next_target.M == 6)
+    sync = 1;
+#endif
+#ifdef GCODE_BINARY
+  // so does the protocol
+  if (next_target.seen_M && next_target.M == 252) {
+    binary_mode = ! (next_target.seen_S && next_target.S == 0);
+    if (binary_mode)
+      gcode_binary_start();
+  }
+#endif
+
+  // queue for processing, see main loop
+  gcode_enqueue(sync);
+
+#ifdef STREAMING
+  // the line has left the RX buffer, so the host may send as many
+  // characters again; replies come later, see gcode_dequeue()
+  serial_writestr_P(PSTR("ok\n"));
+#endif
+
+  gcode_init();
+
+  if (next_target.option_all_relative) {
+    next_target.target.X = next_target.target.Y = next_target.target.Z = 0;
+  }
+}
+
+/// the command in \ref next_target is bad, forget it
+void gcode_command_drop() {
+  memcpy(&next_target.target, &target_backup, sizeof(TARGET));
+#ifdef INVERSE_TIME
+  next_target.option_inverse_time = inverse_backup;
+#endif
+  gcode_init();
+}
+
+#ifdef INVERSE_TIME
+/// G93 or G94, F means something else from now on
+///
+/// Called as soon as the G word is read, see store_field(). The feedrate in
+/// mm/min is kept for G94 to go back to.
+void gcode_feed_mode(uint8_t inverse) {
+  if (inverse == next_target.option_inverse_time)
+    return;
+
+  if (inverse)
+    feedrate = next_target.seen_F ? target_backup.F : next_target.target.F;
+  else
+    next_target.target.F = feedrate;
+  next_target.option_inverse_time = inverse;
+}
+#endif
@@ -15,9 +15,14 @@ typedef struct {
 } decfloat;
 
 /// this holds all the possible data from a received command
+///
+/// Lengths are in micrometers, angles in 1/1000 degrees and times in
+/// milliseconds, see words[] in gcode_parse.c for the scaling of each word.
 typedef struct {
   union {
     struct {
+      // the first eighteen match the mask bits of binary frames,
+      // see gcode_binary.c
       uint8_t seen_G:1;
       uint8_t seen_M:1;
       uint8_t seen_X:1;
@@ -28,18 +33,49 @@ typedef struct {
       uint8_t seen_P:1;
       uint8_t seen_T:1;
       uint8_t seen_N:1;
+      uint8_t seen_I:1;
+      uint8_t seen_J:1;
+      uint8_t seen_K:1;
+      uint8_t seen_R:1;
+      uint8_t seen_Q:1;
+      uint8_t seen_L:1;
+      uint8_t seen_D:1;
+      uint8_t seen_H:1;
+      uint8_t seen_A:1;
+      uint8_t seen_B:1;
+      uint8_t seen_C:1;
+      uint8_t seen_checksum:1; ///< seen a '*', the rest of the line is the checksum
       uint8_t seen_parens_comment:1; ///< seen an open parenthesis
-      uint8_t option_all_relative:1; ///< relative or absolute coordinates?
-      uint8_t option_inches:1; ///< inches or millimeters?
     };
-    uint16_t flags;
+    uint32_t flags;
   };
+  // modal, kept from line to line
+  uint8_t option_all_relative:1; ///< relative or absolute coordinates?
+  uint8_t option_inches:1; ///< inches or millimeters?
+  uint8_t option_inverse_time:1; ///< F as 1 / minutes (G93) or mm/min (G94)?
+  uint8_t option_retract_r:1; ///< canned cycles retract to R (G99) or to where they started (G98)?
+#ifdef CANNED_CYCLES
+  uint8_t cycle; ///< canned cycle in effect, G to assume for lines without one
+  int32_t cycle_z; ///< Z word of a canned cycle line, the bottom of the hole
+#endif
   uint8_t G; ///< G command number
   uint8_t M; ///< M command number
+  uint8_t subcode; ///< the digit after the point of G or M, e.g. 1 for G5.1
   TARGET target; ///< target position: X, Y, Z, E and F
   int16_t S; ///< S word (various uses)
-  uint16_t P; ///< P word (various uses)
+  int32_t P; ///< P word (various uses), in thousandths, e.g. milliseconds for seconds
   uint8_t T; ///< T word (tool index)
+  int32_t I; ///< I word, arc center X offset
+  int32_t J; ///< J word, arc center Y offset
+  int32_t K; ///< K word, arc center Z offset
+  int32_t R; ///< R word, arc radius or retract plane
+  int32_t Q; ///< Q word, peck depth
+  uint16_t L; ///< L word, repeat count or G10 mode
+  uint8_t D; ///< D word, tool radius index
+  uint8_t H; ///< H word, tool length index
+  int32_t A; ///< A axis
+  int32_t B; ///< B axis
+  int32_t C; ///< C axis
 } GCODE_COMMAND;
 
 /// the command being processed
@@ -50,4 +86,14 @@ void gcode_init(void);
 /// accept the next character and process it
 void gcode_parse_char(uint8_t c);
 
+// the parsers' side of next_target: start a command, queue it or drop it
+void gcode_command_begin(void);
+void gcode_command_done(void);
+void gcode_command_drop(void);
+
+#ifdef INVERSE_TIME
+// G93 or G94, right when the G word arrives
+void gcode_feed_mode(uint8_t inverse);
+#endif
+
 #endif  /* _GCODE_PARSE_H */
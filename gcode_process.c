@@ -11,6 +11,7 @@
 
 #include "dda.h"
 #include "dda_queue.h"
+#include "dda_maths.h"
 #include "watchdog.h"
 #include "delay.h"
 #include "serial.h"
@@ -22,6 +23,14 @@
 #include "clock.h"
 #include "config.h"
 #include "home.h"
+#include "profile.h"
+#include "arc.h"
+#include "spline.h"
+#include "tool.h"
+#include "coord.h"
+#include "transform.h"
+#include "cycle.h"
+#include "comp.h"
 
 /// the current tool
 uint8_t tool;
@@ -31,51 +40,109 @@ uint8_t next_tool;
 
 /************************************************************************/
 /**
-  \brief Processes command stored in global \ref next_target.
+  \brief Processes a command taken from the command queue.
+  \param *cmd the command to process, a copy of what was in \ref next_target
+  when its line ended.
   This is where we work out what to actually do with each command we
   receive. All data has already been scaled to integers in gcode_process.
   If you want to add support for a new G or M code, this is the place.
 */
 /*************************************************************************/
 
-void process_gcode_command() {
-  uint32_t backup_f;
+void process_gcode_command(GCODE_COMMAND *cmd) {
+  // G10, G51, G52 and G68 take their numbers as they are
+  if ( ! (cmd->seen_G && (cmd->G == 10 || cmd->G == 51 || cmd->G == 52 ||
+                          cmd->G == 68))) {
+    if (cmd->seen_G && cmd->G == 53) {
+      // machine coordinates, axes left out stay where they are
+      if ( ! cmd->seen_X)
+        cmd->target.X = startpoint.X;
+      if ( ! cmd->seen_Y)
+        cmd->target.Y = startpoint.Y;
+      if ( ! cmd->seen_Z)
+        cmd->target.Z = startpoint.Z;
+    }
+    // convert relative to absolute
+    else if (cmd->option_all_relative) {
+      TARGET *origin = &startpoint;
+
+#ifdef CUTTER_COMP
+      // the tool is off the programmed path
+      if (comp_engaged)
+        origin = &comp_target;
+#endif
+#ifdef TRANSFORM
+      if (transform_active)
+        transform_vector(&cmd->target.X, &cmd->target.Y);
+#endif
+      cmd->target.X += origin->X;
+      cmd->target.Y += origin->Y;
+      cmd->target.Z += origin->Z;
+    }
+    // work, local and tool length offsets
+    else {
+#ifdef TRANSFORM
+      if (transform_active)
+        transform_point(&cmd->target.X, &cmd->target.Y);
+#endif
+      cmd->target.X += coord_offset.X;
+      cmd->target.Y += coord_offset.Y;
+      cmd->target.Z += coord_offset.Z;
+    }
 
-  // convert relative to absolute
-  if (next_target.option_all_relative) {
-    next_target.target.X += startpoint.X;
-    next_target.target.Y += startpoint.Y;
-    next_target.target.Z += startpoint.Z;
+    // implement axis limits
+    #ifdef X_MIN
+      if (cmd->target.X < (int32_t)(X_MIN * 1000.))
+        cmd->target.X = (int32_t)(X_MIN * 1000.);
+    #endif
+    #ifdef Y_MIN
+      if (cmd->target.Y < (int32_t)(Y_MIN * 1000.))
+        cmd->target.Y = (int32_t)(Y_MIN * 1000.);
+    #endif
+    #ifdef Z_MIN
+      if (cmd->target.Z < (int32_t)(Z_MIN * 1000.))
+        cmd->target.Z = (int32_t)(Z_MIN * 1000.);
+    #endif
   }
 
-  // implement axis limits
-  #ifdef X_MIN
-    if (next_target.target.X < X_MIN * 1000.)
-      next_target.target.X = X_MIN * 1000.;
-  #endif
-  #ifdef Y_MIN
-    if (next_target.target.Y < Y_MIN * 1000.)
-      next_target.target.Y = Y_MIN * 1000.;
-  #endif
-  #ifdef Z_MIN
-    if (next_target.target.Z < Z_MIN * 1000.)
-      next_target.target.Z = Z_MIN * 1000.;
-  #endif
+#ifdef CUTTER_COMP
+  // a move held back for compensation goes before anything else happens
+  if (comp_side && ! (cmd->seen_G && (cmd->G == 0 || cmd->G == 1)))
+    comp_flush();
+#endif
+
+#ifdef CANNED_CYCLES
+  // other motion ends a canned cycle
+  if (cmd->seen_G && cmd->G <= 3)
+    cycle_stop();
+#endif
+
+#ifdef SPLINE_TOLERANCE
+  // Only a G5 right after another one continues smoothly, any other move
+  // in between breaks that. Blank lines are a G1 without axes, no move.
+  if (cmd->seen_G &&
+      (cmd->G == 2 || cmd->G == 3 || cmd->G == 28 || cmd->G == 30 ||
+       ((cmd->G <= 1 || cmd->G == 73 || (cmd->G >= 81 && cmd->G <= 83)) &&
+        (cmd->seen_X || cmd->seen_Y || cmd->seen_Z))))
+    spline_break();
+  if (cmd->seen_M && cmd->M == 6)
+    spline_break();
+#endif
 
   // The GCode documentation was taken from http://reprap.org/wiki/Gcode .
-  if (next_target.seen_T) {
+  if (cmd->seen_T) {
       //? --- T: Select Tool ---
       //?
       //? Example: T1
       //?
       //? Select extruder number 1 to build with.  Extruder numbering starts at 0.
-      next_tool = next_target.T;
+      next_tool = cmd->T;
   }
 
-  if (next_target.seen_G) {
+  if (cmd->seen_G) {
     uint8_t axisSelected = 0;
 
-    switch (next_target.G) {
+    switch (cmd->G) {
       case 0:
         //? G0: Rapid Linear Motion
         //?
@@ -83,10 +150,14 @@ void process_gcode_command() {
         //?
         //? In this case move rapidly to X = 12 mm.  In fact, the RepRap firmware uses exactly the same code for rapid as it uses for controlled moves (see G1 below), as - for the RepRap machine - this is just as efficient as not doing so.  (The distinction comes from some old machine tools that used to move faster if the axes were not driven in a straight line.  For them G0 allowed any movement in space to get to the destination as fast as possible.)
         //TODO: evaluate whether we want to have actual hardware G00 or stick with the interpolated rapids proposal.
-        backup_f = next_target.target.F;
-        next_target.target.F = MAXIMUM_FEEDRATE_X * 2L;
-        enqueue(&next_target.target);
-        next_target.target.F = backup_f;
+        // cmd is a copy, so the parser's F stays as it was for the next line
+        cmd->target.F = MAXIMUM_FEEDRATE_X * 2L;
+#ifdef CUTTER_COMP
+        if (comp_engaged)
+          comp_move(&cmd->target);
+        else
+#endif
+        enqueue(&cmd->target);
         break;
 
       case 1:
@@ -96,13 +167,75 @@ void process_gcode_command() {
         //?
         //? Go in a straight line from the current (X, Y) point to the point (90.6, 13.8), extruding material as the move happens from the current extruded length to a length of 22.4 mm.
         //?
-        enqueue(&next_target.target);
+#ifdef INVERSE_TIME
+        // in G93 each move has its own time, there's none to carry over
+        if (cmd->option_inverse_time && ! cmd->seen_F &&
+            (cmd->seen_X || cmd->seen_Y || cmd->seen_Z)) {
+          sersendf_P(PSTR("E: F missing in G93"));
+          break;
+        }
+#endif
+#ifdef CUTTER_COMP
+        if (comp_engaged) {
+  #ifdef INVERSE_TIME
+          // G93 after G41/G42, moves change length around corners
+          if (cmd->option_inverse_time)
+            sersendf_P(PSTR("E: Not with G93"));
+          else
+  #endif
+          comp_move(&cmd->target);
+        }
+        else
+#endif
+        enqueue(&cmd->target);
         break;
 
       case 2:
       case 3:
-        //? --- G3: Arc feed
-        //TODO: add
+        //? --- G2, G3: Arc Motion at Feed Rate ---
+        //?
+        //? Example: G2 X10 Y0 I5 J0
+        //?
+        //? Go clockwise (G2) or counterclockwise (G3) along an arc from the current point to (10, 0), around the center at the offset given by I, J and K from the current point, here (5, 0). Offsets are always relative and only those of the plane selected with G17-G19 count. Instead of the center, the radius can be given with R, like <tt>G3 X10 Y0 R5</tt>; a negative radius takes the longer of the two possible arcs. Coordinates on the third axis make a helix. Ending at the current point makes a full circle, with I, J or K only.
+        //?
+        //? The arc is cut into straight moves deviating no more than ARC_TOLERANCE from it, which are queued as the queue has room. With ARC_NATIVE, G17 arcs without helical motion are instead stepped along the circle as a single move.
+        //?
+        //? This command is only available with ARC_TOLERANCE defined, and not with cutter compensation on. With G68, G51, M21 or M22 on, only G17 arcs are possible.
+#ifdef ARC_TOLERANCE
+  #ifdef CUTTER_COMP
+        if (comp_side) {
+          sersendf_P(PSTR("E: Not with G41/G42"));
+          break;
+        }
+  #endif
+  #ifdef INVERSE_TIME
+        if (cmd->option_inverse_time && ! cmd->seen_F) {
+          sersendf_P(PSTR("E: F missing in G93"));
+          break;
+        }
+  #endif
+        // offsets left out are zero, not those of an earlier line
+        if ( ! cmd->seen_I)
+          cmd->I = 0;
+        if ( ! cmd->seen_J)
+          cmd->J = 0;
+        if ( ! cmd->seen_K)
+          cmd->K = 0;
+  #ifdef TRANSFORM
+        if (transform_active) {
+          if (arc_plane != ARC_PLANE_XY) {
+            sersendf_P(PSTR("E: Not with G18/G19"));
+            break;
+          }
+          transform_vector(&cmd->I, &cmd->J);
+          cmd->R = transform_length(cmd->R);
+          // mirrored, clockwise becomes counterclockwise
+          arc_start(cmd, (cmd->G == 3) != transform_mirrored);
+          break;
+        }
+  #endif
+        arc_start(cmd, cmd->G == 3);
+#endif
         break;
 
       case 4:
@@ -112,20 +245,50 @@ void process_gcode_command() {
         //?
         //? In this case sit still doing nothing for 200 milliseconds.  During delays the state of the machine (for example the temperatures of its extruders) will still be preserved and controlled.
         //?
-        queue_wait();
-        // delay
-        if (next_target.seen_P) {
-          for (;next_target.P > 0;next_target.P--) {
-            ifclock(clock_flag_10ms) {
-              clock_10ms();
-            }
-            delay_ms(1);
-          }
-        }
+        //? The dwell is queued like a move. It starts when the moves before it have come to a stop and holds back the ones after it, while further commands are read and queued meanwhile.
+        //?
+        if (cmd->seen_P && cmd->P > 0)
+          enqueue_dwell(cmd->P);
         break;
       
       case 5:
-        //? --- G05.1: Quadratic B-Spline feed; G05.2-3: NURBs feed
+        //? --- G5, G5.1: Spline Motion at Feed Rate ---
+        //?
+        //? Example: G5 X20 Y0 I5 J10 P-5 Q10
+        //?
+        //? Go along a cubic Bézier curve from the current point to (20, 0). I and J give the first control point relative to the current point, here (5, 10), P and Q the second one relative to the end, here (15, 10). A G5 right after another G5 can leave out I and J to continue smoothly, mirroring the previous second control point. Splines are always in the XY plane, Z moves linearly along.
+        //?
+        //? Example: G5.1 X20 Y0 I10 J10
+        //?
+        //? Same for a quadratic curve, with I and J for its only control point.
+        //?
+        //? The curve is cut into straight moves deviating no more than SPLINE_TOLERANCE from it, shorter where it bends more, which are queued as the queue has room.
+        //?
+        //? This command is only available with SPLINE_TOLERANCE defined, and not with cutter compensation, G68, G51, M21 or M22 on. G5.2 and G5.3, NURBS, aren't supported.
+#ifdef SPLINE_TOLERANCE
+  #ifdef CUTTER_COMP
+        if (comp_side) {
+          sersendf_P(PSTR("E: Not with G41/G42"));
+          break;
+        }
+  #endif
+  #ifdef TRANSFORM
+        if (transform_active) {
+          sersendf_P(PSTR("E: Not with G68/G51"));
+          break;
+        }
+  #endif
+  #ifdef INVERSE_TIME
+        if (cmd->option_inverse_time) {
+          sersendf_P(PSTR("E: Not with G93"));
+          break;
+        }
+  #endif
+        if (cmd->subcode <= 1)
+          spline_start(cmd, cmd->subcode == 1);
+#endif
+        break;
+
       case 6:
         //? --- G06: Arbitrary B-Spline feed
       case 7:
@@ -142,8 +305,38 @@ void process_gcode_command() {
         break;
         
       case 10:
-        //? --- G10: Data input
-        //TODO: if going for the large-memory configuration, implement this along with parameters and tool table
+        //? --- G10: Data input ---
+        //?
+        //? Example: G10 L1 P3 R2.5 Z42.1
+        //?
+        //? Set radius and length of tool 3 in the tool table, 2.5 mm and 42.1 mm here, for cutter compensation with G41 and G42 and for tool length offsets with G43 and G44. Either R or Z can be left out to keep what's there. Tools are numbered from 1 to TOOL_TABLE, the table is kept in EEPROM.
+        //?
+        //? This command is only available with TOOL_TABLE defined.
+        //?
+        //? Example: G10 L2 P1 X100 Y50
+        //?
+        //? Set the work offset of G54, i.e. where its origin is in machine coordinates, here at X = 100 mm and Y = 50 mm, Z stays as it was. P1 to P6 are G54 to G59, P0 is the coordinate system in use. With L20 instead of L2, the offset is set so the machine is at the given coordinates now. Work offsets are kept in EEPROM.
+        //?
+        //? This command is only available with WORK_OFFSETS defined.
+        //TODO: other L words, along with parameters
+#ifdef WORK_OFFSETS
+        if (cmd->seen_L && (cmd->L == 2 || cmd->L == 20)) {
+          // P is read in thousandths
+          if ( ! coord_set_work(cmd->seen_P ? (cmd->P + 500) / 1000 : 0, cmd,
+                                cmd->L == 20))
+            sersendf_P(PSTR("E: Bad coordinate system"));
+        }
+#endif
+#ifdef TOOL_TABLE
+        if (cmd->seen_L && cmd->L == 1 && cmd->seen_P) {
+          // P is read in thousandths
+          uint8_t t = (cmd->P + 500) / 1000;
+
+          if ( ! tool_set(t, cmd->seen_Z ? cmd->target.Z : tool_length(t),
+                          cmd->seen_R ? cmd->R : tool_radius(t)))
+            sersendf_P(PSTR("E: Bad tool"));
+        }
+#endif
         break;
       
       case 12:
@@ -159,10 +352,52 @@ void process_gcode_command() {
         break;
       
       case 17:
+        //? --- G17: Select XY Plane ---
+        //?
+        //? Example: G17
+        //?
+        //? Arcs from now on are in the XY plane, with Z for helices. This is the default.
+#ifdef ARC_TOLERANCE
+        arc_plane = ARC_PLANE_XY;
+#endif
+        break;
+
       case 18:
+        //? --- G18: Select ZX Plane ---
+        //?
+        //? Example: G18
+        //?
+        //? Arcs from now on are in the ZX plane, with Y for helices.
+        //?
+        //? Not allowed with cutter compensation on, which works in the XY plane only.
+#ifdef ARC_TOLERANCE
+  #ifdef CUTTER_COMP
+        if (comp_side) {
+          sersendf_P(PSTR("E: Not with G41/G42"));
+          break;
+        }
+  #endif
+        arc_plane = ARC_PLANE_ZX;
+#endif
+        break;
+
       case 19:
-        //? --- G17-19: Plane selection
-        //TODO: implement when adding arc feed
+        //? --- G19: Select YZ Plane ---
+        //?
+        //? Example: G19
+        //?
+        //? Arcs from now on are in the YZ plane, with X for helices.
+        //?
+        //? Not allowed with cutter compensation on, which works in the XY plane only.
+#ifdef ARC_TOLERANCE
+  #ifdef CUTTER_COMP
+        if (comp_side) {
+          sersendf_P(PSTR("E: Not with G41/G42"));
+          break;
+        }
+  #endif
+        arc_plane = ARC_PLANE_YZ;
+#endif
         break;
 
       case 20:
@@ -172,7 +407,9 @@ void process_gcode_command() {
         //?
         //? Units from now on are in inches.
         //?
-        next_target.option_inches = 1;
+
+        // Lines queued after this one depend on it, so it's applied in
+        // gcode_parse_char() already.
         break;
 
       case 21:
@@ -182,7 +419,8 @@ void process_gcode_command() {
         //?
         //? Units from now on are in millimeters.  (This is the RepRap default.)
         //?
-        next_target.option_inches = 0;
+
+        // Applied in gcode_parse_char() already, see G20.
         break;
 
       case 30:
@@ -191,7 +429,7 @@ void process_gcode_command() {
         //? 
         //TODO: align to standard: G30 is "goto zero" (which should be a machine preset) via waypoint
         //TODO: add support for G30.1
-        enqueue(&next_target.target);
+        enqueue(&cmd->target);
         // no break here, G30 is move and then go home
 
       case 28:
@@ -213,19 +451,19 @@ void process_gcode_command() {
         queue_wait();
 
         //TODO: this "recalibrate only axis 'a'" is nonstandard and must die!
-        if (next_target.seen_X) {
+        if (cmd->seen_X) {
           #if defined  X_MIN_PIN
             home_x_negative();
           #endif
           axisSelected = 1;
         }
-        if (next_target.seen_Y) {
+        if (cmd->seen_Y) {
           #if defined  Y_MIN_PIN
             home_y_negative();
           #endif
           axisSelected = 1;
         }
-        if (next_target.seen_Z) {
+        if (cmd->seen_Z) {
           #if defined Z_MAX_PIN
             home_z_positive();
           #endif
@@ -233,6 +471,9 @@ void process_gcode_command() {
         }
 
         if (!axisSelected) home();
+
+        // homing set next_target to machine coordinates
+        coord_update();
         break;
 
       case 31:
@@ -243,46 +484,217 @@ void process_gcode_command() {
         break;
       
       case 40:
+        //? --- G40: Cutter Compensation Off ---
+        //?
+        //? Example: G40
+        //?
+        //? The next move goes from the offset path back to the programmed one, see G41.
+        //?
+        //? This command is only available with CUTTER_COMP defined.
+#ifdef CUTTER_COMP
+        comp_stop();
+#endif
+        break;
+
       case 41:
       case 42:
-        //? --- G40-42: Tool diameter compensation control
-        //TODO: mandatory for CNC machining, implement
+        //? --- G41, G42: Cutter Compensation Left, Right ---
+        //?
+        //? Example: G41 D3
+        //?
+        //? Offset moves by the radius of tool 3 from the tool table, to the left (G41) or right (G42) of the programmed path, so the edge of the tool follows it. Without D, the radius of the current tool is used. The next move goes onto the offset path, corners on the inside are cut short where the offset paths cross, those on the outside get an arc around them.
+        //?
+        //? Only G0 and G1 are compensated, in the XY plane; arcs and splines aren't allowed with compensation on. Each move is held back until the next one shows how the corner between them goes.
+        //?
+        //? This command is only available with CUTTER_COMP defined.
+#ifdef CUTTER_COMP
+  #ifdef ARC_TOLERANCE
+        if (arc_plane != ARC_PLANE_XY) {
+          sersendf_P(PSTR("E: Not with G18/G19"));
+          break;
+        }
+  #endif
+  #ifdef INVERSE_TIME
+        if (cmd->option_inverse_time) {
+          sersendf_P(PSTR("E: Not with G93"));
+          break;
+        }
+  #endif
+        {
+          int8_t side = (cmd->G == 41) ? COMP_LEFT : COMP_RIGHT;
+
+  #ifdef TRANSFORM
+          // the path is mirrored, so is the side the tool goes to
+          if (transform_mirrored)
+            side = -side;
+  #endif
+          comp_start(side, tool_radius(cmd->seen_D ? cmd->D : tool));
+        }
+#endif
         break;
       
       case 43:
       case 44:
       case 49:
-        //? --- G43-49: Tool height compensation control
-        //TODO: mandatory for CNC machining, implement
+        //? --- G43, G44, G49: Tool length offset ---
+        //?
+        //? Example: G43 H3
+        //?
+        //? Add the length of tool 3 from the tool table, see G10, to Z of all moves from now on, so Z is where the tip of the tool goes. G44 subtracts it instead, G49 cancels the offset. Without H, the length of the current tool is used. The offset applies from the next move on, axes left out of it stay where they are.
+        //?
+        //? This command is only available with TOOL_TABLE defined.
+#ifdef TOOL_TABLE
+        if (cmd->G == 49)
+          tool_length_offset = 0;
+        else {
+          tool_length_offset = tool_length(cmd->seen_H ? cmd->H : tool);
+          if (cmd->G == 44)
+            tool_length_offset = -tool_length_offset;
+        }
+        coord_update();
+#endif
         break;
       
       case 50:
       case 51:
-        //? --- G50-51: Scaling control
-        //TODO: implement, could come in very handy
+        //? --- G50, G51: Scaling ---
+        //?
+        //? Example: G51 X10 Y10 P2
+        //?
+        //? Scale X and Y of all moves from now on by P, here to twice their size, about the center given by X and Y, here (10, 10). Left out, X and Y of the center are zero. Arcs and relative moves scale along, Z doesn't. G50 turns scaling off.
+        //?
+        //? This command is only available with TRANSFORM defined. The next move should give both X and Y, as axes left out stay where they are in untransformed coordinates.
+#ifdef TRANSFORM
+        if (cmd->G == 50)
+          transform_scale(0, 0, 1000);
+        // P is read in thousandths
+        else if ( ! cmd->seen_P || ! transform_scale(
+                   cmd->seen_X ? cmd->target.X : 0,
+                   cmd->seen_Y ? cmd->target.Y : 0, cmd->P))
+          sersendf_P(PSTR("E: Bad scale"));
+#endif
         break;
         
       case 52:
+        //? --- G52: Local offset ---
+        //?
+        //? Example: G52 X10 Y10
+        //?
+        //? Shift the origin by X and Y, on top of the work offset of G54 to G59. Axes left out keep their local offset, G52 X0 Y0 Z0 clears it. Unlike work offsets, the local offset is lost on reset.
+        //?
+        //? This command is only available with WORK_OFFSETS defined.
+#ifdef WORK_OFFSETS
+        coord_set_local(cmd);
+#endif
+        break;
+
       case 53:
+        //? --- G53: Move in machine coordinates ---
+        //?
+        //? Example: G53 Z0
+        //?
+        //? Move to the given machine coordinates at the current feedrate, ignoring all offsets, and in absolute coordinates even with G91. Axes left out stay where they are. This is for this line only, so it can't be combined with G0 or G1.
+#ifdef CUTTER_COMP
+        if (comp_side) {
+          sersendf_P(PSTR("E: Not with G41/G42"));
+          break;
+        }
+#endif
+        enqueue(&cmd->target);
+        coord_update();
+        break;
+
       case 54:
       case 55:
       case 56:
       case 57:
       case 58:
       case 59:
-        //? --- G52-59: Coordinate system selection (local/machine/work)
-        //TODO: link G52 to G92
-        //TODO: link G53 to G90-91
-        //TODO: if going for the large-memory configuration, implement G54-59 along with parameters and tool table
+        //? --- G54-59: Select work coordinate system ---
+        //?
+        //? Example: G55
+        //?
+        //? Use the work offset of the second coordinate system from now on, see G10 L2. G54 is in use after a reset. Axes left out of the next move stay where they are.
+        //?
+        //? This command is only available with WORK_OFFSETS defined. G59.1 to G59.3 aren't, there are six coordinate systems only.
+#ifdef WORK_OFFSETS
+        if (cmd->subcode)
+          sersendf_P(PSTR("E: Bad coordinate system"));
+        else
+          coord_select(cmd->G - 54);
+#endif
         break;
       
       case 68:
       case 69:
-        //? --- G68-69: Coordinate system rotation control
-        //TODO: if going for the hard-math configuration, implement just for fun
+        //? --- G68, G69: Rotation ---
+        //?
+        //? Example: G68 X10 Y10 R30
+        //?
+        //? Rotate X and Y of all moves from now on by R degrees counterclockwise, here 30, about the center given by X and Y, here (10, 10). Left out, X and Y of the center are zero. Rotation goes after scaling and mirroring. G69 turns rotation off.
+        //?
+        //? This command is only available with TRANSFORM defined. The next move should give both X and Y, as axes left out stay where they are in untransformed coordinates.
+#ifdef TRANSFORM
+        if (cmd->G == 69)
+          transform_rotate(0, 0, 0);
+        else
+          // R is read as a length, in inches it's converted
+          transform_rotate(cmd->seen_X ? cmd->target.X : 0,
+                           cmd->seen_Y ? cmd->target.Y : 0,
+                           ! cmd->seen_R ? 0 : (cmd->option_inches ?
+                             muldiv(cmd->R, 10, 254) : cmd->R));
+#endif
         break;
       
-      //TODO: implement canned cycles that make sense on our hardware
+      case 73:
+      case 81:
+      case 82:
+      case 83:
+        //? --- G73, G81-83: Canned drilling cycles ---
+        //?
+        //? Example: G81 X10 Y10 R2 Z-5 F100
+        //?
+        //? Drill a hole at (10, 10): rapid there, rapid down to the R plane at Z = 2 mm, feed down to Z = -5 mm, then rapid back up, to where Z was before the cycle with G98, the default, or to the R plane with G99. Lines after it with just X and Y, like <tt>X20 Y10</tt>, drill more holes the same way until G80 or G0 to G3.
+        //?
+        //? G82 waits for P seconds at the bottom, like <tt>G82 X10 Y10 R2 Z-5 P0.5</tt>. G83 pecks, going back up to the R plane after each Q of depth, like <tt>G83 X10 Y10 R2 Z-20 Q3</tt>. G73 does the same, but only backs off half a millimeter to break the chip. L drills that many holes, each the given X and Y further on with G91.
+        //?
+        //? R and Z are needed on the first line, later lines can leave them out to keep them, same for Q and P. In G91, R is from where Z was before the cycle and Z is from R.
+        //?
+        //? This command is only available with CANNED_CYCLES defined, and not with cutter compensation on. Holes are always drilled along Z.
+#ifdef CANNED_CYCLES
+  #ifdef CUTTER_COMP
+        if (comp_side) {
+          sersendf_P(PSTR("E: Not with G41/G42"));
+          break;
+        }
+  #endif
+  #ifdef ARC_TOLERANCE
+        if (arc_plane != ARC_PLANE_XY) {
+          sersendf_P(PSTR("E: Not with G18/G19"));
+          break;
+        }
+  #endif
+  #ifdef INVERSE_TIME
+        if (cmd->option_inverse_time) {
+          sersendf_P(PSTR("E: Not with G93"));
+          break;
+        }
+  #endif
+        cycle_start(cmd);
+#endif
+        break;
+
+      case 80:
+        //? --- G80: Cancel canned cycle ---
+        //?
+        //? Example: G80
+        //?
+        //? Lines with just X and Y are plain moves again, see G81.
+#ifdef CANNED_CYCLES
+        cycle_stop();
+#endif
+        break;
+
         
       case 90:
         //? --- G90: Set to Absolute Positioning ---
@@ -298,8 +710,8 @@ void process_gcode_command() {
         //? coordinate system on relative movements.
         //?
 
-        // No wait_queue() needed.
-        next_target.option_all_relative = 0;
+        // No wait_queue() needed. Applied in gcode_parse_char() already, see
+        // G20.
         break;
 
       case 91:
@@ -310,8 +722,8 @@ void process_gcode_command() {
         //? All coordinates from now on are relative to the last position.
         //?
 
-        // No wait_queue() needed.
-        next_target.option_all_relative = 1;
+        // No wait_queue() needed. Applied in gcode_parse_char() already, see
+        // G20.
         break;
 
       case 92:
@@ -325,23 +737,26 @@ void process_gcode_command() {
 
         queue_wait();
 
-        if (next_target.seen_X) {
-          startpoint.X = next_target.target.X;
+        if (cmd->seen_X) {
+          startpoint.X = cmd->target.X;
           axisSelected = 1;
         }
-        if (next_target.seen_Y) {
-          startpoint.Y = next_target.target.Y;
+        if (cmd->seen_Y) {
+          startpoint.Y = cmd->target.Y;
           axisSelected = 1;
         }
-        if (next_target.seen_Z) {
-          startpoint.Z = next_target.target.Z;
+        if (cmd->seen_Z) {
+          startpoint.Z = cmd->target.Z;
           axisSelected = 1;
         }
 
         if (axisSelected == 0) {
-          startpoint.X = next_target.target.X =
-          startpoint.Y = next_target.target.Y =
-          startpoint.Z = next_target.target.Z = 0;
+          // zero in programmed coordinates
+          startpoint.X = coord_offset.X;
+          startpoint.Y = coord_offset.Y;
+          startpoint.Z = coord_offset.Z;
+          next_target.target.X = next_target.target.Y =
+          next_target.target.Z = 0;
         }
 
         dda_new_startpoint();
@@ -349,10 +764,21 @@ void process_gcode_command() {
       
       case 93:
       case 94:
+        //? --- G93, G94: Feed rate mode ---
+        //?
+        //? Example: G93
+        //?
+        //? From here on, F gives how many times per minute each move could be done, i.e. it takes 1 / F minutes however long it is, until G94 goes back to F in mm/min (or inches/min), the default. F1 takes a minute, F60 a second. This includes F on the same line, wherever it is, so <tt>G93 G1 X10 F2</tt> takes half a minute. Give F with every move, G1, G2 and G3 without one are refused. The feedrate of G94 is back after it. Step timing comes from the number of steps and the time, so there's no distance to work out.
+        //?
+        //? G0 goes at full speed as always. Arcs take their time as a whole. Splines, canned cycles and cutter compensation aren't possible in G93.
+        //?
+        //? This command is only available with INVERSE_TIME defined.
+        // No wait_queue() needed. Applied in gcode_parse_char() already,
+        // right when the G word arrives.
+        break;
+
       case 95:
-        //? --- G93-95: Feed rate selection
-        //TODO: if I ever get the guts to mess with the physics algorithm, implement G93 just for fun
-        //TODO: make G94 a fallthrough as it's the default and currently only option
+        //? --- G95: Feed per revolution
         //We don't have the hardware for G95, save for the distant future
         break;
       
@@ -363,13 +789,19 @@ void process_gcode_command() {
         
       case 98:
       case 99:
-        //? -- G98-99: Z-retract control
-        //TODO: mandatory for CNC machining, implement
+        //? --- G98, G99: Canned cycle retract ---
+        //?
+        //? Example: G99
+        //?
+        //? After each hole of a canned cycle, go back up to the R plane (G99) or to where Z was before the cycle, but at least the R plane (G98, the default).
+
+        // No wait_queue() needed. Applied in gcode_parse_char() already, see
+        // G20.
         break;
 
         // unknown gcode: spit an error
       default:
-        sersendf_P(PSTR("E: Bad G-code %d"), next_target.G);
+        sersendf_P(PSTR("E: Bad G-code %d"), cmd->G);
         // newline is sent from gcode_parse after we return
         return;
     }
@@ -377,8 +809,8 @@ void process_gcode_command() {
     if (DEBUG_POSITION && (debug_flags & DEBUG_POSITION)) print_queue();
 #endif
   }
-  else if (next_target.seen_M) {
-    switch (next_target.M) {
+  else if (cmd->seen_M) {
+    switch (cmd->M) {
       case 0:
         //? --- M0: machine stop ---
         //?
@@ -420,8 +852,17 @@ void process_gcode_command() {
         break;
 
       case 6:
-        //? --- M6: ATC ---
-        //TODO: software will do this for us for now (monolithic image), by issuing a G28 and waiting for us to press a key
+        //? --- M6: Tool change ---
+        //?
+        //? Example: T3 M6
+        //?
+        //? Change to the tool selected with T. With TOOL_CHANGE_Z defined and a tool other than the current one, Z goes up to there, then X and Y to TOOL_CHANGE_X and TOOL_CHANGE_Y if these are defined. Once all moves are done, "Change tool 3" is sent along with the ok and the host should pause until the tool is in. A tool length offset is not updated, issue G43 again.
+#if defined TOOL_TABLE && defined TOOL_CHANGE_Z
+        if (next_tool != tool) {
+          tool_change(next_tool);
+          coord_update();
+        }
+#endif
         tool = next_tool;
         break;
         
@@ -458,8 +899,17 @@ void process_gcode_command() {
       case 21:
       case 22:
       case 23:
-        //? --- M21-23: Axis mirror control
-        //TODO: implement, could come in very handy
+        //? --- M21-23: Mirroring ---
+        //?
+        //? Example: M21
+        //?
+        //? Mirror X (M21) or Y (M22) of all moves from now on, i.e. X becomes -X, on top of an axis mirrored already. Mirroring goes before scaling and rotation, and turns arcs around. M23 turns mirroring off.
+        //?
+        //? This command is only available with TRANSFORM defined. The next move should give both X and Y, as axes left out stay where they are in unmirrored coordinates.
+#ifdef TRANSFORM
+        transform_mirror((cmd->M == 23) ? 0 : ((cmd->M == 21) ?
+                         TRANSFORM_MIRROR_X : TRANSFORM_MIRROR_Y));
+#endif
         break;
 
       case 30:
@@ -507,12 +957,20 @@ void process_gcode_command() {
         //?
         //? This command is only available in DEBUG builds of Teacup.
 
-        if ( ! next_target.seen_S)
+        if ( ! cmd->seen_S)
           break;
-        debug_flags = next_target.S;
+        debug_flags = cmd->S;
         break;
 #endif
 
+      case 110:
+        //? --- M110: Set Current Line Number ---
+        //?
+        //? Example: N123 M110
+        //?
+        //? Set the current line number to 123, so the next line expected is N124. Done by the parser already, see gcode_parse_char(); lines failing their checksum or coming with an unexpected line number are dropped and answered with a resend request like <tt>rs N124</tt>.
+        break;
+
       case 114:
         //? --- M114: Get Current Position ---
         //?
@@ -548,6 +1006,10 @@ void process_gcode_command() {
         //TODO: come up with a better reply to M115
 
         sersendf_P(PSTR("FIRMWARE_NAME:Modified_Teacup FIRMWARE_URL:http%%3A//github.com/csdexter/Teacup_Firmware/ PROTOCOL_VERSION:1.0 MACHINE_TYPE:S-720"));
+#ifdef STREAMING
+        // characters a host may have sent but not seen acknowledged
+        sersendf_P(PSTR(" RX_BUFFER_SIZE:%u"), SERIAL_BUFSIZE - 1);
+#endif
         // newline is sent from gcode_parse after we return
         break;
 
@@ -604,10 +1066,57 @@ void process_gcode_command() {
         break;
 #endif /* DEBUG */
 
+#ifdef PROFILE_STEP_ISR
+      case 251:
+        //? --- M251: report step interrupt profile ---
+        //?
+        //? Example: M251 S1
+        //?
+        //? Report histograms of how late the step interrupt fired and how long it took, in CPU clocks, separately for plain steps, steps with an acceleration update and steps starting a new move, and how long planning a move in dda_create() took. Bucket b counts values from 2^(b-1) to 2^b - 1 clocks, bucket 0 counts zeros, bucket 16 everything from 32768 up; empty buckets are left out. With S1, clear the histograms afterwards.
+        //?
+        //? <tt>ok {step late 6:812 7:40 time 8:790 9:62} {ramp late 6:120 time 9:118 10:2} {start late 7:3 time 10:2 11:1} {create time 12:40 13:3}</tt>
+        //?
+        //? This command is only available with PROFILE_STEP_ISR defined.
+        profile_report();
+        if (cmd->seen_S && cmd->S == 1)
+          profile_clear();
+        // newline is sent from gcode_parse after we return
+        break;
+#endif /* PROFILE_STEP_ISR */
+
+#ifdef GCODE_BINARY
+      case 252:
+        //? --- M252: switch to binary command frames ---
+        //?
+        //? Example: M252
+        //?
+        //? Send commands as binary frames instead of G-code text from the next line on, see gcode_binary.c for the frame layout. Frames are numbered from 0 after each M252. M252 S0, sent as a frame, switches back to text. Done by the parser already.
+        //?
+        //? This command is only available with GCODE_BINARY defined.
+        break;
+#endif /* GCODE_BINARY */
+
+#ifdef PROFILE_MATHS
+      case 254:
+        //? --- M254: time the maths functions ---
+        //?
+        //? Example: M254
+        //?
+        //? Once all moves are done, call each of the maths functions 64 times with made up arguments and report minimum, average and maximum CPU clocks per call. The arguments are the same on every run, so numbers of different builds compare. Interrupts are locked during each call, better send nothing else meanwhile.
+        //?
+        //? <tt>ok {approx_distance min avg max} {approx_distance_3 min avg max} ...</tt>
+        //?
+        //? This command is only available with PROFILE_MATHS defined.
+        queue_wait();
+        profile_maths();
+        // newline is sent from gcode_parse after we return
+        break;
+#endif /* PROFILE_MATHS */
+
         // unknown mcode: spit an error
       default:
-        sersendf_P(PSTR("E: Bad M-code %d"), next_target.M);
+        sersendf_P(PSTR("E: Bad M-code %d"), cmd->M);
         // newline is sent from gcode_parse after we return
-    } // switch (next_target.M)
-  } // else if (next_target.seen_M)
+    } // switch (cmd->M)
+  } // else if (cmd->seen_M)
 } // process_gcode_command()
@@ -8,7 +8,7 @@ extern uint8_t tool;
 // the tool to be changed when we get an M6
 extern uint8_t next_tool;
 
-// when we have a whole line, feed it to this
-void process_gcode_command(void);
+// when a whole line has made it through the command queue, feed it to this
+void process_gcode_command(GCODE_COMMAND *cmd);
 
 #endif  /* _GCODE_PROCESS_H */
@@ -0,0 +1,89 @@
+#include "gcode_queue.h"
+
+/** \file
+  \brief G-code Queue - hold parsed commands until the movebuffer takes them
+
+  Parsing a line, including decimal to integer conversion of all its words,
+  takes a fair amount of time. Doing this while the movebuffer is full means
+  that time is taken from moves already queued instead of from the dda_create()
+  waiting for the next free slot.
+*/
+
+#include <string.h>
+
+#include "serial.h"
+#include "gcode_process.h"
+
+/// command buffer head pointer. Points to the last command in the queue.
+uint8_t cb_head = 0;
+
+/// command buffer tail pointer. Points to the oldest command in the queue,
+/// the next one to be processed.
+uint8_t cb_tail = 0;
+
+/// set while a command changing parser state waits in the queue,
+/// see gcode_enqueue().
+uint8_t cb_sync = 0;
+
+/// command buffer.
+/// holds parsed commands in the order they were received. Unlike the
+/// movebuffer, this is never touched from interrupt context.
+/// The size MUST be a \f$2^n\f$ value.
+GCODE_COMMAND cmdbuffer[CMDBUFFER_SIZE] __attribute__ ((__section__ (".bss")));
+
+/// check if the queue can't take another command
+/// also reports full while a command waits that changes parser state, as the
+/// lines after it can't be parsed before it's processed
+uint8_t gcode_queue_full() {
+  if (cb_sync)
+    return 255;
+  return (((cb_head + 1) & (CMDBUFFER_SIZE - 1)) == cb_tail) ? 255 : 0;
+}
+
+/// check if the queue is completely empty
+uint8_t gcode_queue_empty() {
+  return (cb_head == cb_tail) ? 255 : 0;
+}
+
+/// add the command just parsed into \ref next_target to the queue
+/// \param sync set if processing this command writes to \ref next_target,
+/// e.g. G28 or G92. No more lines are parsed until it has been processed.
+/// \note don't call this when the queue is full, check gcode_queue_full()
+void gcode_enqueue(uint8_t sync) {
+  uint8_t h = (cb_head + 1) & (CMDBUFFER_SIZE - 1);
+
+  memcpy(&cmdbuffer[h], &next_target, sizeof(GCODE_COMMAND));
+  cb_head = h;
+
+  if (sync)
+    cb_sync = 1;
+}
+
+/// process the oldest command in the queue and acknowledge it to the host
+/// \note this may block on a full movebuffer, check queue_full() first if
+/// waiting is a problem
+///
+/// With STREAMING, lines are acknowledged when parsed already, so only
+/// commands which have something to say get a line here.
+void gcode_dequeue() {
+  if (gcode_queue_empty())
+    return;
+
+  uint8_t t = (cb_tail + 1) & (CMDBUFFER_SIZE - 1);
+
+#ifdef STREAMING
+  serial_written = 0;
+  process_gcode_command(&cmdbuffer[t]);
+  if (serial_written)
+    serial_writechar('\n');
+#else
+  serial_writestr_P(PSTR("ok "));
+  process_gcode_command(&cmdbuffer[t]);
+  serial_writechar('\n');
+#endif
+
+  cb_tail = t;
+  // a syncing command is always the last one in the queue
+  if (cb_tail == cb_head)
+    cb_sync = 0;
+}
@@ -0,0 +1,30 @@
+#ifndef _GCODE_QUEUE_H
+#define _GCODE_QUEUE_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "gcode_parse.h"
+
+/*
+  variables
+*/
+// this is the ringbuffer that holds parsed commands waiting to be processed.
+extern uint8_t cb_head;
+extern uint8_t cb_tail;
+extern GCODE_COMMAND cmdbuffer[CMDBUFFER_SIZE];
+
+/*
+  methods
+*/
+// queue status methods
+uint8_t gcode_queue_full(void);
+uint8_t gcode_queue_empty(void);
+
+// add the command just parsed to the queue
+void gcode_enqueue(uint8_t sync);
+
+// process the oldest command in the queue
+void gcode_dequeue(void);
+
+#endif  /* _GCODE_QUEUE_H */
@@ -0,0 +1,124 @@
+/** \file
+  \brief Step native arcs the way the step interrupt does, check where they go
+
+  \code
+  arcs
+  \endcode
+
+  Creates each arc with dda_create_arc() and steps it with dda_arc_next()
+  until it's done, see dda_step(). Checks that it ends where it should,
+  that no step strays from the circle by more than a step, that it sweeps
+  the angle it should, in the right direction, and how many octant
+  boundaries it passed. Starts and ends are on octant boundaries as well as
+  in between, in both directions.
+
+  dda.c is included here, for its static functions, so this is built with
+  ARC_NATIVE defined, see Makefile.
+*/
+
+#include "dda.c"
+
+#include <stdio.h>
+#include <math.h>
+
+/// radius of the arcs, in micrometers, around (0, 0)
+#define RADIUS 30000.
+
+static int failed = 0;
+
+/// point on the circle, in micrometers, exactly on octant boundaries
+static int32_t on_circle(double degrees, uint8_t sine) {
+  double a = degrees * M_PI / 180.;
+
+  return lround(RADIUS * (sine ? sin(a) : cos(a)));
+}
+
+/*! step one arc
+  \param from angle of the start, degrees
+  \param sweep angle to go, degrees, positive counterclockwise; 360 or -360
+               for a full circle
+  \param octants octant boundaries it should pass
+*/
+static void check_arc(double from, double sweep, uint8_t octants) {
+  TARGET t;
+  DDA dda;
+  double r, a, last, swept = 0., err, worst = 0.;
+  int32_t x, y;
+  uint32_t n = 0;
+  uint8_t ccw = (sweep > 0.), ok;
+
+  memset(&t, 0, sizeof(TARGET));
+  memset(&dda, 0, sizeof(DDA));
+  startpoint.X = on_circle(from, 0);
+  startpoint.Y = on_circle(from, 1);
+  startpoint.Z = 0;
+  startpoint.F = 600;
+  startpoint_steps.X = um_to_steps_x(startpoint.X);
+  startpoint_steps.Y = um_to_steps_y(startpoint.Y);
+  startpoint_steps.Z = 0;
+  t.X = on_circle(from + sweep, 0);
+  t.Y = on_circle(from + sweep, 1);
+  t.F = 600;
+
+  dda_create_arc(&dda, &t, 0, 0, lround(RADIUS * fabs(sweep) * M_PI / 180.),
+                 ccw, fabs(sweep) > 180.);
+
+  // the circle through the start, the one stepped along
+  x = dda.arc_x;
+  y = dda.arc_y;
+  r = sqrt((double)x * x + (double)y * y);
+  last = atan2(y, x);
+  dda_arc_start(&dda);
+  do {
+    // what dda_step() does, one step interrupt
+    if (move_state.arc_next & ARC_STEP_X)
+      x += (move_state.arc_next & ARC_DIR_X) ? 1 : -1;
+    if (move_state.arc_next & ARC_STEP_Y)
+      y += (move_state.arc_next & ARC_DIR_Y) ? 1 : -1;
+    dda_arc_next(&dda);
+
+    err = fabs(sqrt((double)x * x + (double)y * y) - r);
+    if (err > worst)
+      worst = err;
+    a = atan2(y, x);
+    swept += remainder(a - last, 2. * M_PI);
+    last = a;
+  } while (move_state.x_steps && ++n < 10 * dda.total_steps);
+
+  swept *= 180. / M_PI;
+  ok = x == dda.arc_x_end && y == dda.arc_y_end && worst <= 1. &&
+       fabs(swept - sweep) < 0.1 && dda.arc_octants == octants &&
+       move_state.arc_passed == octants;
+  printf("%s arc %6.1f %+7.1f  swept %+7.2f  octants %u  worst %.3f steps\n",
+         ok ? "ok  " : "FAIL", from, sweep, swept, move_state.arc_passed,
+         worst);
+  if ( ! ok)
+    failed = 1;
+}
+
+int main(void) {
+  // quarters from and to boundaries
+  check_arc(0., 90., 2);
+  check_arc(90., -90., 2);
+  check_arc(45., 90., 2);
+  check_arc(45., -90., 2);
+  check_arc(180., 90., 2);
+  check_arc(270., -45., 1);
+  // within an octant, and across the positive X axis
+  check_arc(10., 20., 0);
+  check_arc(350., 20., 1);
+  check_arc(10., -20., 1);
+  // long ones
+  check_arc(180., 180., 4);
+  check_arc(0., -180., 4);
+  check_arc(10., 340., 7);
+  check_arc(20., -350., 8);
+  check_arc(30., 170., 4);
+  check_arc(200., -170., 4);
+  // full circles
+  check_arc(0., 360., 8);
+  check_arc(45., -360., 8);
+  check_arc(100., 360., 8);
+
+  return failed;
+}
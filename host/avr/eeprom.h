@@ -0,0 +1,21 @@
+#ifndef _HOST_AVR_EEPROM_H
+#define _HOST_AVR_EEPROM_H
+
+/** \file
+  \brief Host stand-in for avr-libc's EEPROM access, see hw.c
+
+  EEMEM variables are plain variables in RAM, so the EEPROM starts out
+  erased to zeros each time and keeps what's written to it until exit.
+*/
+
+#include <stdint.h>
+
+#define EEMEM
+
+uint8_t eeprom_read_byte(const uint8_t *);
+void eeprom_write_byte(uint8_t *, uint8_t);
+void eeprom_read_block(void *, const void *, unsigned);
+void eeprom_write_block(const void *, void *, unsigned);
+void eeprom_update_block(const void *, void *, unsigned);
+
+#endif /* _HOST_AVR_EEPROM_H */
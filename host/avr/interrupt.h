@@ -0,0 +1,18 @@
+#ifndef _HOST_AVR_INTERRUPT_H
+#define _HOST_AVR_INTERRUPT_H
+
+/** \file
+  \brief Host stand-in for avr-libc's interrupt handling
+
+  Nothing interrupts on the host, interrupt handlers become plain functions
+  no one calls.
+*/
+
+#include <avr/io.h>
+
+#define ISR(vector, ...) void vector(void); void vector(void)
+#define ISR_NOBLOCK
+#define sei() do {} while (0)
+#define cli() do {} while (0)
+
+#endif /* _HOST_AVR_INTERRUPT_H */
@@ -0,0 +1,115 @@
+#ifndef _HOST_AVR_IO_H
+#define _HOST_AVR_IO_H
+
+/** \file
+  \brief Host stand-in for avr-libc's register definitions, ATmega328P only
+
+  Registers are plain variables, defined in hw.c. Writing them does nothing,
+  reading them gives what was written last.
+*/
+
+#include <stdint.h>
+
+#define _BV(bit) (1 << (bit))
+
+/// all the registers, R8() and R16() by their width
+#define HOST_REGISTERS(R8, R16) \
+  R8(PRR) R8(ACSR) R8(TCCR1A) R8(TCCR1B) R8(TCCR1C) R16(OCR1A) R16(OCR1B) \
+  R16(TCNT1) R8(TIMSK1) R8(TIFR1) R8(OCR0A) R8(OCR0B) R8(TCCR0A) R8(TCCR0B) \
+  R8(TIMSK0) R8(TCCR2A) R8(TCCR2B) R8(OCR2A) R8(OCR2B) R8(TIMSK2) R8(TCNT2) \
+  R8(TIFR2) R8(ASSR) R8(GTCCR) R8(SREG) R8(UCSR0A) R8(UCSR0B) R8(UCSR0C) \
+  R16(UBRR0) R8(UDR0) R8(PINB) R8(PORTB) R8(DDRB) R8(PINC) R8(PORTC) \
+  R8(DDRC) R8(PIND) R8(PORTD) R8(DDRD) R8(WDTCSR) R8(MCUSR) R8(EECR) \
+  R8(EEDR) R16(EEAR)
+
+#define HOST_R8(name) extern volatile uint8_t name;
+#define HOST_R16(name) extern volatile uint16_t name;
+HOST_REGISTERS(HOST_R8, HOST_R16)
+#undef HOST_R8
+#undef HOST_R16
+
+#define PRTWI 7
+#define PRTIM2 6
+#define PRTIM0 5
+#define PRTIM1 3
+#define PRSPI 2
+#define PRUSART0 1
+#define PRADC 0
+#define ACD 7
+#define CS10 0
+#define CS11 1
+#define CS12 2
+#define WGM12 3
+#define WGM13 4
+#define WGM10 0
+#define WGM11 1
+#define COM1A0 6
+#define COM1A1 7
+#define COM1B0 4
+#define COM1B1 5
+#define FOC1A 7
+#define FOC1B 6
+#define OCIE1A 1
+#define OCIE1B 2
+#define TOIE1 0
+#define OCF1A 1
+#define OCF1B 2
+#define TOV1 0
+#define ICF1 5
+#define COM0A0 6
+#define WGM01 1
+#define CS01 1
+#define CS20 0
+#define CS21 1
+#define CS22 2
+#define WGM21 1
+#define OCIE2A 1
+#define OCIE2B 2
+#define OCF2A 1
+#define TOIE2 0
+#define PSRSYNC 0
+#define PSRASY 1
+#define TSM 7
+#define SREG_I 7
+#define U2X0 1
+#define RXEN0 4
+#define TXEN0 3
+#define UCSZ01 2
+#define UCSZ00 1
+#define RXCIE0 7
+#define UDRIE0 5
+#define TXCIE0 6
+#define WDIE 6
+#define PINB0 0
+#define PINB1 1
+#define PINB2 2
+#define PINB3 3
+#define PINB4 4
+#define PINB5 5
+#define PINB6 6
+#define PINB7 7
+#define PINC0 0
+#define PINC1 1
+#define PINC2 2
+#define PINC3 3
+#define PINC4 4
+#define PINC5 5
+#define PINC6 6
+#define PINC7 7
+#define PIND0 0
+#define PIND1 1
+#define PIND2 2
+#define PIND3 3
+#define PIND4 4
+#define PIND5 5
+#define PIND6 6
+#define PIND7 7
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define E2END 1023
+
+#endif /* _HOST_AVR_IO_H */
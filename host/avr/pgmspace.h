@@ -0,0 +1,19 @@
+#ifndef _HOST_AVR_PGMSPACE_H
+#define _HOST_AVR_PGMSPACE_H
+
+/** \file
+  \brief Host stand-in for avr-libc's flash access, flash is just memory
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define memcpy_P(d, s, n) memcpy((d), (s), (n))
+
+#endif /* _HOST_AVR_PGMSPACE_H */
@@ -0,0 +1,7 @@
+#ifndef _HOST_AVR_VERSION_H
+#define _HOST_AVR_VERSION_H
+
+/// recent enough for everything the firmware checks for
+#define __AVR_LIBC_VERSION__ 10800UL
+
+#endif /* _HOST_AVR_VERSION_H */
@@ -0,0 +1,13 @@
+#ifndef _HOST_AVR_WDT_H
+#define _HOST_AVR_WDT_H
+
+/** \file
+  \brief Host stand-in for avr-libc's watchdog, there's no watchdog
+*/
+
+#define WDTO_500MS 5
+
+#define wdt_enable(timeout) do {} while (0)
+#define wdt_reset() do {} while (0)
+
+#endif /* _HOST_AVR_WDT_H */
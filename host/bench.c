@@ -0,0 +1,109 @@
+/** \file
+  \brief Parser throughput on job files
+
+  \code
+  bench file ...
+  \endcode
+
+  Runs each file through gcode_parse_char() over and over, for at least a
+  second, and reports characters per second and the cost per line. Once
+  parsing alone, dropping the commands, once with processing them too,
+  which includes planning each move with dda_create(), see host.c.
+
+  These are PC numbers. They're for comparing one version of the parser
+  with another, not for telling how fast the AVR is.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "host.h"
+#include "gcode_parse.h"
+#include "gcode_queue.h"
+
+/// run each test for at least this long, in seconds
+#define BENCH_TIME 1.0
+
+// the queue's lock while a syncing command waits, see gcode_queue.c
+extern uint8_t cb_sync;
+
+static double now(void) {
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/// one run through the file
+static void run(const uint8_t *data, long size, uint8_t process) {
+  long i;
+
+  for (i = 0; i < size; i++) {
+    if (process)
+      host_char(data[i]);
+    else {
+      gcode_parse_char(data[i]);
+      // drop it right away
+      cb_tail = cb_head;
+      cb_sync = 0;
+    }
+  }
+  if (process)
+    host_drain();
+}
+
+static void bench(const char *name, const uint8_t *data, long size,
+                  long lines, uint8_t process) {
+  double start = now(), elapsed;
+  long rounds = 0;
+
+  do {
+    run(data, size, process);
+    rounds++;
+    elapsed = now() - start;
+  } while (elapsed < BENCH_TIME);
+
+  printf("%-24s %-8s %12.0f chars/s %10.1f ns/line\n", name,
+         process ? "process" : "parse", (double)size * rounds / elapsed,
+         elapsed * 1e9 / ((double)lines * rounds));
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  uint8_t *data;
+  long size, lines, i;
+  int arg;
+
+  host_init();
+
+  for (arg = 1; arg < argc; arg++) {
+    f = fopen(argv[arg], "rb");
+    if (f == NULL) {
+      perror(argv[arg]);
+      return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc(size);
+    if (data == NULL || fread(data, 1, size, f) != (size_t)size) {
+      perror(argv[arg]);
+      return 1;
+    }
+    fclose(f);
+
+    for (lines = 0, i = 0; i < size; i++)
+      if (data[i] == '\n')
+        lines++;
+    if (lines == 0)
+      lines = 1;
+
+    bench(argv[arg], data, size, lines, 0);
+    bench(argv[arg], data, size, lines, 1);
+    free(data);
+  }
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/** \file
+  \brief Fuzz target for the parser and everything after it
+
+  Each input goes through the firmware as if sent over the serial line,
+  text or binary, and gets processed, queued and planned, see host.c. The
+  machine isn't reset in between, like on a real one.
+
+  With libFuzzer, LLVMFuzzerTestOneInput() is all there is. Built with
+  FUZZ_MAIN, there's a main() for AFL and plain compilers:
+
+  \code
+  fuzz-afl file ...
+  fuzz-random -r count [file ...]
+  \endcode
+
+  The first runs each file once. The second makes up count inputs, random
+  characters likely in G-code, spliced with pieces of the files if given.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  static uint8_t ready = 0;
+  size_t i;
+
+  if ( ! ready) {
+    host_init();
+    ready = 1;
+  }
+
+  for (i = 0; i < size; i++)
+    host_char(data[i]);
+  host_char('\n');
+  host_drain();
+
+  return 0;
+}
+
+#ifdef FUZZ_MAIN
+
+/// longest input made up
+#define FUZZ_LENGTH 256
+
+/// characters random input is made of, most of the time
+static const char alphabet[] =
+  "GMXYZFSPTNIJKRQLDHABCgmxyz0123456789.+-* ()\n\r;%\t";
+
+/// all the files, concatenated
+static uint8_t *pool = NULL;
+static size_t pool_size = 0;
+
+static uint8_t *load(const char *name, size_t *size) {
+  FILE *f = fopen(name, "rb");
+  uint8_t *data;
+  long n;
+
+  if (f == NULL) {
+    perror(name);
+    exit(1);
+  }
+  fseek(f, 0, SEEK_END);
+  n = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data = malloc(n + 1);
+  if (data == NULL || fread(data, 1, n, f) != (size_t)n) {
+    perror(name);
+    exit(1);
+  }
+  fclose(f);
+
+  *size = n;
+  return data;
+}
+
+int main(int argc, char **argv) {
+  uint8_t input[FUZZ_LENGTH], *data;
+  size_t size, i, length;
+  long count = 0, n;
+  int arg = 1;
+
+  if (arg + 1 < argc && strcmp(argv[arg], "-r") == 0) {
+    count = atol(argv[arg + 1]);
+    arg += 2;
+  }
+
+  for (; arg < argc; arg++) {
+    data = load(argv[arg], &size);
+    if (count == 0) {
+      LLVMFuzzerTestOneInput(data, size);
+      free(data);
+      continue;
+    }
+    pool = realloc(pool, pool_size + size);
+    memcpy(pool + pool_size, data, size);
+    pool_size += size;
+    free(data);
+  }
+
+  srand(1);
+  for (n = 0; n < count; n++) {
+    length = rand() % FUZZ_LENGTH;
+    for (i = 0; i < length; ) {
+      if (pool_size && rand() % 4 == 0) {
+        // a piece of a real file
+        size = rand() % 32;
+        data = pool + rand() % pool_size;
+        while (size-- && i < length && data < pool + pool_size)
+          input[i++] = *data++;
+      }
+      else if (rand() % 8 == 0)
+        input[i++] = rand();
+      else
+        input[i++] = alphabet[rand() % (sizeof(alphabet) - 1)];
+    }
+    LLVMFuzzerTestOneInput(input, length);
+  }
+
+  return 0;
+}
+
+#endif /* FUZZ_MAIN */
@@ -0,0 +1,97 @@
+/** \file
+  \brief The firmware's main loop, for running it on a PC
+
+  Same order of things as in mendel.c, minus what needs hardware. A
+  character is only parsed when the command queue has room, so commands
+  which sync the parser, like G92, are processed before the next line as
+  on the machine.
+*/
+
+#include "host.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "config.h"
+#include "gcode_parse.h"
+#include "gcode_queue.h"
+#include "gcode_binary.h"
+#include "dda.h"
+#include "arc.h"
+#include "spline.h"
+#include "cycle.h"
+#include "tool.h"
+#include "coord.h"
+
+uint8_t host_trace = 0;
+
+uint8_t host_echo = 0;
+
+/// the reply line being sent
+static char reply[1024];
+static uint16_t reply_length = 0;
+
+void host_init() {
+  gcode_init();
+  dda_init();
+#ifdef TOOL_TABLE
+  tool_init();
+#endif
+  coord_init();
+}
+
+/// one round of the main loop's processing, returns zero if idle
+static uint8_t host_step(void) {
+#ifdef ARC_TOLERANCE
+  if (arc_segments)
+    arc_segment();
+  else
+#endif
+#ifdef SPLINE_TOLERANCE
+  if (spline_active)
+    spline_segment();
+  else
+#endif
+#ifdef CANNED_CYCLES
+  if (cycle_active)
+    cycle_segment();
+  else
+#endif
+  if (gcode_queue_empty() == 0)
+    gcode_dequeue();
+  else
+    return 0;
+
+  return 1;
+}
+
+void host_char(uint8_t c) {
+  while (gcode_queue_full())
+    host_step();
+
+#ifdef GCODE_BINARY
+  if (binary_mode)
+    gcode_binary_char(c);
+  else
+#endif
+  gcode_parse_char(c);
+}
+
+void host_drain() {
+  while (host_step());
+}
+
+void host_reply(uint8_t c) {
+  if (c != '\n') {
+    if (reply_length < sizeof(reply) - 1)
+      reply[reply_length++] = c;
+    return;
+  }
+
+  reply[reply_length] = '\0';
+  // "ok " comes before anything a command says
+  if (host_echo > 1 ||
+      (host_echo && strcmp(reply, "ok") && strcmp(reply, "ok ")))
+    printf("%s\n", reply);
+  reply_length = 0;
+}
@@ -0,0 +1,24 @@
+#ifndef _HOST_H
+#define _HOST_H
+
+#include <stdint.h>
+
+/// print each move queued, see queue.c
+extern uint8_t host_trace;
+
+/// which replies to print: 0 none, 1 all but a plain "ok", 2 all of them
+extern uint8_t host_echo;
+
+// set up the firmware like init() does, as far as it runs on the host
+void host_init(void);
+
+// one character from the serial line, the way the main loop takes it
+void host_char(uint8_t c);
+
+// process all commands parsed, and everything they queue
+void host_drain(void);
+
+// a character the firmware sends to the host
+void host_reply(uint8_t c);
+
+#endif /* _HOST_H */
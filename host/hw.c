@@ -0,0 +1,51 @@
+/** \file
+  \brief Host stand-ins for the AVR hardware and avr-libc
+
+  Just enough for the firmware to link and run on a PC, see Makefile.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <avr/io.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+#include <util/delay_basic.h>
+
+#define HOST_R8(name) volatile uint8_t name;
+#define HOST_R16(name) volatile uint16_t name;
+HOST_REGISTERS(HOST_R8, HOST_R16)
+
+uint8_t eeprom_read_byte(const uint8_t *p) {
+  return *p;
+}
+
+void eeprom_write_byte(uint8_t *p, uint8_t value) {
+  *p = value;
+}
+
+void eeprom_read_block(void *dst, const void *src, unsigned n) {
+  memcpy(dst, src, n);
+}
+
+void eeprom_write_block(const void *src, void *dst, unsigned n) {
+  memcpy(dst, src, n);
+}
+
+void eeprom_update_block(const void *src, void *dst, unsigned n) {
+  memcpy(dst, src, n);
+}
+
+/// same polynomial as avr-libc, 0xA001
+uint16_t _crc16_update(uint16_t crc, uint8_t a) {
+  uint8_t i;
+
+  crc ^= a;
+  for (i = 0; i < 8; i++)
+    crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+
+  return crc;
+}
+
+void _delay_loop_2(uint16_t count) {
+  (void)count;
+}
@@ -0,0 +1,227 @@
+(contour - 3 passes of a rounded rectangle with a notch, 6 mm cutter)
+G21 G90 G17
+G0 Z5.000
+G0 X0.000 Y-3.000
+M3 S10000
+G1 Z-1.000 F150
+G1 X0.000 Y0.000 F600
+G1 X40.000
+G3 X50.000 Y10.000 I0.000 J10.000
+G1 Y20.000
+G1 X45.000 Y25.000
+G1 X35.000
+G2 X25.000 Y25.000 I-5.000 J0.000
+G1 X10.000
+G3 X0.000 Y15.000 I0.000 J-10.000
+G1 Y0.000
+G1 X0.000 Y0.000
+G1 X0.500 Y0.065
+G1 X1.000 Y0.124
+G1 X1.500 Y0.168
+G1 X2.000 Y0.194
+G1 X2.500 Y0.199
+G1 X3.000 Y0.182
+G1 X3.500 Y0.145
+G1 X4.000 Y0.091
+G1 X4.500 Y0.028
+G1 X5.000 Y-0.038
+G1 X5.500 Y-0.100
+G1 X6.000 Y-0.151
+G1 X6.500 Y-0.186
+G1 X7.000 Y-0.200
+G1 X7.500 Y-0.192
+G1 X8.000 Y-0.163
+G1 X8.500 Y-0.116
+G1 X9.000 Y-0.056
+G1 X9.500 Y0.010
+G1 X10.000 Y0.075
+G1 X10.500 Y0.131
+G1 X11.000 Y0.173
+G1 X11.500 Y0.197
+G1 X12.000 Y0.198
+G1 X12.500 Y0.177
+G1 X13.000 Y0.138
+G1 X13.500 Y0.082
+G1 X14.000 Y0.018
+G1 X14.500 Y-0.048
+G1 X15.000 Y-0.109
+G1 X15.500 Y-0.158
+G1 X16.000 Y-0.189
+G1 X16.500 Y-0.200
+G1 X17.000 Y-0.189
+G1 X17.500 Y-0.157
+G1 X18.000 Y-0.107
+G1 X18.500 Y-0.046
+G1 X19.000 Y0.020
+G1 X19.500 Y0.084
+G1 X20.000 Y0.139
+G1 X20.500 Y0.178
+G1 X21.000 Y0.198
+G1 X21.500 Y0.196
+G1 X22.000 Y0.173
+G1 X22.500 Y0.130
+G1 X23.000 Y0.073
+G1 X23.500 Y0.008
+G1 X24.000 Y-0.058
+G1 X24.500 Y-0.117
+G1 X25.000 Y-0.164
+G1 X25.500 Y-0.192
+G1 X26.000 Y-0.200
+G1 X26.500 Y-0.185
+G1 X27.000 Y-0.150
+G1 X27.500 Y-0.099
+G1 X28.000 Y-0.036
+G1 X28.500 Y0.030
+G1 X29.000 Y0.093
+G1 X29.500 Y0.146
+G0 Z5.000
+G0 X0.000 Y-3.000
+G1 Z-2.000 F150
+G1 X0.000 Y0.000 F600
+G1 X40.000
+G3 X50.000 Y10.000 I0.000 J10.000
+G1 Y20.000
+G1 X45.000 Y25.000
+G1 X35.000
+G2 X25.000 Y25.000 I-5.000 J0.000
+G1 X10.000
+G3 X0.000 Y15.000 I0.000 J-10.000
+G1 Y0.000
+G1 X0.000 Y0.000
+G1 X0.500 Y0.065
+G1 X1.000 Y0.124
+G1 X1.500 Y0.168
+G1 X2.000 Y0.194
+G1 X2.500 Y0.199
+G1 X3.000 Y0.182
+G1 X3.500 Y0.145
+G1 X4.000 Y0.091
+G1 X4.500 Y0.028
+G1 X5.000 Y-0.038
+G1 X5.500 Y-0.100
+G1 X6.000 Y-0.151
+G1 X6.500 Y-0.186
+G1 X7.000 Y-0.200
+G1 X7.500 Y-0.192
+G1 X8.000 Y-0.163
+G1 X8.500 Y-0.116
+G1 X9.000 Y-0.056
+G1 X9.500 Y0.010
+G1 X10.000 Y0.075
+G1 X10.500 Y0.131
+G1 X11.000 Y0.173
+G1 X11.500 Y0.197
+G1 X12.000 Y0.198
+G1 X12.500 Y0.177
+G1 X13.000 Y0.138
+G1 X13.500 Y0.082
+G1 X14.000 Y0.018
+G1 X14.500 Y-0.048
+G1 X15.000 Y-0.109
+G1 X15.500 Y-0.158
+G1 X16.000 Y-0.189
+G1 X16.500 Y-0.200
+G1 X17.000 Y-0.189
+G1 X17.500 Y-0.157
+G1 X18.000 Y-0.107
+G1 X18.500 Y-0.046
+G1 X19.000 Y0.020
+G1 X19.500 Y0.084
+G1 X20.000 Y0.139
+G1 X20.500 Y0.178
+G1 X21.000 Y0.198
+G1 X21.500 Y0.196
+G1 X22.000 Y0.173
+G1 X22.500 Y0.130
+G1 X23.000 Y0.073
+G1 X23.500 Y0.008
+G1 X24.000 Y-0.058
+G1 X24.500 Y-0.117
+G1 X25.000 Y-0.164
+G1 X25.500 Y-0.192
+G1 X26.000 Y-0.200
+G1 X26.500 Y-0.185
+G1 X27.000 Y-0.150
+G1 X27.500 Y-0.099
+G1 X28.000 Y-0.036
+G1 X28.500 Y0.030
+G1 X29.000 Y0.093
+G1 X29.500 Y0.146
+G0 Z5.000
+G0 X0.000 Y-3.000
+G1 Z-3.000 F150
+G1 X0.000 Y0.000 F600
+G1 X40.000
+G3 X50.000 Y10.000 I0.000 J10.000
+G1 Y20.000
+G1 X45.000 Y25.000
+G1 X35.000
+G2 X25.000 Y25.000 I-5.000 J0.000
+G1 X10.000
+G3 X0.000 Y15.000 I0.000 J-10.000
+G1 Y0.000
+G1 X0.000 Y0.000
+G1 X0.500 Y0.065
+G1 X1.000 Y0.124
+G1 X1.500 Y0.168
+G1 X2.000 Y0.194
+G1 X2.500 Y0.199
+G1 X3.000 Y0.182
+G1 X3.500 Y0.145
+G1 X4.000 Y0.091
+G1 X4.500 Y0.028
+G1 X5.000 Y-0.038
+G1 X5.500 Y-0.100
+G1 X6.000 Y-0.151
+G1 X6.500 Y-0.186
+G1 X7.000 Y-0.200
+G1 X7.500 Y-0.192
+G1 X8.000 Y-0.163
+G1 X8.500 Y-0.116
+G1 X9.000 Y-0.056
+G1 X9.500 Y0.010
+G1 X10.000 Y0.075
+G1 X10.500 Y0.131
+G1 X11.000 Y0.173
+G1 X11.500 Y0.197
+G1 X12.000 Y0.198
+G1 X12.500 Y0.177
+G1 X13.000 Y0.138
+G1 X13.500 Y0.082
+G1 X14.000 Y0.018
+G1 X14.500 Y-0.048
+G1 X15.000 Y-0.109
+G1 X15.500 Y-0.158
+G1 X16.000 Y-0.189
+G1 X16.500 Y-0.200
+G1 X17.000 Y-0.189
+G1 X17.500 Y-0.157
+G1 X18.000 Y-0.107
+G1 X18.500 Y-0.046
+G1 X19.000 Y0.020
+G1 X19.500 Y0.084
+G1 X20.000 Y0.139
+G1 X20.500 Y0.178
+G1 X21.000 Y0.198
+G1 X21.500 Y0.196
+G1 X22.000 Y0.173
+G1 X22.500 Y0.130
+G1 X23.000 Y0.073
+G1 X23.500 Y0.008
+G1 X24.000 Y-0.058
+G1 X24.500 Y-0.117
+G1 X25.000 Y-0.164
+G1 X25.500 Y-0.192
+G1 X26.000 Y-0.200
+G1 X26.500 Y-0.185
+G1 X27.000 Y-0.150
+G1 X27.500 Y-0.099
+G1 X28.000 Y-0.036
+G1 X28.500 Y0.030
+G1 X29.000 Y0.093
+G1 X29.500 Y0.146
+G0 Z5.000
+G0 X0.000 Y-3.000
+M5
+G0 X0 Y0
+M2
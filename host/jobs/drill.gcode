@@ -0,0 +1,49 @@
+(drill - bolt circle with G81, grid with G83 pecking)
+G21 G90 G17 G98
+G0 Z10.000
+M3 S8000
+G81 R2.000 Z-4.000 F120 X30.000 Y0.000
+X26.651 Y12.500
+X17.500 Y21.651
+X5.000 Y25.000
+X-7.500 Y21.651
+X-16.651 Y12.500
+X-20.000 Y0.000
+X-16.651 Y-12.500
+X-7.500 Y-21.651
+X5.000 Y-25.000
+X17.500 Y-21.651
+X26.651 Y-12.500
+G80
+G83 R2.000 Z-12.000 Q3.000 F100 X-20.000 Y-20.000
+X-15.000 Y-20.000
+X-10.000 Y-20.000
+X-5.000 Y-20.000
+X0.000 Y-20.000
+X-20.000 Y-15.000
+X-15.000 Y-15.000
+X-10.000 Y-15.000
+X-5.000 Y-15.000
+X0.000 Y-15.000
+X-20.000 Y-10.000
+X-15.000 Y-10.000
+X-10.000 Y-10.000
+X-5.000 Y-10.000
+X0.000 Y-10.000
+X-20.000 Y-5.000
+X-15.000 Y-5.000
+X-10.000 Y-5.000
+X-5.000 Y-5.000
+X0.000 Y-5.000
+X-20.000 Y0.000
+X-15.000 Y0.000
+X-10.000 Y0.000
+X-5.000 Y0.000
+X0.000 Y0.000
+G80
+G82 X0 Y0 R1.000 Z-2.000 P0.250 F80
+G80
+M5
+G0 Z10.000
+G0 X0 Y0
+M2
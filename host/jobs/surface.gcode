@@ -0,0 +1,3329 @@
+(surface - raster over a dome, 0.5 mm stepover)
+G21 G90
+G0 Z5.0000
+G0 X-20.0000 Y-20.0000
+G1 Z0.0000 F300
+F900
+G1 X-20.0000 Y-20.0000 Z-10.0000
+G1 X-19.5000 Y-20.0000 Z-10.0000
+G1 X-19.0000 Y-20.0000 Z-10.0000
+G1 X-18.5000 Y-20.0000 Z-10.0000
+G1 X-18.0000 Y-20.0000 Z-10.0000
+G1 X-17.5000 Y-20.0000 Z-10.0000
+G1 X-17.0000 Y-20.0000 Z-10.0000
+G1 X-16.5000 Y-20.0000 Z-10.0000
+G1 X-16.0000 Y-20.0000 Z-10.0000
+G1 X-15.5000 Y-20.0000 Z-10.0000
+G1 X-15.0000 Y-20.0000 Z-10.0000
+G1 X-14.5000 Y-20.0000 Z-9.2319
+G1 X-14.0000 Y-20.0000 Z-8.9230
+G1 X-13.5000 Y-20.0000 Z-8.6923
+G1 X-13.0000 Y-20.0000 Z-8.5033
+G1 X-12.5000 Y-20.0000 Z-8.3417
+G1 X-12.0000 Y-20.0000 Z-8.2000
+G1 X-11.5000 Y-20.0000 Z-8.0739
+G1 X-11.0000 Y-20.0000 Z-7.9604
+G1 X-10.5000 Y-20.0000 Z-7.8576
+G1 X-10.0000 Y-20.0000 Z-7.7639
+G1 X-9.5000 Y-20.0000 Z-7.6784
+G1 X-9.0000 Y-20.0000 Z-7.6000
+G1 X-8.5000 Y-20.0000 Z-7.5282
+G1 X-8.0000 Y-20.0000 Z-7.4623
+G1 X-7.5000 Y-20.0000 Z-7.4019
+G1 X-7.0000 Y-20.0000 Z-7.3467
+G1 X-6.5000 Y-20.0000 Z-7.2963
+G1 X-6.0000 Y-20.0000 Z-7.2505
+G1 X-5.5000 Y-20.0000 Z-7.2089
+G1 X-5.0000 Y-20.0000 Z-7.1716
+G1 X-4.5000 Y-20.0000 Z-7.1382
+G1 X-4.0000 Y-20.0000 Z-7.1086
+G1 X-3.5000 Y-20.0000 Z-7.0828
+G1 X-3.0000 Y-20.0000 Z-7.0606
+G1 X-2.5000 Y-20.0000 Z-7.0420
+G1 X-2.0000 Y-20.0000 Z-7.0268
+G1 X-1.5000 Y-20.0000 Z-7.0150
+G1 X-1.0000 Y-20.0000 Z-7.0067
+G1 X-0.5000 Y-20.0000 Z-7.0017
+G1 X0.0000 Y-20.0000 Z-7.0000
+G1 X0.5000 Y-20.0000 Z-7.0017
+G1 X1.0000 Y-20.0000 Z-7.0067
+G1 X1.5000 Y-20.0000 Z-7.0150
+G1 X2.0000 Y-20.0000 Z-7.0268
+G1 X2.5000 Y-20.0000 Z-7.0420
+G1 X3.0000 Y-20.0000 Z-7.0606
+G1 X3.5000 Y-20.0000 Z-7.0828
+G1 X4.0000 Y-20.0000 Z-7.1086
+G1 X4.5000 Y-20.0000 Z-7.1382
+G1 X5.0000 Y-20.0000 Z-7.1716
+G1 X5.5000 Y-20.0000 Z-7.2089
+G1 X6.0000 Y-20.0000 Z-7.2505
+G1 X6.5000 Y-20.0000 Z-7.2963
+G1 X7.0000 Y-20.0000 Z-7.3467
+G1 X7.5000 Y-20.0000 Z-7.4019
+G1 X8.0000 Y-20.0000 Z-7.4623
+G1 X8.5000 Y-20.0000 Z-7.5282
+G1 X9.0000 Y-20.0000 Z-7.6000
+G1 X9.5000 Y-20.0000 Z-7.6784
+G1 X10.0000 Y-20.0000 Z-7.7639
+G1 X10.5000 Y-20.0000 Z-7.8576
+G1 X11.0000 Y-20.0000 Z-7.9604
+G1 X11.5000 Y-20.0000 Z-8.0739
+G1 X12.0000 Y-20.0000 Z-8.2000
+G1 X12.5000 Y-20.0000 Z-8.3417
+G1 X13.0000 Y-20.0000 Z-8.5033
+G1 X13.5000 Y-20.0000 Z-8.6923
+G1 X14.0000 Y-20.0000 Z-8.9230
+G1 X14.5000 Y-20.0000 Z-9.2319
+G1 X15.0000 Y-20.0000 Z-10.0000
+G1 X15.5000 Y-20.0000 Z-10.0000
+G1 X16.0000 Y-20.0000 Z-10.0000
+G1 X16.5000 Y-20.0000 Z-10.0000
+G1 X17.0000 Y-20.0000 Z-10.0000
+G1 X17.5000 Y-20.0000 Z-10.0000
+G1 X18.0000 Y-20.0000 Z-10.0000
+G1 X18.5000 Y-20.0000 Z-10.0000
+G1 X19.0000 Y-20.0000 Z-10.0000
+G1 X19.5000 Y-20.0000 Z-10.0000
+G1 X20.0000 Y-20.0000 Z-10.0000
+G1 X20.0000 Y-19.0000 Z-10.0000
+G1 X19.5000 Y-19.0000 Z-10.0000
+G1 X19.0000 Y-19.0000 Z-10.0000
+G1 X18.5000 Y-19.0000 Z-10.0000
+G1 X18.0000 Y-19.0000 Z-10.0000
+G1 X17.5000 Y-19.0000 Z-10.0000
+G1 X17.0000 Y-19.0000 Z-10.0000
+G1 X16.5000 Y-19.0000 Z-10.0000
+G1 X16.0000 Y-19.0000 Z-9.4343
+G1 X15.5000 Y-19.0000 Z-9.0253
+G1 X15.0000 Y-19.0000 Z-8.7510
+G1 X14.5000 Y-19.0000 Z-8.5337
+G1 X14.0000 Y-19.0000 Z-8.3508
+G1 X13.5000 Y-19.0000 Z-8.1917
+G1 X13.0000 Y-19.0000 Z-8.0506
+G1 X12.5000 Y-19.0000 Z-7.9239
+G1 X12.0000 Y-19.0000 Z-7.8091
+G1 X11.5000 Y-19.0000 Z-7.7044
+G1 X11.0000 Y-19.0000 Z-7.6083
+G1 X10.5000 Y-19.0000 Z-7.5201
+G1 X10.0000 Y-19.0000 Z-7.4388
+G1 X9.5000 Y-19.0000 Z-7.3637
+G1 X9.0000 Y-19.0000 Z-7.2945
+G1 X8.5000 Y-19.0000 Z-7.2305
+G1 X8.0000 Y-19.0000 Z-7.1716
+G1 X7.5000 Y-19.0000 Z-7.1173
+G1 X7.0000 Y-19.0000 Z-7.0674
+G1 X6.5000 Y-19.0000 Z-7.0217
+G1 X6.0000 Y-19.0000 Z-6.9801
+G1 X5.5000 Y-19.0000 Z-6.9422
+G1 X5.0000 Y-19.0000 Z-6.9081
+G1 X4.5000 Y-19.0000 Z-6.8775
+G1 X4.0000 Y-19.0000 Z-6.8504
+G1 X3.5000 Y-19.0000 Z-6.8267
+G1 X3.0000 Y-19.0000 Z-6.8063
+G1 X2.5000 Y-19.0000 Z-6.7891
+G1 X2.0000 Y-19.0000 Z-6.7751
+G1 X1.5000 Y-19.0000 Z-6.7643
+G1 X1.0000 Y-19.0000 Z-6.7565
+G1 X0.5000 Y-19.0000 Z-6.7519
+G1 X0.0000 Y-19.0000 Z-6.7504
+G1 X-0.5000 Y-19.0000 Z-6.7519
+G1 X-1.0000 Y-19.0000 Z-6.7565
+G1 X-1.5000 Y-19.0000 Z-6.7643
+G1 X-2.0000 Y-19.0000 Z-6.7751
+G1 X-2.5000 Y-19.0000 Z-6.7891
+G1 X-3.0000 Y-19.0000 Z-6.8063
+G1 X-3.5000 Y-19.0000 Z-6.8267
+G1 X-4.0000 Y-19.0000 Z-6.8504
+G1 X-4.5000 Y-19.0000 Z-6.8775
+G1 X-5.0000 Y-19.0000 Z-6.9081
+G1 X-5.5000 Y-19.0000 Z-6.9422
+G1 X-6.0000 Y-19.0000 Z-6.9801
+G1 X-6.5000 Y-19.0000 Z-7.0217
+G1 X-7.0000 Y-19.0000 Z-7.0674
+G1 X-7.5000 Y-19.0000 Z-7.1173
+G1 X-8.0000 Y-19.0000 Z-7.1716
+G1 X-8.5000 Y-19.0000 Z-7.2305
+G1 X-9.0000 Y-19.0000 Z-7.2945
+G1 X-9.5000 Y-19.0000 Z-7.3637
+G1 X-10.0000 Y-19.0000 Z-7.4388
+G1 X-10.5000 Y-19.0000 Z-7.5201
+G1 X-11.0000 Y-19.0000 Z-7.6083
+G1 X-11.5000 Y-19.0000 Z-7.7044
+G1 X-12.0000 Y-19.0000 Z-7.8091
+G1 X-12.5000 Y-19.0000 Z-7.9239
+G1 X-13.0000 Y-19.0000 Z-8.0506
+G1 X-13.5000 Y-19.0000 Z-8.1917
+G1 X-14.0000 Y-19.0000 Z-8.3508
+G1 X-14.5000 Y-19.0000 Z-8.5337
+G1 X-15.0000 Y-19.0000 Z-8.7510
+G1 X-15.5000 Y-19.0000 Z-9.0253
+G1 X-16.0000 Y-19.0000 Z-9.4343
+G1 X-16.5000 Y-19.0000 Z-10.0000
+G1 X-17.0000 Y-19.0000 Z-10.0000
+G1 X-17.5000 Y-19.0000 Z-10.0000
+G1 X-18.0000 Y-19.0000 Z-10.0000
+G1 X-18.5000 Y-19.0000 Z-10.0000
+G1 X-19.0000 Y-19.0000 Z-10.0000
+G1 X-19.5000 Y-19.0000 Z-10.0000
+G1 X-20.0000 Y-19.0000 Z-10.0000
+G1 X-20.0000 Y-18.0000 Z-10.0000
+G1 X-19.5000 Y-18.0000 Z-10.0000
+G1 X-19.0000 Y-18.0000 Z-10.0000
+G1 X-18.5000 Y-18.0000 Z-10.0000
+G1 X-18.0000 Y-18.0000 Z-10.0000
+G1 X-17.5000 Y-18.0000 Z-10.0000
+G1 X-17.0000 Y-18.0000 Z-9.3072
+G1 X-16.5000 Y-18.0000 Z-8.9276
+G1 X-16.0000 Y-18.0000 Z-8.6584
+G1 X-15.5000 Y-18.0000 Z-8.4412
+G1 X-15.0000 Y-18.0000 Z-8.2564
+G1 X-14.5000 Y-18.0000 Z-8.0947
+G1 X-14.0000 Y-18.0000 Z-7.9506
+G1 X-13.5000 Y-18.0000 Z-7.8206
+G1 X-13.0000 Y-18.0000 Z-7.7022
+G1 X-12.5000 Y-18.0000 Z-7.5938
+G1 X-12.0000 Y-18.0000 Z-7.4940
+G1 X-11.5000 Y-18.0000 Z-7.4019
+G1 X-11.0000 Y-18.0000 Z-7.3167
+G1 X-10.5000 Y-18.0000 Z-7.2378
+G1 X-10.0000 Y-18.0000 Z-7.1645
+G1 X-9.5000 Y-18.0000 Z-7.0966
+G1 X-9.0000 Y-18.0000 Z-7.0335
+G1 X-8.5000 Y-18.0000 Z-6.9751
+G1 X-8.0000 Y-18.0000 Z-6.9210
+G1 X-7.5000 Y-18.0000 Z-6.8711
+G1 X-7.0000 Y-18.0000 Z-6.8251
+G1 X-6.5000 Y-18.0000 Z-6.7829
+G1 X-6.0000 Y-18.0000 Z-6.7442
+G1 X-5.5000 Y-18.0000 Z-6.7091
+G1 X-5.0000 Y-18.0000 Z-6.6774
+G1 X-4.5000 Y-18.0000 Z-6.6489
+G1 X-4.0000 Y-18.0000 Z-6.6236
+G1 X-3.5000 Y-18.0000 Z-6.6015
+G1 X-3.0000 Y-18.0000 Z-6.5824
+G1 X-2.5000 Y-18.0000 Z-6.5663
+G1 X-2.0000 Y-18.0000 Z-6.5533
+G1 X-1.5000 Y-18.0000 Z-6.5431
+G1 X-1.0000 Y-18.0000 Z-6.5359
+G1 X-0.5000 Y-18.0000 Z-6.5316
+G1 X0.0000 Y-18.0000 Z-6.5301
+G1 X0.5000 Y-18.0000 Z-6.5316
+G1 X1.0000 Y-18.0000 Z-6.5359
+G1 X1.5000 Y-18.0000 Z-6.5431
+G1 X2.0000 Y-18.0000 Z-6.5533
+G1 X2.5000 Y-18.0000 Z-6.5663
+G1 X3.0000 Y-18.0000 Z-6.5824
+G1 X3.5000 Y-18.0000 Z-6.6015
+G1 X4.0000 Y-18.0000 Z-6.6236
+G1 X4.5000 Y-18.0000 Z-6.6489
+G1 X5.0000 Y-18.0000 Z-6.6774
+G1 X5.5000 Y-18.0000 Z-6.7091
+G1 X6.0000 Y-18.0000 Z-6.7442
+G1 X6.5000 Y-18.0000 Z-6.7829
+G1 X7.0000 Y-18.0000 Z-6.8251
+G1 X7.5000 Y-18.0000 Z-6.8711
+G1 X8.0000 Y-18.0000 Z-6.9210
+G1 X8.5000 Y-18.0000 Z-6.9751
+G1 X9.0000 Y-18.0000 Z-7.0335
+G1 X9.5000 Y-18.0000 Z-7.0966
+G1 X10.0000 Y-18.0000 Z-7.1645
+G1 X10.5000 Y-18.0000 Z-7.2378
+G1 X11.0000 Y-18.0000 Z-7.3167
+G1 X11.5000 Y-18.0000 Z-7.4019
+G1 X12.0000 Y-18.0000 Z-7.4940
+G1 X12.5000 Y-18.0000 Z-7.5938
+G1 X13.0000 Y-18.0000 Z-7.7022
+G1 X13.5000 Y-18.0000 Z-7.8206
+G1 X14.0000 Y-18.0000 Z-7.9506
+G1 X14.5000 Y-18.0000 Z-8.0947
+G1 X15.0000 Y-18.0000 Z-8.2564
+G1 X15.5000 Y-18.0000 Z-8.4412
+G1 X16.0000 Y-18.0000 Z-8.6584
+G1 X16.5000 Y-18.0000 Z-8.9276
+G1 X17.0000 Y-18.0000 Z-9.3072
+G1 X17.5000 Y-18.0000 Z-10.0000
+G1 X18.0000 Y-18.0000 Z-10.0000
+G1 X18.5000 Y-18.0000 Z-10.0000
+G1 X19.0000 Y-18.0000 Z-10.0000
+G1 X19.5000 Y-18.0000 Z-10.0000
+G1 X20.0000 Y-18.0000 Z-10.0000
+G1 X20.0000 Y-17.0000 Z-10.0000
+G1 X19.5000 Y-17.0000 Z-10.0000
+G1 X19.0000 Y-17.0000 Z-10.0000
+G1 X18.5000 Y-17.0000 Z-10.0000
+G1 X18.0000 Y-17.0000 Z-9.3072
+G1 X17.5000 Y-17.0000 Z-8.9091
+G1 X17.0000 Y-17.0000 Z-8.6289
+G1 X16.5000 Y-17.0000 Z-8.4031
+G1 X16.0000 Y-17.0000 Z-8.2111
+G1 X15.5000 Y-17.0000 Z-8.0430
+G1 X15.0000 Y-17.0000 Z-7.8929
+G1 X14.5000 Y-17.0000 Z-7.7572
+G1 X14.0000 Y-17.0000 Z-7.6336
+G1 X13.5000 Y-17.0000 Z-7.5201
+G1 X13.0000 Y-17.0000 Z-7.4154
+G1 X12.5000 Y-17.0000 Z-7.3186
+G1 X12.0000 Y-17.0000 Z-7.2287
+G1 X11.5000 Y-17.0000 Z-7.1452
+G1 X11.0000 Y-17.0000 Z-7.0674
+G1 X10.5000 Y-17.0000 Z-6.9950
+G1 X10.0000 Y-17.0000 Z-6.9275
+G1 X9.5000 Y-17.0000 Z-6.8647
+G1 X9.0000 Y-17.0000 Z-6.8063
+G1 X8.5000 Y-17.0000 Z-6.7519
+G1 X8.0000 Y-17.0000 Z-6.7015
+G1 X7.5000 Y-17.0000 Z-6.6549
+G1 X7.0000 Y-17.0000 Z-6.6118
+G1 X6.5000 Y-17.0000 Z-6.5722
+G1 X6.0000 Y-17.0000 Z-6.5359
+G1 X5.5000 Y-17.0000 Z-6.5029
+G1 X5.0000 Y-17.0000 Z-6.4730
+G1 X4.5000 Y-17.0000 Z-6.4461
+G1 X4.0000 Y-17.0000 Z-6.4223
+G1 X3.5000 Y-17.0000 Z-6.4014
+G1 X3.0000 Y-17.0000 Z-6.3834
+G1 X2.5000 Y-17.0000 Z-6.3682
+G1 X2.0000 Y-17.0000 Z-6.3558
+G1 X1.5000 Y-17.0000 Z-6.3462
+G1 X1.0000 Y-17.0000 Z-6.3394
+G1 X0.5000 Y-17.0000 Z-6.3353
+G1 X0.0000 Y-17.0000 Z-6.3339
+G1 X-0.5000 Y-17.0000 Z-6.3353
+G1 X-1.0000 Y-17.0000 Z-6.3394
+G1 X-1.5000 Y-17.0000 Z-6.3462
+G1 X-2.0000 Y-17.0000 Z-6.3558
+G1 X-2.5000 Y-17.0000 Z-6.3682
+G1 X-3.0000 Y-17.0000 Z-6.3834
+G1 X-3.5000 Y-17.0000 Z-6.4014
+G1 X-4.0000 Y-17.0000 Z-6.4223
+G1 X-4.5000 Y-17.0000 Z-6.4461
+G1 X-5.0000 Y-17.0000 Z-6.4730
+G1 X-5.5000 Y-17.0000 Z-6.5029
+G1 X-6.0000 Y-17.0000 Z-6.5359
+G1 X-6.5000 Y-17.0000 Z-6.5722
+G1 X-7.0000 Y-17.0000 Z-6.6118
+G1 X-7.5000 Y-17.0000 Z-6.6549
+G1 X-8.0000 Y-17.0000 Z-6.7015
+G1 X-8.5000 Y-17.0000 Z-6.7519
+G1 X-9.0000 Y-17.0000 Z-6.8063
+G1 X-9.5000 Y-17.0000 Z-6.8647
+G1 X-10.0000 Y-17.0000 Z-6.9275
+G1 X-10.5000 Y-17.0000 Z-6.9950
+G1 X-11.0000 Y-17.0000 Z-7.0674
+G1 X-11.5000 Y-17.0000 Z-7.1452
+G1 X-12.0000 Y-17.0000 Z-7.2287
+G1 X-12.5000 Y-17.0000 Z-7.3186
+G1 X-13.0000 Y-17.0000 Z-7.4154
+G1 X-13.5000 Y-17.0000 Z-7.5201
+G1 X-14.0000 Y-17.0000 Z-7.6336
+G1 X-14.5000 Y-17.0000 Z-7.7572
+G1 X-15.0000 Y-17.0000 Z-7.8929
+G1 X-15.5000 Y-17.0000 Z-8.0430
+G1 X-16.0000 Y-17.0000 Z-8.2111
+G1 X-16.5000 Y-17.0000 Z-8.4031
+G1 X-17.0000 Y-17.0000 Z-8.6289
+G1 X-17.5000 Y-17.0000 Z-8.9091
+G1 X-18.0000 Y-17.0000 Z-9.3072
+G1 X-18.5000 Y-17.0000 Z-10.0000
+G1 X-19.0000 Y-17.0000 Z-10.0000
+G1 X-19.5000 Y-17.0000 Z-10.0000
+G1 X-20.0000 Y-17.0000 Z-10.0000
+G1 X-20.0000 Y-16.0000 Z-10.0000
+G1 X-19.5000 Y-16.0000 Z-10.0000
+G1 X-19.0000 Y-16.0000 Z-9.4343
+G1 X-18.5000 Y-16.0000 Z-8.9656
+G1 X-18.0000 Y-16.0000 Z-8.6584
+G1 X-17.5000 Y-16.0000 Z-8.4157
+G1 X-17.0000 Y-16.0000 Z-8.2111
+G1 X-16.5000 Y-16.0000 Z-8.0328
+G1 X-16.0000 Y-16.0000 Z-7.8740
+G1 X-15.5000 Y-16.0000 Z-7.7306
+G1 X-15.0000 Y-16.0000 Z-7.6000
+G1 X-14.5000 Y-16.0000 Z-7.4801
+G1 X-14.0000 Y-16.0000 Z-7.3694
+G1 X-13.5000 Y-16.0000 Z-7.2669
+G1 X-13.0000 Y-16.0000 Z-7.1716
+G1 X-12.5000 Y-16.0000 Z-7.0828
+G1 X-12.0000 Y-16.0000 Z-7.0000
+G1 X-11.5000 Y-16.0000 Z-6.9227
+G1 X-11.0000 Y-16.0000 Z-6.8504
+G1 X-10.5000 Y-16.0000 Z-6.7829
+G1 X-10.0000 Y-16.0000 Z-6.7198
+G1 X-9.5000 Y-16.0000 Z-6.6608
+G1 X-9.0000 Y-16.0000 Z-6.6059
+G1 X-8.5000 Y-16.0000 Z-6.5547
+G1 X-8.0000 Y-16.0000 Z-6.5072
+G1 X-7.5000 Y-16.0000 Z-6.4631
+G1 X-7.0000 Y-16.0000 Z-6.4223
+G1 X-6.5000 Y-16.0000 Z-6.3848
+G1 X-6.0000 Y-16.0000 Z-6.3503
+G1 X-5.5000 Y-16.0000 Z-6.3190
+G1 X-5.0000 Y-16.0000 Z-6.2906
+G1 X-4.5000 Y-16.0000 Z-6.2650
+G1 X-4.0000 Y-16.0000 Z-6.2423
+G1 X-3.5000 Y-16.0000 Z-6.2224
+G1 X-3.0000 Y-16.0000 Z-6.2053
+G1 X-2.5000 Y-16.0000 Z-6.1908
+G1 X-2.0000 Y-16.0000 Z-6.1790
+G1 X-1.5000 Y-16.0000 Z-6.1699
+G1 X-1.0000 Y-16.0000 Z-6.1633
+G1 X-0.5000 Y-16.0000 Z-6.1594
+G1 X0.0000 Y-16.0000 Z-6.1581
+G1 X0.5000 Y-16.0000 Z-6.1594
+G1 X1.0000 Y-16.0000 Z-6.1633
+G1 X1.5000 Y-16.0000 Z-6.1699
+G1 X2.0000 Y-16.0000 Z-6.1790
+G1 X2.5000 Y-16.0000 Z-6.1908
+G1 X3.0000 Y-16.0000 Z-6.2053
+G1 X3.5000 Y-16.0000 Z-6.2224
+G1 X4.0000 Y-16.0000 Z-6.2423
+G1 X4.5000 Y-16.0000 Z-6.2650
+G1 X5.0000 Y-16.0000 Z-6.2906
+G1 X5.5000 Y-16.0000 Z-6.3190
+G1 X6.0000 Y-16.0000 Z-6.3503
+G1 X6.5000 Y-16.0000 Z-6.3848
+G1 X7.0000 Y-16.0000 Z-6.4223
+G1 X7.5000 Y-16.0000 Z-6.4631
+G1 X8.0000 Y-16.0000 Z-6.5072
+G1 X8.5000 Y-16.0000 Z-6.5547
+G1 X9.0000 Y-16.0000 Z-6.6059
+G1 X9.5000 Y-16.0000 Z-6.6608
+G1 X10.0000 Y-16.0000 Z-6.7198
+G1 X10.5000 Y-16.0000 Z-6.7829
+G1 X11.0000 Y-16.0000 Z-6.8504
+G1 X11.5000 Y-16.0000 Z-6.9227
+G1 X12.0000 Y-16.0000 Z-7.0000
+G1 X12.5000 Y-16.0000 Z-7.0828
+G1 X13.0000 Y-16.0000 Z-7.1716
+G1 X13.5000 Y-16.0000 Z-7.2669
+G1 X14.0000 Y-16.0000 Z-7.3694
+G1 X14.5000 Y-16.0000 Z-7.4801
+G1 X15.0000 Y-16.0000 Z-7.6000
+G1 X15.5000 Y-16.0000 Z-7.7306
+G1 X16.0000 Y-16.0000 Z-7.8740
+G1 X16.5000 Y-16.0000 Z-8.0328
+G1 X17.0000 Y-16.0000 Z-8.2111
+G1 X17.5000 Y-16.0000 Z-8.4157
+G1 X18.0000 Y-16.0000 Z-8.6584
+G1 X18.5000 Y-16.0000 Z-8.9656
+G1 X19.0000 Y-16.0000 Z-9.4343
+G1 X19.5000 Y-16.0000 Z-10.0000
+G1 X20.0000 Y-16.0000 Z-10.0000
+G1 X20.0000 Y-15.0000 Z-10.0000
+G1 X19.5000 Y-15.0000 Z-9.1112
+G1 X19.0000 Y-15.0000 Z-8.7510
+G1 X18.5000 Y-15.0000 Z-8.4801
+G1 X18.0000 Y-15.0000 Z-8.2564
+G1 X17.5000 Y-15.0000 Z-8.0635
+G1 X17.0000 Y-15.0000 Z-7.8929
+G1 X16.5000 Y-15.0000 Z-7.7395
+G1 X16.0000 Y-15.0000 Z-7.6000
+G1 X15.5000 Y-15.0000 Z-7.4722
+G1 X15.0000 Y-15.0000 Z-7.3542
+G1 X14.5000 Y-15.0000 Z-7.2450
+G1 X14.0000 Y-15.0000 Z-7.1434
+G1 X13.5000 Y-15.0000 Z-7.0487
+G1 X13.0000 Y-15.0000 Z-6.9603
+G1 X12.5000 Y-15.0000 Z-6.8775
+G1 X12.0000 Y-15.0000 Z-6.8000
+G1 X11.5000 Y-15.0000 Z-6.7274
+G1 X11.0000 Y-15.0000 Z-6.6593
+G1 X10.5000 Y-15.0000 Z-6.5956
+G1 X10.0000 Y-15.0000 Z-6.5359
+G1 X9.5000 Y-15.0000 Z-6.4801
+G1 X9.0000 Y-15.0000 Z-6.4279
+G1 X8.5000 Y-15.0000 Z-6.3792
+G1 X8.0000 Y-15.0000 Z-6.3339
+G1 X7.5000 Y-15.0000 Z-6.2919
+G1 X7.0000 Y-15.0000 Z-6.2530
+G1 X6.5000 Y-15.0000 Z-6.2171
+G1 X6.0000 Y-15.0000 Z-6.1842
+G1 X5.5000 Y-15.0000 Z-6.1542
+G1 X5.0000 Y-15.0000 Z-6.1270
+G1 X4.5000 Y-15.0000 Z-6.1026
+G1 X4.0000 Y-15.0000 Z-6.0808
+G1 X3.5000 Y-15.0000 Z-6.0617
+G1 X3.0000 Y-15.0000 Z-6.0453
+G1 X2.5000 Y-15.0000 Z-6.0314
+G1 X2.0000 Y-15.0000 Z-6.0201
+G1 X1.5000 Y-15.0000 Z-6.0113
+G1 X1.0000 Y-15.0000 Z-6.0050
+G1 X0.5000 Y-15.0000 Z-6.0013
+G1 X0.0000 Y-15.0000 Z-6.0000
+G1 X-0.5000 Y-15.0000 Z-6.0013
+G1 X-1.0000 Y-15.0000 Z-6.0050
+G1 X-1.5000 Y-15.0000 Z-6.0113
+G1 X-2.0000 Y-15.0000 Z-6.0201
+G1 X-2.5000 Y-15.0000 Z-6.0314
+G1 X-3.0000 Y-15.0000 Z-6.0453
+G1 X-3.5000 Y-15.0000 Z-6.0617
+G1 X-4.0000 Y-15.0000 Z-6.0808
+G1 X-4.5000 Y-15.0000 Z-6.1026
+G1 X-5.0000 Y-15.0000 Z-6.1270
+G1 X-5.5000 Y-15.0000 Z-6.1542
+G1 X-6.0000 Y-15.0000 Z-6.1842
+G1 X-6.5000 Y-15.0000 Z-6.2171
+G1 X-7.0000 Y-15.0000 Z-6.2530
+G1 X-7.5000 Y-15.0000 Z-6.2919
+G1 X-8.0000 Y-15.0000 Z-6.3339
+G1 X-8.5000 Y-15.0000 Z-6.3792
+G1 X-9.0000 Y-15.0000 Z-6.4279
+G1 X-9.5000 Y-15.0000 Z-6.4801
+G1 X-10.0000 Y-15.0000 Z-6.5359
+G1 X-10.5000 Y-15.0000 Z-6.5956
+G1 X-11.0000 Y-15.0000 Z-6.6593
+G1 X-11.5000 Y-15.0000 Z-6.7274
+G1 X-12.0000 Y-15.0000 Z-6.8000
+G1 X-12.5000 Y-15.0000 Z-6.8775
+G1 X-13.0000 Y-15.0000 Z-6.9603
+G1 X-13.5000 Y-15.0000 Z-7.0487
+G1 X-14.0000 Y-15.0000 Z-7.1434
+G1 X-14.5000 Y-15.0000 Z-7.2450
+G1 X-15.0000 Y-15.0000 Z-7.3542
+G1 X-15.5000 Y-15.0000 Z-7.4722
+G1 X-16.0000 Y-15.0000 Z-7.6000
+G1 X-16.5000 Y-15.0000 Z-7.7395
+G1 X-17.0000 Y-15.0000 Z-7.8929
+G1 X-17.5000 Y-15.0000 Z-8.0635
+G1 X-18.0000 Y-15.0000 Z-8.2564
+G1 X-18.5000 Y-15.0000 Z-8.4801
+G1 X-19.0000 Y-15.0000 Z-8.7510
+G1 X-19.5000 Y-15.0000 Z-9.1112
+G1 X-20.0000 Y-15.0000 Z-10.0000
+G1 X-20.0000 Y-14.0000 Z-8.9230
+G1 X-19.5000 Y-14.0000 Z-8.6036
+G1 X-19.0000 Y-14.0000 Z-8.3508
+G1 X-18.5000 Y-14.0000 Z-8.1372
+G1 X-18.0000 Y-14.0000 Z-7.9506
+G1 X-17.5000 Y-14.0000 Z-7.7841
+G1 X-17.0000 Y-14.0000 Z-7.6336
+G1 X-16.5000 Y-14.0000 Z-7.4960
+G1 X-16.0000 Y-14.0000 Z-7.3694
+G1 X-15.5000 Y-14.0000 Z-7.2523
+G1 X-15.0000 Y-14.0000 Z-7.1434
+G1 X-14.5000 Y-14.0000 Z-7.0420
+G1 X-14.0000 Y-14.0000 Z-6.9471
+G1 X-13.5000 Y-14.0000 Z-6.8583
+G1 X-13.0000 Y-14.0000 Z-6.7751
+G1 X-12.5000 Y-14.0000 Z-6.6970
+G1 X-12.0000 Y-14.0000 Z-6.6236
+G1 X-11.5000 Y-14.0000 Z-6.5547
+G1 X-11.0000 Y-14.0000 Z-6.4900
+G1 X-10.5000 Y-14.0000 Z-6.4293
+G1 X-10.0000 Y-14.0000 Z-6.3723
+G1 X-9.5000 Y-14.0000 Z-6.3190
+G1 X-9.0000 Y-14.0000 Z-6.2690
+G1 X-8.5000 Y-14.0000 Z-6.2224
+G1 X-8.0000 Y-14.0000 Z-6.1790
+G1 X-7.5000 Y-14.0000 Z-6.1387
+G1 X-7.0000 Y-14.0000 Z-6.1013
+G1 X-6.5000 Y-14.0000 Z-6.0668
+G1 X-6.0000 Y-14.0000 Z-6.0352
+G1 X-5.5000 Y-14.0000 Z-6.0063
+G1 X-5.0000 Y-14.0000 Z-5.9800
+G1 X-4.5000 Y-14.0000 Z-5.9565
+G1 X-4.0000 Y-14.0000 Z-5.9355
+G1 X-3.5000 Y-14.0000 Z-5.9171
+G1 X-3.0000 Y-14.0000 Z-5.9012
+G1 X-2.5000 Y-14.0000 Z-5.8878
+G1 X-2.0000 Y-14.0000 Z-5.8769
+G1 X-1.5000 Y-14.0000 Z-5.8684
+G1 X-1.0000 Y-14.0000 Z-5.8624
+G1 X-0.5000 Y-14.0000 Z-5.8587
+G1 X0.0000 Y-14.0000 Z-5.8575
+G1 X0.5000 Y-14.0000 Z-5.8587
+G1 X1.0000 Y-14.0000 Z-5.8624
+G1 X1.5000 Y-14.0000 Z-5.8684
+G1 X2.0000 Y-14.0000 Z-5.8769
+G1 X2.5000 Y-14.0000 Z-5.8878
+G1 X3.0000 Y-14.0000 Z-5.9012
+G1 X3.5000 Y-14.0000 Z-5.9171
+G1 X4.0000 Y-14.0000 Z-5.9355
+G1 X4.5000 Y-14.0000 Z-5.9565
+G1 X5.0000 Y-14.0000 Z-5.9800
+G1 X5.5000 Y-14.0000 Z-6.0063
+G1 X6.0000 Y-14.0000 Z-6.0352
+G1 X6.5000 Y-14.0000 Z-6.0668
+G1 X7.0000 Y-14.0000 Z-6.1013
+G1 X7.5000 Y-14.0000 Z-6.1387
+G1 X8.0000 Y-14.0000 Z-6.1790
+G1 X8.5000 Y-14.0000 Z-6.2224
+G1 X9.0000 Y-14.0000 Z-6.2690
+G1 X9.5000 Y-14.0000 Z-6.3190
+G1 X10.0000 Y-14.0000 Z-6.3723
+G1 X10.5000 Y-14.0000 Z-6.4293
+G1 X11.0000 Y-14.0000 Z-6.4900
+G1 X11.5000 Y-14.0000 Z-6.5547
+G1 X12.0000 Y-14.0000 Z-6.6236
+G1 X12.5000 Y-14.0000 Z-6.6970
+G1 X13.0000 Y-14.0000 Z-6.7751
+G1 X13.5000 Y-14.0000 Z-6.8583
+G1 X14.0000 Y-14.0000 Z-6.9471
+G1 X14.5000 Y-14.0000 Z-7.0420
+G1 X15.0000 Y-14.0000 Z-7.1434
+G1 X15.5000 Y-14.0000 Z-7.2523
+G1 X16.0000 Y-14.0000 Z-7.3694
+G1 X16.5000 Y-14.0000 Z-7.4960
+G1 X17.0000 Y-14.0000 Z-7.6336
+G1 X17.5000 Y-14.0000 Z-7.7841
+G1 X18.0000 Y-14.0000 Z-7.9506
+G1 X18.5000 Y-14.0000 Z-8.1372
+G1 X19.0000 Y-14.0000 Z-8.3508
+G1 X19.5000 Y-14.0000 Z-8.6036
+G1 X20.0000 Y-14.0000 Z-8.9230
+G1 X20.0000 Y-13.0000 Z-8.5033
+G1 X19.5000 Y-13.0000 Z-8.2593
+G1 X19.0000 Y-13.0000 Z-8.0506
+G1 X18.5000 Y-13.0000 Z-7.8669
+G1 X18.0000 Y-13.0000 Z-7.7022
+G1 X17.5000 Y-13.0000 Z-7.5526
+G1 X17.0000 Y-13.0000 Z-7.4154
+G1 X16.5000 Y-13.0000 Z-7.2889
+G1 X16.0000 Y-13.0000 Z-7.1716
+G1 X15.5000 Y-13.0000 Z-7.0623
+G1 X15.0000 Y-13.0000 Z-6.9603
+G1 X14.5000 Y-13.0000 Z-6.8647
+G1 X14.0000 Y-13.0000 Z-6.7751
+G1 X13.5000 Y-13.0000 Z-6.6909
+G1 X13.0000 Y-13.0000 Z-6.6118
+G1 X12.5000 Y-13.0000 Z-6.5373
+G1 X12.0000 Y-13.0000 Z-6.4673
+G1 X11.5000 Y-13.0000 Z-6.4014
+G1 X11.0000 Y-13.0000 Z-6.3394
+G1 X10.5000 Y-13.0000 Z-6.2811
+G1 X10.0000 Y-13.0000 Z-6.2264
+G1 X9.5000 Y-13.0000 Z-6.1751
+G1 X9.0000 Y-13.0000 Z-6.1270
+G1 X8.5000 Y-13.0000 Z-6.0821
+G1 X8.0000 Y-13.0000 Z-6.0402
+G1 X7.5000 Y-13.0000 Z-6.0013
+G1 X7.0000 Y-13.0000 Z-5.9652
+G1 X6.5000 Y-13.0000 Z-5.9318
+G1 X6.0000 Y-13.0000 Z-5.9012
+G1 X5.5000 Y-13.0000 Z-5.8733
+G1 X5.0000 Y-13.0000 Z-5.8479
+G1 X4.5000 Y-13.0000 Z-5.8251
+G1 X4.0000 Y-13.0000 Z-5.8048
+G1 X3.5000 Y-13.0000 Z-5.7869
+G1 X3.0000 Y-13.0000 Z-5.7715
+G1 X2.5000 Y-13.0000 Z-5.7585
+G1 X2.0000 Y-13.0000 Z-5.7479
+G1 X1.5000 Y-13.0000 Z-5.7397
+G1 X1.0000 Y-13.0000 Z-5.7339
+G1 X0.5000 Y-13.0000 Z-5.7303
+G1 X0.0000 Y-13.0000 Z-5.7292
+G1 X-0.5000 Y-13.0000 Z-5.7303
+G1 X-1.0000 Y-13.0000 Z-5.7339
+G1 X-1.5000 Y-13.0000 Z-5.7397
+G1 X-2.0000 Y-13.0000 Z-5.7479
+G1 X-2.5000 Y-13.0000 Z-5.7585
+G1 X-3.0000 Y-13.0000 Z-5.7715
+G1 X-3.5000 Y-13.0000 Z-5.7869
+G1 X-4.0000 Y-13.0000 Z-5.8048
+G1 X-4.5000 Y-13.0000 Z-5.8251
+G1 X-5.0000 Y-13.0000 Z-5.8479
+G1 X-5.5000 Y-13.0000 Z-5.8733
+G1 X-6.0000 Y-13.0000 Z-5.9012
+G1 X-6.5000 Y-13.0000 Z-5.9318
+G1 X-7.0000 Y-13.0000 Z-5.9652
+G1 X-7.5000 Y-13.0000 Z-6.0013
+G1 X-8.0000 Y-13.0000 Z-6.0402
+G1 X-8.5000 Y-13.0000 Z-6.0821
+G1 X-9.0000 Y-13.0000 Z-6.1270
+G1 X-9.5000 Y-13.0000 Z-6.1751
+G1 X-10.0000 Y-13.0000 Z-6.2264
+G1 X-10.5000 Y-13.0000 Z-6.2811
+G1 X-11.0000 Y-13.0000 Z-6.3394
+G1 X-11.5000 Y-13.0000 Z-6.4014
+G1 X-12.0000 Y-13.0000 Z-6.4673
+G1 X-12.5000 Y-13.0000 Z-6.5373
+G1 X-13.0000 Y-13.0000 Z-6.6118
+G1 X-13.5000 Y-13.0000 Z-6.6909
+G1 X-14.0000 Y-13.0000 Z-6.7751
+G1 X-14.5000 Y-13.0000 Z-6.8647
+G1 X-15.0000 Y-13.0000 Z-6.9603
+G1 X-15.5000 Y-13.0000 Z-7.0623
+G1 X-16.0000 Y-13.0000 Z-7.1716
+G1 X-16.5000 Y-13.0000 Z-7.2889
+G1 X-17.0000 Y-13.0000 Z-7.4154
+G1 X-17.5000 Y-13.0000 Z-7.5526
+G1 X-18.0000 Y-13.0000 Z-7.7022
+G1 X-18.5000 Y-13.0000 Z-7.8669
+G1 X-19.0000 Y-13.0000 Z-8.0506
+G1 X-19.5000 Y-13.0000 Z-8.2593
+G1 X-20.0000 Y-13.0000 Z-8.5033
+G1 X-20.0000 Y-12.0000 Z-8.2000
+G1 X-19.5000 Y-12.0000 Z-7.9925
+G1 X-19.0000 Y-12.0000 Z-7.8091
+G1 X-18.5000 Y-12.0000 Z-7.6442
+G1 X-18.0000 Y-12.0000 Z-7.4940
+G1 X-17.5000 Y-12.0000 Z-7.3561
+G1 X-17.0000 Y-12.0000 Z-7.2287
+G1 X-16.5000 Y-12.0000 Z-7.1104
+G1 X-16.0000 Y-12.0000 Z-7.0000
+G1 X-15.5000 Y-12.0000 Z-6.8968
+G1 X-15.0000 Y-12.0000 Z-6.8000
+G1 X-14.5000 Y-12.0000 Z-6.7091
+G1 X-14.0000 Y-12.0000 Z-6.6236
+G1 X-13.5000 Y-12.0000 Z-6.5431
+G1 X-13.0000 Y-12.0000 Z-6.4673
+G1 X-12.5000 Y-12.0000 Z-6.3958
+G1 X-12.0000 Y-12.0000 Z-6.3285
+G1 X-11.5000 Y-12.0000 Z-6.2650
+G1 X-11.0000 Y-12.0000 Z-6.2053
+G1 X-10.5000 Y-12.0000 Z-6.1490
+G1 X-10.0000 Y-12.0000 Z-6.0962
+G1 X-9.5000 Y-12.0000 Z-6.0465
+G1 X-9.0000 Y-12.0000 Z-6.0000
+G1 X-8.5000 Y-12.0000 Z-5.9565
+G1 X-8.0000 Y-12.0000 Z-5.9159
+G1 X-7.5000 Y-12.0000 Z-5.8781
+G1 X-7.0000 Y-12.0000 Z-5.8431
+G1 X-6.5000 Y-12.0000 Z-5.8107
+G1 X-6.0000 Y-12.0000 Z-5.7810
+G1 X-5.5000 Y-12.0000 Z-5.7538
+G1 X-5.0000 Y-12.0000 Z-5.7292
+G1 X-4.5000 Y-12.0000 Z-5.7070
+G1 X-4.0000 Y-12.0000 Z-5.6872
+G1 X-3.5000 Y-12.0000 Z-5.6699
+G1 X-3.0000 Y-12.0000 Z-5.6549
+G1 X-2.5000 Y-12.0000 Z-5.6422
+G1 X-2.0000 Y-12.0000 Z-5.6319
+G1 X-1.5000 Y-12.0000 Z-5.6239
+G1 X-1.0000 Y-12.0000 Z-5.6182
+G1 X-0.5000 Y-12.0000 Z-5.6148
+G1 X0.0000 Y-12.0000 Z-5.6137
+G1 X0.5000 Y-12.0000 Z-5.6148
+G1 X1.0000 Y-12.0000 Z-5.6182
+G1 X1.5000 Y-12.0000 Z-5.6239
+G1 X2.0000 Y-12.0000 Z-5.6319
+G1 X2.5000 Y-12.0000 Z-5.6422
+G1 X3.0000 Y-12.0000 Z-5.6549
+G1 X3.5000 Y-12.0000 Z-5.6699
+G1 X4.0000 Y-12.0000 Z-5.6872
+G1 X4.5000 Y-12.0000 Z-5.7070
+G1 X5.0000 Y-12.0000 Z-5.7292
+G1 X5.5000 Y-12.0000 Z-5.7538
+G1 X6.0000 Y-12.0000 Z-5.7810
+G1 X6.5000 Y-12.0000 Z-5.8107
+G1 X7.0000 Y-12.0000 Z-5.8431
+G1 X7.5000 Y-12.0000 Z-5.8781
+G1 X8.0000 Y-12.0000 Z-5.9159
+G1 X8.5000 Y-12.0000 Z-5.9565
+G1 X9.0000 Y-12.0000 Z-6.0000
+G1 X9.5000 Y-12.0000 Z-6.0465
+G1 X10.0000 Y-12.0000 Z-6.0962
+G1 X10.5000 Y-12.0000 Z-6.1490
+G1 X11.0000 Y-12.0000 Z-6.2053
+G1 X11.5000 Y-12.0000 Z-6.2650
+G1 X12.0000 Y-12.0000 Z-6.3285
+G1 X12.5000 Y-12.0000 Z-6.3958
+G1 X13.0000 Y-12.0000 Z-6.4673
+G1 X13.5000 Y-12.0000 Z-6.5431
+G1 X14.0000 Y-12.0000 Z-6.6236
+G1 X14.5000 Y-12.0000 Z-6.7091
+G1 X15.0000 Y-12.0000 Z-6.8000
+G1 X15.5000 Y-12.0000 Z-6.8968
+G1 X16.0000 Y-12.0000 Z-7.0000
+G1 X16.5000 Y-12.0000 Z-7.1104
+G1 X17.0000 Y-12.0000 Z-7.2287
+G1 X17.5000 Y-12.0000 Z-7.3561
+G1 X18.0000 Y-12.0000 Z-7.4940
+G1 X18.5000 Y-12.0000 Z-7.6442
+G1 X19.0000 Y-12.0000 Z-7.8091
+G1 X19.5000 Y-12.0000 Z-7.9925
+G1 X20.0000 Y-12.0000 Z-8.2000
+G1 X20.0000 Y-11.0000 Z-7.9604
+G1 X19.5000 Y-11.0000 Z-7.7751
+G1 X19.0000 Y-11.0000 Z-7.6083
+G1 X18.5000 Y-11.0000 Z-7.4564
+G1 X18.0000 Y-11.0000 Z-7.3167
+G1 X17.5000 Y-11.0000 Z-7.1875
+G1 X17.0000 Y-11.0000 Z-7.0674
+G1 X16.5000 Y-11.0000 Z-6.9553
+G1 X16.0000 Y-11.0000 Z-6.8504
+G1 X15.5000 Y-11.0000 Z-6.7519
+G1 X15.0000 Y-11.0000 Z-6.6593
+G1 X14.5000 Y-11.0000 Z-6.5722
+G1 X14.0000 Y-11.0000 Z-6.4900
+G1 X13.5000 Y-11.0000 Z-6.4125
+G1 X13.0000 Y-11.0000 Z-6.3394
+G1 X12.5000 Y-11.0000 Z-6.2704
+G1 X12.0000 Y-11.0000 Z-6.2053
+G1 X11.5000 Y-11.0000 Z-6.1438
+G1 X11.0000 Y-11.0000 Z-6.0859
+G1 X10.5000 Y-11.0000 Z-6.0314
+G1 X10.0000 Y-11.0000 Z-5.9800
+G1 X9.5000 Y-11.0000 Z-5.9318
+G1 X9.0000 Y-11.0000 Z-5.8866
+G1 X8.5000 Y-11.0000 Z-5.8443
+G1 X8.0000 Y-11.0000 Z-5.8048
+G1 X7.5000 Y-11.0000 Z-5.7680
+G1 X7.0000 Y-11.0000 Z-5.7339
+G1 X6.5000 Y-11.0000 Z-5.7023
+G1 X6.0000 Y-11.0000 Z-5.6733
+G1 X5.5000 Y-11.0000 Z-5.6468
+G1 X5.0000 Y-11.0000 Z-5.6228
+G1 X4.5000 Y-11.0000 Z-5.6011
+G1 X4.0000 Y-11.0000 Z-5.5819
+G1 X3.5000 Y-11.0000 Z-5.5649
+G1 X3.0000 Y-11.0000 Z-5.5503
+G1 X2.5000 Y-11.0000 Z-5.5379
+G1 X2.0000 Y-11.0000 Z-5.5279
+G1 X1.5000 Y-11.0000 Z-5.5200
+G1 X1.0000 Y-11.0000 Z-5.5145
+G1 X0.5000 Y-11.0000 Z-5.5111
+G1 X0.0000 Y-11.0000 Z-5.5100
+G1 X-0.5000 Y-11.0000 Z-5.5111
+G1 X-1.0000 Y-11.0000 Z-5.5145
+G1 X-1.5000 Y-11.0000 Z-5.5200
+G1 X-2.0000 Y-11.0000 Z-5.5279
+G1 X-2.5000 Y-11.0000 Z-5.5379
+G1 X-3.0000 Y-11.0000 Z-5.5503
+G1 X-3.5000 Y-11.0000 Z-5.5649
+G1 X-4.0000 Y-11.0000 Z-5.5819
+G1 X-4.5000 Y-11.0000 Z-5.6011
+G1 X-5.0000 Y-11.0000 Z-5.6228
+G1 X-5.5000 Y-11.0000 Z-5.6468
+G1 X-6.0000 Y-11.0000 Z-5.6733
+G1 X-6.5000 Y-11.0000 Z-5.7023
+G1 X-7.0000 Y-11.0000 Z-5.7339
+G1 X-7.5000 Y-11.0000 Z-5.7680
+G1 X-8.0000 Y-11.0000 Z-5.8048
+G1 X-8.5000 Y-11.0000 Z-5.8443
+G1 X-9.0000 Y-11.0000 Z-5.8866
+G1 X-9.5000 Y-11.0000 Z-5.9318
+G1 X-10.0000 Y-11.0000 Z-5.9800
+G1 X-10.5000 Y-11.0000 Z-6.0314
+G1 X-11.0000 Y-11.0000 Z-6.0859
+G1 X-11.5000 Y-11.0000 Z-6.1438
+G1 X-12.0000 Y-11.0000 Z-6.2053
+G1 X-12.5000 Y-11.0000 Z-6.2704
+G1 X-13.0000 Y-11.0000 Z-6.3394
+G1 X-13.5000 Y-11.0000 Z-6.4125
+G1 X-14.0000 Y-11.0000 Z-6.4900
+G1 X-14.5000 Y-11.0000 Z-6.5722
+G1 X-15.0000 Y-11.0000 Z-6.6593
+G1 X-15.5000 Y-11.0000 Z-6.7519
+G1 X-16.0000 Y-11.0000 Z-6.8504
+G1 X-16.5000 Y-11.0000 Z-6.9553
+G1 X-17.0000 Y-11.0000 Z-7.0674
+G1 X-17.5000 Y-11.0000 Z-7.1875
+G1 X-18.0000 Y-11.0000 Z-7.3167
+G1 X-18.5000 Y-11.0000 Z-7.4564
+G1 X-19.0000 Y-11.0000 Z-7.6083
+G1 X-19.5000 Y-11.0000 Z-7.7751
+G1 X-20.0000 Y-11.0000 Z-7.9604
+G1 X-20.0000 Y-10.0000 Z-7.7639
+G1 X-19.5000 Y-10.0000 Z-7.5938
+G1 X-19.0000 Y-10.0000 Z-7.4388
+G1 X-18.5000 Y-10.0000 Z-7.2963
+G1 X-18.0000 Y-10.0000 Z-7.1645
+G1 X-17.5000 Y-10.0000 Z-7.0420
+G1 X-17.0000 Y-10.0000 Z-6.9275
+G1 X-16.5000 Y-10.0000 Z-6.8204
+G1 X-16.0000 Y-10.0000 Z-6.7198
+G1 X-15.5000 Y-10.0000 Z-6.6251
+G1 X-15.0000 Y-10.0000 Z-6.5359
+G1 X-14.5000 Y-10.0000 Z-6.4518
+G1 X-14.0000 Y-10.0000 Z-6.3723
+G1 X-13.5000 Y-10.0000 Z-6.2973
+G1 X-13.0000 Y-10.0000 Z-6.2264
+G1 X-12.5000 Y-10.0000 Z-6.1594
+G1 X-12.0000 Y-10.0000 Z-6.0962
+G1 X-11.5000 Y-10.0000 Z-6.0364
+G1 X-11.0000 Y-10.0000 Z-5.9800
+G1 X-10.5000 Y-10.0000 Z-5.9269
+G1 X-10.0000 Y-10.0000 Z-5.8769
+G1 X-9.5000 Y-10.0000 Z-5.8299
+G1 X-9.0000 Y-10.0000 Z-5.7857
+G1 X-8.5000 Y-10.0000 Z-5.7444
+G1 X-8.0000 Y-10.0000 Z-5.7058
+G1 X-7.5000 Y-10.0000 Z-5.6699
+G1 X-7.0000 Y-10.0000 Z-5.6365
+G1 X-6.5000 Y-10.0000 Z-5.6057
+G1 X-6.0000 Y-10.0000 Z-5.5773
+G1 X-5.5000 Y-10.0000 Z-5.5514
+G1 X-5.0000 Y-10.0000 Z-5.5279
+G1 X-4.5000 Y-10.0000 Z-5.5067
+G1 X-4.0000 Y-10.0000 Z-5.4878
+G1 X-3.5000 Y-10.0000 Z-5.4712
+G1 X-3.0000 Y-10.0000 Z-5.4569
+G1 X-2.5000 Y-10.0000 Z-5.4448
+G1 X-2.0000 Y-10.0000 Z-5.4349
+G1 X-1.5000 Y-10.0000 Z-5.4273
+G1 X-1.0000 Y-10.0000 Z-5.4218
+G1 X-0.5000 Y-10.0000 Z-5.4185
+G1 X0.0000 Y-10.0000 Z-5.4174
+G1 X0.5000 Y-10.0000 Z-5.4185
+G1 X1.0000 Y-10.0000 Z-5.4218
+G1 X1.5000 Y-10.0000 Z-5.4273
+G1 X2.0000 Y-10.0000 Z-5.4349
+G1 X2.5000 Y-10.0000 Z-5.4448
+G1 X3.0000 Y-10.0000 Z-5.4569
+G1 X3.5000 Y-10.0000 Z-5.4712
+G1 X4.0000 Y-10.0000 Z-5.4878
+G1 X4.5000 Y-10.0000 Z-5.5067
+G1 X5.0000 Y-10.0000 Z-5.5279
+G1 X5.5000 Y-10.0000 Z-5.5514
+G1 X6.0000 Y-10.0000 Z-5.5773
+G1 X6.5000 Y-10.0000 Z-5.6057
+G1 X7.0000 Y-10.0000 Z-5.6365
+G1 X7.5000 Y-10.0000 Z-5.6699
+G1 X8.0000 Y-10.0000 Z-5.7058
+G1 X8.5000 Y-10.0000 Z-5.7444
+G1 X9.0000 Y-10.0000 Z-5.7857
+G1 X9.5000 Y-10.0000 Z-5.8299
+G1 X10.0000 Y-10.0000 Z-5.8769
+G1 X10.5000 Y-10.0000 Z-5.9269
+G1 X11.0000 Y-10.0000 Z-5.9800
+G1 X11.5000 Y-10.0000 Z-6.0364
+G1 X12.0000 Y-10.0000 Z-6.0962
+G1 X12.5000 Y-10.0000 Z-6.1594
+G1 X13.0000 Y-10.0000 Z-6.2264
+G1 X13.5000 Y-10.0000 Z-6.2973
+G1 X14.0000 Y-10.0000 Z-6.3723
+G1 X14.5000 Y-10.0000 Z-6.4518
+G1 X15.0000 Y-10.0000 Z-6.5359
+G1 X15.5000 Y-10.0000 Z-6.6251
+G1 X16.0000 Y-10.0000 Z-6.7198
+G1 X16.5000 Y-10.0000 Z-6.8204
+G1 X17.0000 Y-10.0000 Z-6.9275
+G1 X17.5000 Y-10.0000 Z-7.0420
+G1 X18.0000 Y-10.0000 Z-7.1645
+G1 X18.5000 Y-10.0000 Z-7.2963
+G1 X19.0000 Y-10.0000 Z-7.4388
+G1 X19.5000 Y-10.0000 Z-7.5938
+G1 X20.0000 Y-10.0000 Z-7.7639
+G1 X20.0000 Y-9.0000 Z-7.6000
+G1 X19.5000 Y-9.0000 Z-7.4407
+G1 X19.0000 Y-9.0000 Z-7.2945
+G1 X18.5000 Y-9.0000 Z-7.1592
+G1 X18.0000 Y-9.0000 Z-7.0335
+G1 X17.5000 Y-9.0000 Z-6.9162
+G1 X17.0000 Y-9.0000 Z-6.8063
+G1 X16.5000 Y-9.0000 Z-6.7030
+G1 X16.0000 Y-9.0000 Z-6.6059
+G1 X15.5000 Y-9.0000 Z-6.5143
+G1 X15.0000 Y-9.0000 Z-6.4279
+G1 X14.5000 Y-9.0000 Z-6.3462
+G1 X14.0000 Y-9.0000 Z-6.2690
+G1 X13.5000 Y-9.0000 Z-6.1961
+G1 X13.0000 Y-9.0000 Z-6.1270
+G1 X12.5000 Y-9.0000 Z-6.0617
+G1 X12.0000 Y-9.0000 Z-6.0000
+G1 X11.5000 Y-9.0000 Z-5.9417
+G1 X11.0000 Y-9.0000 Z-5.8866
+G1 X10.5000 Y-9.0000 Z-5.8347
+G1 X10.0000 Y-9.0000 Z-5.7857
+G1 X9.5000 Y-9.0000 Z-5.7397
+G1 X9.0000 Y-9.0000 Z-5.6965
+G1 X8.5000 Y-9.0000 Z-5.6560
+G1 X8.0000 Y-9.0000 Z-5.6182
+G1 X7.5000 Y-9.0000 Z-5.5830
+G1 X7.0000 Y-9.0000 Z-5.5503
+G1 X6.5000 Y-9.0000 Z-5.5200
+G1 X6.0000 Y-9.0000 Z-5.4922
+G1 X5.5000 Y-9.0000 Z-5.4668
+G1 X5.0000 Y-9.0000 Z-5.4437
+G1 X4.5000 Y-9.0000 Z-5.4229
+G1 X4.0000 Y-9.0000 Z-5.4043
+G1 X3.5000 Y-9.0000 Z-5.3881
+G1 X3.0000 Y-9.0000 Z-5.3740
+G1 X2.5000 Y-9.0000 Z-5.3621
+G1 X2.0000 Y-9.0000 Z-5.3524
+G1 X1.5000 Y-9.0000 Z-5.3449
+G1 X1.0000 Y-9.0000 Z-5.3395
+G1 X0.5000 Y-9.0000 Z-5.3363
+G1 X0.0000 Y-9.0000 Z-5.3352
+G1 X-0.5000 Y-9.0000 Z-5.3363
+G1 X-1.0000 Y-9.0000 Z-5.3395
+G1 X-1.5000 Y-9.0000 Z-5.3449
+G1 X-2.0000 Y-9.0000 Z-5.3524
+G1 X-2.5000 Y-9.0000 Z-5.3621
+G1 X-3.0000 Y-9.0000 Z-5.3740
+G1 X-3.5000 Y-9.0000 Z-5.3881
+G1 X-4.0000 Y-9.0000 Z-5.4043
+G1 X-4.5000 Y-9.0000 Z-5.4229
+G1 X-5.0000 Y-9.0000 Z-5.4437
+G1 X-5.5000 Y-9.0000 Z-5.4668
+G1 X-6.0000 Y-9.0000 Z-5.4922
+G1 X-6.5000 Y-9.0000 Z-5.5200
+G1 X-7.0000 Y-9.0000 Z-5.5503
+G1 X-7.5000 Y-9.0000 Z-5.5830
+G1 X-8.0000 Y-9.0000 Z-5.6182
+G1 X-8.5000 Y-9.0000 Z-5.6560
+G1 X-9.0000 Y-9.0000 Z-5.6965
+G1 X-9.5000 Y-9.0000 Z-5.7397
+G1 X-10.0000 Y-9.0000 Z-5.7857
+G1 X-10.5000 Y-9.0000 Z-5.8347
+G1 X-11.0000 Y-9.0000 Z-5.8866
+G1 X-11.5000 Y-9.0000 Z-5.9417
+G1 X-12.0000 Y-9.0000 Z-6.0000
+G1 X-12.5000 Y-9.0000 Z-6.0617
+G1 X-13.0000 Y-9.0000 Z-6.1270
+G1 X-13.5000 Y-9.0000 Z-6.1961
+G1 X-14.0000 Y-9.0000 Z-6.2690
+G1 X-14.5000 Y-9.0000 Z-6.3462
+G1 X-15.0000 Y-9.0000 Z-6.4279
+G1 X-15.5000 Y-9.0000 Z-6.5143
+G1 X-16.0000 Y-9.0000 Z-6.6059
+G1 X-16.5000 Y-9.0000 Z-6.7030
+G1 X-17.0000 Y-9.0000 Z-6.8063
+G1 X-17.5000 Y-9.0000 Z-6.9162
+G1 X-18.0000 Y-9.0000 Z-7.0335
+G1 X-18.5000 Y-9.0000 Z-7.1592
+G1 X-19.0000 Y-9.0000 Z-7.2945
+G1 X-19.5000 Y-9.0000 Z-7.4407
+G1 X-20.0000 Y-9.0000 Z-7.6000
+G1 X-20.0000 Y-8.0000 Z-7.4623
+G1 X-19.5000 Y-8.0000 Z-7.3111
+G1 X-19.0000 Y-8.0000 Z-7.1716
+G1 X-18.5000 Y-8.0000 Z-7.0420
+G1 X-18.0000 Y-8.0000 Z-6.9210
+G1 X-17.5000 Y-8.0000 Z-6.8078
+G1 X-17.0000 Y-8.0000 Z-6.7015
+G1 X-16.5000 Y-8.0000 Z-6.6015
+G1 X-16.0000 Y-8.0000 Z-6.5072
+G1 X-15.5000 Y-8.0000 Z-6.4181
+G1 X-15.0000 Y-8.0000 Z-6.3339
+G1 X-14.5000 Y-8.0000 Z-6.2543
+G1 X-14.0000 Y-8.0000 Z-6.1790
+G1 X-13.5000 Y-8.0000 Z-6.1077
+G1 X-13.0000 Y-8.0000 Z-6.0402
+G1 X-12.5000 Y-8.0000 Z-5.9763
+G1 X-12.0000 Y-8.0000 Z-5.9159
+G1 X-11.5000 Y-8.0000 Z-5.8587
+G1 X-11.0000 Y-8.0000 Z-5.8048
+G1 X-10.5000 Y-8.0000 Z-5.7538
+G1 X-10.0000 Y-8.0000 Z-5.7058
+G1 X-9.5000 Y-8.0000 Z-5.6606
+G1 X-9.0000 Y-8.0000 Z-5.6182
+G1 X-8.5000 Y-8.0000 Z-5.5785
+G1 X-8.0000 Y-8.0000 Z-5.5413
+G1 X-7.5000 Y-8.0000 Z-5.5067
+G1 X-7.0000 Y-8.0000 Z-5.4745
+G1 X-6.5000 Y-8.0000 Z-5.4448
+G1 X-6.0000 Y-8.0000 Z-5.4174
+G1 X-5.5000 Y-8.0000 Z-5.3924
+G1 X-5.0000 Y-8.0000 Z-5.3697
+G1 X-4.5000 Y-8.0000 Z-5.3492
+G1 X-4.0000 Y-8.0000 Z-5.3310
+G1 X-3.5000 Y-8.0000 Z-5.3149
+G1 X-3.0000 Y-8.0000 Z-5.3011
+G1 X-2.5000 Y-8.0000 Z-5.2894
+G1 X-2.0000 Y-8.0000 Z-5.2798
+G1 X-1.5000 Y-8.0000 Z-5.2724
+G1 X-1.0000 Y-8.0000 Z-5.2671
+G1 X-0.5000 Y-8.0000 Z-5.2640
+G1 X0.0000 Y-8.0000 Z-5.2629
+G1 X0.5000 Y-8.0000 Z-5.2640
+G1 X1.0000 Y-8.0000 Z-5.2671
+G1 X1.5000 Y-8.0000 Z-5.2724
+G1 X2.0000 Y-8.0000 Z-5.2798
+G1 X2.5000 Y-8.0000 Z-5.2894
+G1 X3.0000 Y-8.0000 Z-5.3011
+G1 X3.5000 Y-8.0000 Z-5.3149
+G1 X4.0000 Y-8.0000 Z-5.3310
+G1 X4.5000 Y-8.0000 Z-5.3492
+G1 X5.0000 Y-8.0000 Z-5.3697
+G1 X5.5000 Y-8.0000 Z-5.3924
+G1 X6.0000 Y-8.0000 Z-5.4174
+G1 X6.5000 Y-8.0000 Z-5.4448
+G1 X7.0000 Y-8.0000 Z-5.4745
+G1 X7.5000 Y-8.0000 Z-5.5067
+G1 X8.0000 Y-8.0000 Z-5.5413
+G1 X8.5000 Y-8.0000 Z-5.5785
+G1 X9.0000 Y-8.0000 Z-5.6182
+G1 X9.5000 Y-8.0000 Z-5.6606
+G1 X10.0000 Y-8.0000 Z-5.7058
+G1 X10.5000 Y-8.0000 Z-5.7538
+G1 X11.0000 Y-8.0000 Z-5.8048
+G1 X11.5000 Y-8.0000 Z-5.8587
+G1 X12.0000 Y-8.0000 Z-5.9159
+G1 X12.5000 Y-8.0000 Z-5.9763
+G1 X13.0000 Y-8.0000 Z-6.0402
+G1 X13.5000 Y-8.0000 Z-6.1077
+G1 X14.0000 Y-8.0000 Z-6.1790
+G1 X14.5000 Y-8.0000 Z-6.2543
+G1 X15.0000 Y-8.0000 Z-6.3339
+G1 X15.5000 Y-8.0000 Z-6.4181
+G1 X16.0000 Y-8.0000 Z-6.5072
+G1 X16.5000 Y-8.0000 Z-6.6015
+G1 X17.0000 Y-8.0000 Z-6.7015
+G1 X17.5000 Y-8.0000 Z-6.8078
+G1 X18.0000 Y-8.0000 Z-6.9210
+G1 X18.5000 Y-8.0000 Z-7.0420
+G1 X19.0000 Y-8.0000 Z-7.1716
+G1 X19.5000 Y-8.0000 Z-7.3111
+G1 X20.0000 Y-8.0000 Z-7.4623
+G1 X20.0000 Y-7.0000 Z-7.3467
+G1 X19.5000 Y-7.0000 Z-7.2018
+G1 X19.0000 Y-7.0000 Z-7.0674
+G1 X18.5000 Y-7.0000 Z-6.9422
+G1 X18.0000 Y-7.0000 Z-6.8251
+G1 X17.5000 Y-7.0000 Z-6.7152
+G1 X17.0000 Y-7.0000 Z-6.6118
+G1 X16.5000 Y-7.0000 Z-6.5143
+G1 X16.0000 Y-7.0000 Z-6.4223
+G1 X15.5000 Y-7.0000 Z-6.3353
+G1 X15.0000 Y-7.0000 Z-6.2530
+G1 X14.5000 Y-7.0000 Z-6.1751
+G1 X14.0000 Y-7.0000 Z-6.1013
+G1 X13.5000 Y-7.0000 Z-6.0314
+G1 X13.0000 Y-7.0000 Z-5.9652
+G1 X12.5000 Y-7.0000 Z-5.9024
+G1 X12.0000 Y-7.0000 Z-5.8431
+G1 X11.5000 Y-7.0000 Z-5.7869
+G1 X11.0000 Y-7.0000 Z-5.7339
+G1 X10.5000 Y-7.0000 Z-5.6838
+G1 X10.0000 Y-7.0000 Z-5.6365
+G1 X9.5000 Y-7.0000 Z-5.5921
+G1 X9.0000 Y-7.0000 Z-5.5503
+G1 X8.5000 Y-7.0000 Z-5.5111
+G1 X8.0000 Y-7.0000 Z-5.4745
+G1 X7.5000 Y-7.0000 Z-5.4404
+G1 X7.0000 Y-7.0000 Z-5.4087
+G1 X6.5000 Y-7.0000 Z-5.3794
+G1 X6.0000 Y-7.0000 Z-5.3524
+G1 X5.5000 Y-7.0000 Z-5.3277
+G1 X5.0000 Y-7.0000 Z-5.3053
+G1 X4.5000 Y-7.0000 Z-5.2851
+G1 X4.0000 Y-7.0000 Z-5.2671
+G1 X3.5000 Y-7.0000 Z-5.2513
+G1 X3.0000 Y-7.0000 Z-5.2376
+G1 X2.5000 Y-7.0000 Z-5.2261
+G1 X2.0000 Y-7.0000 Z-5.2167
+G1 X1.5000 Y-7.0000 Z-5.2094
+G1 X1.0000 Y-7.0000 Z-5.2042
+G1 X0.5000 Y-7.0000 Z-5.2010
+G1 X0.0000 Y-7.0000 Z-5.2000
+G1 X-0.5000 Y-7.0000 Z-5.2010
+G1 X-1.0000 Y-7.0000 Z-5.2042
+G1 X-1.5000 Y-7.0000 Z-5.2094
+G1 X-2.0000 Y-7.0000 Z-5.2167
+G1 X-2.5000 Y-7.0000 Z-5.2261
+G1 X-3.0000 Y-7.0000 Z-5.2376
+G1 X-3.5000 Y-7.0000 Z-5.2513
+G1 X-4.0000 Y-7.0000 Z-5.2671
+G1 X-4.5000 Y-7.0000 Z-5.2851
+G1 X-5.0000 Y-7.0000 Z-5.3053
+G1 X-5.5000 Y-7.0000 Z-5.3277
+G1 X-6.0000 Y-7.0000 Z-5.3524
+G1 X-6.5000 Y-7.0000 Z-5.3794
+G1 X-7.0000 Y-7.0000 Z-5.4087
+G1 X-7.5000 Y-7.0000 Z-5.4404
+G1 X-8.0000 Y-7.0000 Z-5.4745
+G1 X-8.5000 Y-7.0000 Z-5.5111
+G1 X-9.0000 Y-7.0000 Z-5.5503
+G1 X-9.5000 Y-7.0000 Z-5.5921
+G1 X-10.0000 Y-7.0000 Z-5.6365
+G1 X-10.5000 Y-7.0000 Z-5.6838
+G1 X-11.0000 Y-7.0000 Z-5.7339
+G1 X-11.5000 Y-7.0000 Z-5.7869
+G1 X-12.0000 Y-7.0000 Z-5.8431
+G1 X-12.5000 Y-7.0000 Z-5.9024
+G1 X-13.0000 Y-7.0000 Z-5.9652
+G1 X-13.5000 Y-7.0000 Z-6.0314
+G1 X-14.0000 Y-7.0000 Z-6.1013
+G1 X-14.5000 Y-7.0000 Z-6.1751
+G1 X-15.0000 Y-7.0000 Z-6.2530
+G1 X-15.5000 Y-7.0000 Z-6.3353
+G1 X-16.0000 Y-7.0000 Z-6.4223
+G1 X-16.5000 Y-7.0000 Z-6.5143
+G1 X-17.0000 Y-7.0000 Z-6.6118
+G1 X-17.5000 Y-7.0000 Z-6.7152
+G1 X-18.0000 Y-7.0000 Z-6.8251
+G1 X-18.5000 Y-7.0000 Z-6.9422
+G1 X-19.0000 Y-7.0000 Z-7.0674
+G1 X-19.5000 Y-7.0000 Z-7.2018
+G1 X-20.0000 Y-7.0000 Z-7.3467
+G1 X-20.0000 Y-6.0000 Z-7.2505
+G1 X-19.5000 Y-6.0000 Z-7.1104
+G1 X-19.0000 Y-6.0000 Z-6.9801
+G1 X-18.5000 Y-6.0000 Z-6.8583
+G1 X-18.0000 Y-6.0000 Z-6.7442
+G1 X-17.5000 Y-6.0000 Z-6.6370
+G1 X-17.0000 Y-6.0000 Z-6.5359
+G1 X-16.5000 Y-6.0000 Z-6.4405
+G1 X-16.0000 Y-6.0000 Z-6.3503
+G1 X-15.5000 Y-6.0000 Z-6.2650
+G1 X-15.0000 Y-6.0000 Z-6.1842
+G1 X-14.5000 Y-6.0000 Z-6.1077
+G1 X-14.0000 Y-6.0000 Z-6.0352
+G1 X-13.5000 Y-6.0000 Z-5.9664
+G1 X-13.0000 Y-6.0000 Z-5.9012
+G1 X-12.5000 Y-6.0000 Z-5.8395
+G1 X-12.0000 Y-6.0000 Z-5.7810
+G1 X-11.5000 Y-6.0000 Z-5.7257
+G1 X-11.0000 Y-6.0000 Z-5.6733
+G1 X-10.5000 Y-6.0000 Z-5.6239
+G1 X-10.0000 Y-6.0000 Z-5.5773
+G1 X-9.5000 Y-6.0000 Z-5.5335
+G1 X-9.0000 Y-6.0000 Z-5.4922
+G1 X-8.5000 Y-6.0000 Z-5.4536
+G1 X-8.0000 Y-6.0000 Z-5.4174
+G1 X-7.5000 Y-6.0000 Z-5.3837
+G1 X-7.0000 Y-6.0000 Z-5.3524
+G1 X-6.5000 Y-6.0000 Z-5.3235
+G1 X-6.0000 Y-6.0000 Z-5.2968
+G1 X-5.5000 Y-6.0000 Z-5.2724
+G1 X-5.0000 Y-6.0000 Z-5.2503
+G1 X-4.5000 Y-6.0000 Z-5.2303
+G1 X-4.0000 Y-6.0000 Z-5.2125
+G1 X-3.5000 Y-6.0000 Z-5.1969
+G1 X-3.0000 Y-6.0000 Z-5.1834
+G1 X-2.5000 Y-6.0000 Z-5.1720
+G1 X-2.0000 Y-6.0000 Z-5.1626
+G1 X-1.5000 Y-6.0000 Z-5.1554
+G1 X-1.0000 Y-6.0000 Z-5.1503
+G1 X-0.5000 Y-6.0000 Z-5.1472
+G1 X0.0000 Y-6.0000 Z-5.1461
+G1 X0.5000 Y-6.0000 Z-5.1472
+G1 X1.0000 Y-6.0000 Z-5.1503
+G1 X1.5000 Y-6.0000 Z-5.1554
+G1 X2.0000 Y-6.0000 Z-5.1626
+G1 X2.5000 Y-6.0000 Z-5.1720
+G1 X3.0000 Y-6.0000 Z-5.1834
+G1 X3.5000 Y-6.0000 Z-5.1969
+G1 X4.0000 Y-6.0000 Z-5.2125
+G1 X4.5000 Y-6.0000 Z-5.2303
+G1 X5.0000 Y-6.0000 Z-5.2503
+G1 X5.5000 Y-6.0000 Z-5.2724
+G1 X6.0000 Y-6.0000 Z-5.2968
+G1 X6.5000 Y-6.0000 Z-5.3235
+G1 X7.0000 Y-6.0000 Z-5.3524
+G1 X7.5000 Y-6.0000 Z-5.3837
+G1 X8.0000 Y-6.0000 Z-5.4174
+G1 X8.5000 Y-6.0000 Z-5.4536
+G1 X9.0000 Y-6.0000 Z-5.4922
+G1 X9.5000 Y-6.0000 Z-5.5335
+G1 X10.0000 Y-6.0000 Z-5.5773
+G1 X10.5000 Y-6.0000 Z-5.6239
+G1 X11.0000 Y-6.0000 Z-5.6733
+G1 X11.5000 Y-6.0000 Z-5.7257
+G1 X12.0000 Y-6.0000 Z-5.7810
+G1 X12.5000 Y-6.0000 Z-5.8395
+G1 X13.0000 Y-6.0000 Z-5.9012
+G1 X13.5000 Y-6.0000 Z-5.9664
+G1 X14.0000 Y-6.0000 Z-6.0352
+G1 X14.5000 Y-6.0000 Z-6.1077
+G1 X15.0000 Y-6.0000 Z-6.1842
+G1 X15.5000 Y-6.0000 Z-6.2650
+G1 X16.0000 Y-6.0000 Z-6.3503
+G1 X16.5000 Y-6.0000 Z-6.4405
+G1 X17.0000 Y-6.0000 Z-6.5359
+G1 X17.5000 Y-6.0000 Z-6.6370
+G1 X18.0000 Y-6.0000 Z-6.7442
+G1 X18.5000 Y-6.0000 Z-6.8583
+G1 X19.0000 Y-6.0000 Z-6.9801
+G1 X19.5000 Y-6.0000 Z-7.1104
+G1 X20.0000 Y-6.0000 Z-7.2505
+G1 X20.0000 Y-5.0000 Z-7.1716
+G1 X19.5000 Y-5.0000 Z-7.0352
+G1 X19.0000 Y-5.0000 Z-6.9081
+G1 X18.5000 Y-5.0000 Z-6.7891
+G1 X18.0000 Y-5.0000 Z-6.6774
+G1 X17.5000 Y-5.0000 Z-6.5722
+G1 X17.0000 Y-5.0000 Z-6.4730
+G1 X16.5000 Y-5.0000 Z-6.3792
+G1 X16.0000 Y-5.0000 Z-6.2906
+G1 X15.5000 Y-5.0000 Z-6.2066
+G1 X15.0000 Y-5.0000 Z-6.1270
+G1 X14.5000 Y-5.0000 Z-6.0516
+G1 X14.0000 Y-5.0000 Z-5.9800
+G1 X13.5000 Y-5.0000 Z-5.9122
+G1 X13.0000 Y-5.0000 Z-5.8479
+G1 X12.5000 Y-5.0000 Z-5.7869
+G1 X12.0000 Y-5.0000 Z-5.7292
+G1 X11.5000 Y-5.0000 Z-5.6745
+G1 X11.0000 Y-5.0000 Z-5.6228
+G1 X10.5000 Y-5.0000 Z-5.5739
+G1 X10.0000 Y-5.0000 Z-5.5279
+G1 X9.5000 Y-5.0000 Z-5.4845
+G1 X9.0000 Y-5.0000 Z-5.4437
+G1 X8.5000 Y-5.0000 Z-5.4054
+G1 X8.0000 Y-5.0000 Z-5.3697
+G1 X7.5000 Y-5.0000 Z-5.3363
+G1 X7.0000 Y-5.0000 Z-5.3053
+G1 X6.5000 Y-5.0000 Z-5.2767
+G1 X6.0000 Y-5.0000 Z-5.2503
+G1 X5.5000 Y-5.0000 Z-5.2261
+G1 X5.0000 Y-5.0000 Z-5.2042
+G1 X4.5000 Y-5.0000 Z-5.1844
+G1 X4.0000 Y-5.0000 Z-5.1668
+G1 X3.5000 Y-5.0000 Z-5.1513
+G1 X3.0000 Y-5.0000 Z-5.1379
+G1 X2.5000 Y-5.0000 Z-5.1266
+G1 X2.0000 Y-5.0000 Z-5.1174
+G1 X1.5000 Y-5.0000 Z-5.1102
+G1 X1.0000 Y-5.0000 Z-5.1051
+G1 X0.5000 Y-5.0000 Z-5.1020
+G1 X0.0000 Y-5.0000 Z-5.1010
+G1 X-0.5000 Y-5.0000 Z-5.1020
+G1 X-1.0000 Y-5.0000 Z-5.1051
+G1 X-1.5000 Y-5.0000 Z-5.1102
+G1 X-2.0000 Y-5.0000 Z-5.1174
+G1 X-2.5000 Y-5.0000 Z-5.1266
+G1 X-3.0000 Y-5.0000 Z-5.1379
+G1 X-3.5000 Y-5.0000 Z-5.1513
+G1 X-4.0000 Y-5.0000 Z-5.1668
+G1 X-4.5000 Y-5.0000 Z-5.1844
+G1 X-5.0000 Y-5.0000 Z-5.2042
+G1 X-5.5000 Y-5.0000 Z-5.2261
+G1 X-6.0000 Y-5.0000 Z-5.2503
+G1 X-6.5000 Y-5.0000 Z-5.2767
+G1 X-7.0000 Y-5.0000 Z-5.3053
+G1 X-7.5000 Y-5.0000 Z-5.3363
+G1 X-8.0000 Y-5.0000 Z-5.3697
+G1 X-8.5000 Y-5.0000 Z-5.4054
+G1 X-9.0000 Y-5.0000 Z-5.4437
+G1 X-9.5000 Y-5.0000 Z-5.4845
+G1 X-10.0000 Y-5.0000 Z-5.5279
+G1 X-10.5000 Y-5.0000 Z-5.5739
+G1 X-11.0000 Y-5.0000 Z-5.6228
+G1 X-11.5000 Y-5.0000 Z-5.6745
+G1 X-12.0000 Y-5.0000 Z-5.7292
+G1 X-12.5000 Y-5.0000 Z-5.7869
+G1 X-13.0000 Y-5.0000 Z-5.8479
+G1 X-13.5000 Y-5.0000 Z-5.9122
+G1 X-14.0000 Y-5.0000 Z-5.9800
+G1 X-14.5000 Y-5.0000 Z-6.0516
+G1 X-15.0000 Y-5.0000 Z-6.1270
+G1 X-15.5000 Y-5.0000 Z-6.2066
+G1 X-16.0000 Y-5.0000 Z-6.2906
+G1 X-16.5000 Y-5.0000 Z-6.3792
+G1 X-17.0000 Y-5.0000 Z-6.4730
+G1 X-17.5000 Y-5.0000 Z-6.5722
+G1 X-18.0000 Y-5.0000 Z-6.6774
+G1 X-18.5000 Y-5.0000 Z-6.7891
+G1 X-19.0000 Y-5.0000 Z-6.9081
+G1 X-19.5000 Y-5.0000 Z-7.0352
+G1 X-20.0000 Y-5.0000 Z-7.1716
+G1 X-20.0000 Y-4.0000 Z-7.1086
+G1 X-19.5000 Y-4.0000 Z-6.9751
+G1 X-19.0000 Y-4.0000 Z-6.8504
+G1 X-18.5000 Y-4.0000 Z-6.7335
+G1 X-18.0000 Y-4.0000 Z-6.6236
+G1 X-17.5000 Y-4.0000 Z-6.5201
+G1 X-17.0000 Y-4.0000 Z-6.4223
+G1 X-16.5000 Y-4.0000 Z-6.3299
+G1 X-16.0000 Y-4.0000 Z-6.2423
+G1 X-15.5000 Y-4.0000 Z-6.1594
+G1 X-15.0000 Y-4.0000 Z-6.0808
+G1 X-14.5000 Y-4.0000 Z-6.0063
+G1 X-14.0000 Y-4.0000 Z-5.9355
+G1 X-13.5000 Y-4.0000 Z-5.8684
+G1 X-13.0000 Y-4.0000 Z-5.8048
+G1 X-12.5000 Y-4.0000 Z-5.7444
+G1 X-12.0000 Y-4.0000 Z-5.6872
+G1 X-11.5000 Y-4.0000 Z-5.6331
+G1 X-11.0000 Y-4.0000 Z-5.5819
+G1 X-10.5000 Y-4.0000 Z-5.5335
+G1 X-10.0000 Y-4.0000 Z-5.4878
+G1 X-9.5000 Y-4.0000 Z-5.4448
+G1 X-9.0000 Y-4.0000 Z-5.4043
+G1 X-8.5000 Y-4.0000 Z-5.3664
+G1 X-8.0000 Y-4.0000 Z-5.3310
+G1 X-7.5000 Y-4.0000 Z-5.2979
+G1 X-7.0000 Y-4.0000 Z-5.2671
+G1 X-6.5000 Y-4.0000 Z-5.2387
+G1 X-6.0000 Y-4.0000 Z-5.2125
+G1 X-5.5000 Y-4.0000 Z-5.1886
+G1 X-5.0000 Y-4.0000 Z-5.1668
+G1 X-4.5000 Y-4.0000 Z-5.1472
+G1 X-4.0000 Y-4.0000 Z-5.1297
+G1 X-3.5000 Y-4.0000 Z-5.1143
+G1 X-3.0000 Y-4.0000 Z-5.1010
+G1 X-2.5000 Y-4.0000 Z-5.0898
+G1 X-2.0000 Y-4.0000 Z-5.0807
+G1 X-1.5000 Y-4.0000 Z-5.0735
+G1 X-1.0000 Y-4.0000 Z-5.0685
+G1 X-0.5000 Y-4.0000 Z-5.0654
+G1 X0.0000 Y-4.0000 Z-5.0644
+G1 X0.5000 Y-4.0000 Z-5.0654
+G1 X1.0000 Y-4.0000 Z-5.0685
+G1 X1.5000 Y-4.0000 Z-5.0735
+G1 X2.0000 Y-4.0000 Z-5.0807
+G1 X2.5000 Y-4.0000 Z-5.0898
+G1 X3.0000 Y-4.0000 Z-5.1010
+G1 X3.5000 Y-4.0000 Z-5.1143
+G1 X4.0000 Y-4.0000 Z-5.1297
+G1 X4.5000 Y-4.0000 Z-5.1472
+G1 X5.0000 Y-4.0000 Z-5.1668
+G1 X5.5000 Y-4.0000 Z-5.1886
+G1 X6.0000 Y-4.0000 Z-5.2125
+G1 X6.5000 Y-4.0000 Z-5.2387
+G1 X7.0000 Y-4.0000 Z-5.2671
+G1 X7.5000 Y-4.0000 Z-5.2979
+G1 X8.0000 Y-4.0000 Z-5.3310
+G1 X8.5000 Y-4.0000 Z-5.3664
+G1 X9.0000 Y-4.0000 Z-5.4043
+G1 X9.5000 Y-4.0000 Z-5.4448
+G1 X10.0000 Y-4.0000 Z-5.4878
+G1 X10.5000 Y-4.0000 Z-5.5335
+G1 X11.0000 Y-4.0000 Z-5.5819
+G1 X11.5000 Y-4.0000 Z-5.6331
+G1 X12.0000 Y-4.0000 Z-5.6872
+G1 X12.5000 Y-4.0000 Z-5.7444
+G1 X13.0000 Y-4.0000 Z-5.8048
+G1 X13.5000 Y-4.0000 Z-5.8684
+G1 X14.0000 Y-4.0000 Z-5.9355
+G1 X14.5000 Y-4.0000 Z-6.0063
+G1 X15.0000 Y-4.0000 Z-6.0808
+G1 X15.5000 Y-4.0000 Z-6.1594
+G1 X16.0000 Y-4.0000 Z-6.2423
+G1 X16.5000 Y-4.0000 Z-6.3299
+G1 X17.0000 Y-4.0000 Z-6.4223
+G1 X17.5000 Y-4.0000 Z-6.5201
+G1 X18.0000 Y-4.0000 Z-6.6236
+G1 X18.5000 Y-4.0000 Z-6.7335
+G1 X19.0000 Y-4.0000 Z-6.8504
+G1 X19.5000 Y-4.0000 Z-6.9751
+G1 X20.0000 Y-4.0000 Z-7.1086
+G1 X20.0000 Y-3.0000 Z-7.0606
+G1 X19.5000 Y-3.0000 Z-6.9292
+G1 X19.0000 Y-3.0000 Z-6.8063
+G1 X18.5000 Y-3.0000 Z-6.6909
+G1 X18.0000 Y-3.0000 Z-6.5824
+G1 X17.5000 Y-3.0000 Z-6.4801
+G1 X17.0000 Y-3.0000 Z-6.3834
+G1 X16.5000 Y-3.0000 Z-6.2919
+G1 X16.0000 Y-3.0000 Z-6.2053
+G1 X15.5000 Y-3.0000 Z-6.1231
+G1 X15.0000 Y-3.0000 Z-6.0453
+G1 X14.5000 Y-3.0000 Z-5.9714
+G1 X14.0000 Y-3.0000 Z-5.9012
+G1 X13.5000 Y-3.0000 Z-5.8347
+G1 X13.0000 Y-3.0000 Z-5.7715
+G1 X12.5000 Y-3.0000 Z-5.7116
+G1 X12.0000 Y-3.0000 Z-5.6549
+G1 X11.5000 Y-3.0000 Z-5.6011
+G1 X11.0000 Y-3.0000 Z-5.5503
+G1 X10.5000 Y-3.0000 Z-5.5022
+G1 X10.0000 Y-3.0000 Z-5.4569
+G1 X9.5000 Y-3.0000 Z-5.4142
+G1 X9.0000 Y-3.0000 Z-5.3740
+G1 X8.5000 Y-3.0000 Z-5.3363
+G1 X8.0000 Y-3.0000 Z-5.3011
+G1 X7.5000 Y-3.0000 Z-5.2682
+G1 X7.0000 Y-3.0000 Z-5.2376
+G1 X6.5000 Y-3.0000 Z-5.2094
+G1 X6.0000 Y-3.0000 Z-5.1834
+G1 X5.5000 Y-3.0000 Z-5.1595
+G1 X5.0000 Y-3.0000 Z-5.1379
+G1 X4.5000 Y-3.0000 Z-5.1184
+G1 X4.0000 Y-3.0000 Z-5.1010
+G1 X3.5000 Y-3.0000 Z-5.0857
+G1 X3.0000 Y-3.0000 Z-5.0725
+G1 X2.5000 Y-3.0000 Z-5.0614
+G1 X2.0000 Y-3.0000 Z-5.0523
+G1 X1.5000 Y-3.0000 Z-5.0452
+G1 X1.0000 Y-3.0000 Z-5.0402
+G1 X0.5000 Y-3.0000 Z-5.0371
+G1 X0.0000 Y-3.0000 Z-5.0361
+G1 X-0.5000 Y-3.0000 Z-5.0371
+G1 X-1.0000 Y-3.0000 Z-5.0402
+G1 X-1.5000 Y-3.0000 Z-5.0452
+G1 X-2.0000 Y-3.0000 Z-5.0523
+G1 X-2.5000 Y-3.0000 Z-5.0614
+G1 X-3.0000 Y-3.0000 Z-5.0725
+G1 X-3.5000 Y-3.0000 Z-5.0857
+G1 X-4.0000 Y-3.0000 Z-5.1010
+G1 X-4.5000 Y-3.0000 Z-5.1184
+G1 X-5.0000 Y-3.0000 Z-5.1379
+G1 X-5.5000 Y-3.0000 Z-5.1595
+G1 X-6.0000 Y-3.0000 Z-5.1834
+G1 X-6.5000 Y-3.0000 Z-5.2094
+G1 X-7.0000 Y-3.0000 Z-5.2376
+G1 X-7.5000 Y-3.0000 Z-5.2682
+G1 X-8.0000 Y-3.0000 Z-5.3011
+G1 X-8.5000 Y-3.0000 Z-5.3363
+G1 X-9.0000 Y-3.0000 Z-5.3740
+G1 X-9.5000 Y-3.0000 Z-5.4142
+G1 X-10.0000 Y-3.0000 Z-5.4569
+G1 X-10.5000 Y-3.0000 Z-5.5022
+G1 X-11.0000 Y-3.0000 Z-5.5503
+G1 X-11.5000 Y-3.0000 Z-5.6011
+G1 X-12.0000 Y-3.0000 Z-5.6549
+G1 X-12.5000 Y-3.0000 Z-5.7116
+G1 X-13.0000 Y-3.0000 Z-5.7715
+G1 X-13.5000 Y-3.0000 Z-5.8347
+G1 X-14.0000 Y-3.0000 Z-5.9012
+G1 X-14.5000 Y-3.0000 Z-5.9714
+G1 X-15.0000 Y-3.0000 Z-6.0453
+G1 X-15.5000 Y-3.0000 Z-6.1231
+G1 X-16.0000 Y-3.0000 Z-6.2053
+G1 X-16.5000 Y-3.0000 Z-6.2919
+G1 X-17.0000 Y-3.0000 Z-6.3834
+G1 X-17.5000 Y-3.0000 Z-6.4801
+G1 X-18.0000 Y-3.0000 Z-6.5824
+G1 X-18.5000 Y-3.0000 Z-6.6909
+G1 X-19.0000 Y-3.0000 Z-6.8063
+G1 X-19.5000 Y-3.0000 Z-6.9292
+G1 X-20.0000 Y-3.0000 Z-7.0606
+G1 X-20.0000 Y-2.0000 Z-7.0268
+G1 X-19.5000 Y-2.0000 Z-6.8968
+G1 X-19.0000 Y-2.0000 Z-6.7751
+G1 X-18.5000 Y-2.0000 Z-6.6608
+G1 X-18.0000 Y-2.0000 Z-6.5533
+G1 X-17.5000 Y-2.0000 Z-6.4518
+G1 X-17.0000 Y-2.0000 Z-6.3558
+G1 X-16.5000 Y-2.0000 Z-6.2650
+G1 X-16.0000 Y-2.0000 Z-6.1790
+G1 X-15.5000 Y-2.0000 Z-6.0974
+G1 X-15.0000 Y-2.0000 Z-6.0201
+G1 X-14.5000 Y-2.0000 Z-5.9466
+G1 X-14.0000 Y-2.0000 Z-5.8769
+G1 X-13.5000 Y-2.0000 Z-5.8107
+G1 X-13.0000 Y-2.0000 Z-5.7479
+G1 X-12.5000 Y-2.0000 Z-5.6884
+G1 X-12.0000 Y-2.0000 Z-5.6319
+G1 X-11.5000 Y-2.0000 Z-5.5785
+G1 X-11.0000 Y-2.0000 Z-5.5279
+G1 X-10.5000 Y-2.0000 Z-5.4800
+G1 X-10.0000 Y-2.0000 Z-5.4349
+G1 X-9.5000 Y-2.0000 Z-5.3924
+G1 X-9.0000 Y-2.0000 Z-5.3524
+G1 X-8.5000 Y-2.0000 Z-5.3149
+G1 X-8.0000 Y-2.0000 Z-5.2798
+G1 X-7.5000 Y-2.0000 Z-5.2471
+G1 X-7.0000 Y-2.0000 Z-5.2167
+G1 X-6.5000 Y-2.0000 Z-5.1886
+G1 X-6.0000 Y-2.0000 Z-5.1626
+G1 X-5.5000 Y-2.0000 Z-5.1389
+G1 X-5.0000 Y-2.0000 Z-5.1174
+G1 X-4.5000 Y-2.0000 Z-5.0980
+G1 X-4.0000 Y-2.0000 Z-5.0807
+G1 X-3.5000 Y-2.0000 Z-5.0654
+G1 X-3.0000 Y-2.0000 Z-5.0523
+G1 X-2.5000 Y-2.0000 Z-5.0412
+G1 X-2.0000 Y-2.0000 Z-5.0321
+G1 X-1.5000 Y-2.0000 Z-5.0251
+G1 X-1.0000 Y-2.0000 Z-5.0200
+G1 X-0.5000 Y-2.0000 Z-5.0170
+G1 X0.0000 Y-2.0000 Z-5.0160
+G1 X0.5000 Y-2.0000 Z-5.0170
+G1 X1.0000 Y-2.0000 Z-5.0200
+G1 X1.5000 Y-2.0000 Z-5.0251
+G1 X2.0000 Y-2.0000 Z-5.0321
+G1 X2.5000 Y-2.0000 Z-5.0412
+G1 X3.0000 Y-2.0000 Z-5.0523
+G1 X3.5000 Y-2.0000 Z-5.0654
+G1 X4.0000 Y-2.0000 Z-5.0807
+G1 X4.5000 Y-2.0000 Z-5.0980
+G1 X5.0000 Y-2.0000 Z-5.1174
+G1 X5.5000 Y-2.0000 Z-5.1389
+G1 X6.0000 Y-2.0000 Z-5.1626
+G1 X6.5000 Y-2.0000 Z-5.1886
+G1 X7.0000 Y-2.0000 Z-5.2167
+G1 X7.5000 Y-2.0000 Z-5.2471
+G1 X8.0000 Y-2.0000 Z-5.2798
+G1 X8.5000 Y-2.0000 Z-5.3149
+G1 X9.0000 Y-2.0000 Z-5.3524
+G1 X9.5000 Y-2.0000 Z-5.3924
+G1 X10.0000 Y-2.0000 Z-5.4349
+G1 X10.5000 Y-2.0000 Z-5.4800
+G1 X11.0000 Y-2.0000 Z-5.5279
+G1 X11.5000 Y-2.0000 Z-5.5785
+G1 X12.0000 Y-2.0000 Z-5.6319
+G1 X12.5000 Y-2.0000 Z-5.6884
+G1 X13.0000 Y-2.0000 Z-5.7479
+G1 X13.5000 Y-2.0000 Z-5.8107
+G1 X14.0000 Y-2.0000 Z-5.8769
+G1 X14.5000 Y-2.0000 Z-5.9466
+G1 X15.0000 Y-2.0000 Z-6.0201
+G1 X15.5000 Y-2.0000 Z-6.0974
+G1 X16.0000 Y-2.0000 Z-6.1790
+G1 X16.5000 Y-2.0000 Z-6.2650
+G1 X17.0000 Y-2.0000 Z-6.3558
+G1 X17.5000 Y-2.0000 Z-6.4518
+G1 X18.0000 Y-2.0000 Z-6.5533
+G1 X18.5000 Y-2.0000 Z-6.6608
+G1 X19.0000 Y-2.0000 Z-6.7751
+G1 X19.5000 Y-2.0000 Z-6.8968
+G1 X20.0000 Y-2.0000 Z-7.0268
+G1 X20.0000 Y-1.0000 Z-7.0067
+G1 X19.5000 Y-1.0000 Z-6.8775
+G1 X19.0000 Y-1.0000 Z-6.7565
+G1 X18.5000 Y-1.0000 Z-6.6429
+G1 X18.0000 Y-1.0000 Z-6.5359
+G1 X17.5000 Y-1.0000 Z-6.4349
+G1 X17.0000 Y-1.0000 Z-6.3394
+G1 X16.5000 Y-1.0000 Z-6.2490
+G1 X16.0000 Y-1.0000 Z-6.1633
+G1 X15.5000 Y-1.0000 Z-6.0821
+G1 X15.0000 Y-1.0000 Z-6.0050
+G1 X14.5000 Y-1.0000 Z-5.9318
+G1 X14.0000 Y-1.0000 Z-5.8624
+G1 X13.5000 Y-1.0000 Z-5.7964
+G1 X13.0000 Y-1.0000 Z-5.7339
+G1 X12.5000 Y-1.0000 Z-5.6745
+G1 X12.0000 Y-1.0000 Z-5.6182
+G1 X11.5000 Y-1.0000 Z-5.5649
+G1 X11.0000 Y-1.0000 Z-5.5145
+G1 X10.5000 Y-1.0000 Z-5.4668
+G1 X10.0000 Y-1.0000 Z-5.4218
+G1 X9.5000 Y-1.0000 Z-5.3794
+G1 X9.0000 Y-1.0000 Z-5.3395
+G1 X8.5000 Y-1.0000 Z-5.3021
+G1 X8.0000 Y-1.0000 Z-5.2671
+G1 X7.5000 Y-1.0000 Z-5.2345
+G1 X7.0000 Y-1.0000 Z-5.2042
+G1 X6.5000 Y-1.0000 Z-5.1761
+G1 X6.0000 Y-1.0000 Z-5.1503
+G1 X5.5000 Y-1.0000 Z-5.1266
+G1 X5.0000 Y-1.0000 Z-5.1051
+G1 X4.5000 Y-1.0000 Z-5.0857
+G1 X4.0000 Y-1.0000 Z-5.0685
+G1 X3.5000 Y-1.0000 Z-5.0533
+G1 X3.0000 Y-1.0000 Z-5.0402
+G1 X2.5000 Y-1.0000 Z-5.0291
+G1 X2.0000 Y-1.0000 Z-5.0200
+G1 X1.5000 Y-1.0000 Z-5.0130
+G1 X1.0000 Y-1.0000 Z-5.0080
+G1 X0.5000 Y-1.0000 Z-5.0050
+G1 X0.0000 Y-1.0000 Z-5.0040
+G1 X-0.5000 Y-1.0000 Z-5.0050
+G1 X-1.0000 Y-1.0000 Z-5.0080
+G1 X-1.5000 Y-1.0000 Z-5.0130
+G1 X-2.0000 Y-1.0000 Z-5.0200
+G1 X-2.5000 Y-1.0000 Z-5.0291
+G1 X-3.0000 Y-1.0000 Z-5.0402
+G1 X-3.5000 Y-1.0000 Z-5.0533
+G1 X-4.0000 Y-1.0000 Z-5.0685
+G1 X-4.5000 Y-1.0000 Z-5.0857
+G1 X-5.0000 Y-1.0000 Z-5.1051
+G1 X-5.5000 Y-1.0000 Z-5.1266
+G1 X-6.0000 Y-1.0000 Z-5.1503
+G1 X-6.5000 Y-1.0000 Z-5.1761
+G1 X-7.0000 Y-1.0000 Z-5.2042
+G1 X-7.5000 Y-1.0000 Z-5.2345
+G1 X-8.0000 Y-1.0000 Z-5.2671
+G1 X-8.5000 Y-1.0000 Z-5.3021
+G1 X-9.0000 Y-1.0000 Z-5.3395
+G1 X-9.5000 Y-1.0000 Z-5.3794
+G1 X-10.0000 Y-1.0000 Z-5.4218
+G1 X-10.5000 Y-1.0000 Z-5.4668
+G1 X-11.0000 Y-1.0000 Z-5.5145
+G1 X-11.5000 Y-1.0000 Z-5.5649
+G1 X-12.0000 Y-1.0000 Z-5.6182
+G1 X-12.5000 Y-1.0000 Z-5.6745
+G1 X-13.0000 Y-1.0000 Z-5.7339
+G1 X-13.5000 Y-1.0000 Z-5.7964
+G1 X-14.0000 Y-1.0000 Z-5.8624
+G1 X-14.5000 Y-1.0000 Z-5.9318
+G1 X-15.0000 Y-1.0000 Z-6.0050
+G1 X-15.5000 Y-1.0000 Z-6.0821
+G1 X-16.0000 Y-1.0000 Z-6.1633
+G1 X-16.5000 Y-1.0000 Z-6.2490
+G1 X-17.0000 Y-1.0000 Z-6.3394
+G1 X-17.5000 Y-1.0000 Z-6.4349
+G1 X-18.0000 Y-1.0000 Z-6.5359
+G1 X-18.5000 Y-1.0000 Z-6.6429
+G1 X-19.0000 Y-1.0000 Z-6.7565
+G1 X-19.5000 Y-1.0000 Z-6.8775
+G1 X-20.0000 Y-1.0000 Z-7.0067
+G1 X-20.0000 Y0.0000 Z-7.0000
+G1 X-19.5000 Y0.0000 Z-6.8711
+G1 X-19.0000 Y0.0000 Z-6.7504
+G1 X-18.5000 Y0.0000 Z-6.6370
+G1 X-18.0000 Y0.0000 Z-6.5301
+G1 X-17.5000 Y0.0000 Z-6.4293
+G1 X-17.0000 Y0.0000 Z-6.3339
+G1 X-16.5000 Y0.0000 Z-6.2437
+G1 X-16.0000 Y0.0000 Z-6.1581
+G1 X-15.5000 Y0.0000 Z-6.0770
+G1 X-15.0000 Y0.0000 Z-6.0000
+G1 X-14.5000 Y0.0000 Z-5.9269
+G1 X-14.0000 Y0.0000 Z-5.8575
+G1 X-13.5000 Y0.0000 Z-5.7917
+G1 X-13.0000 Y0.0000 Z-5.7292
+G1 X-12.5000 Y0.0000 Z-5.6699
+G1 X-12.0000 Y0.0000 Z-5.6137
+G1 X-11.5000 Y0.0000 Z-5.5604
+G1 X-11.0000 Y0.0000 Z-5.5100
+G1 X-10.5000 Y0.0000 Z-5.4624
+G1 X-10.0000 Y0.0000 Z-5.4174
+G1 X-9.5000 Y0.0000 Z-5.3751
+G1 X-9.0000 Y0.0000 Z-5.3352
+G1 X-8.5000 Y0.0000 Z-5.2979
+G1 X-8.0000 Y0.0000 Z-5.2629
+G1 X-7.5000 Y0.0000 Z-5.2303
+G1 X-7.0000 Y0.0000 Z-5.2000
+G1 X-6.5000 Y0.0000 Z-5.1720
+G1 X-6.0000 Y0.0000 Z-5.1461
+G1 X-5.5000 Y0.0000 Z-5.1225
+G1 X-5.0000 Y0.0000 Z-5.1010
+G1 X-4.5000 Y0.0000 Z-5.0817
+G1 X-4.0000 Y0.0000 Z-5.0644
+G1 X-3.5000 Y0.0000 Z-5.0492
+G1 X-3.0000 Y0.0000 Z-5.0361
+G1 X-2.5000 Y0.0000 Z-5.0251
+G1 X-2.0000 Y0.0000 Z-5.0160
+G1 X-1.5000 Y0.0000 Z-5.0090
+G1 X-1.0000 Y0.0000 Z-5.0040
+G1 X-0.5000 Y0.0000 Z-5.0010
+G1 X0.0000 Y0.0000 Z-5.0000
+G1 X0.5000 Y0.0000 Z-5.0010
+G1 X1.0000 Y0.0000 Z-5.0040
+G1 X1.5000 Y0.0000 Z-5.0090
+G1 X2.0000 Y0.0000 Z-5.0160
+G1 X2.5000 Y0.0000 Z-5.0251
+G1 X3.0000 Y0.0000 Z-5.0361
+G1 X3.5000 Y0.0000 Z-5.0492
+G1 X4.0000 Y0.0000 Z-5.0644
+G1 X4.5000 Y0.0000 Z-5.0817
+G1 X5.0000 Y0.0000 Z-5.1010
+G1 X5.5000 Y0.0000 Z-5.1225
+G1 X6.0000 Y0.0000 Z-5.1461
+G1 X6.5000 Y0.0000 Z-5.1720
+G1 X7.0000 Y0.0000 Z-5.2000
+G1 X7.5000 Y0.0000 Z-5.2303
+G1 X8.0000 Y0.0000 Z-5.2629
+G1 X8.5000 Y0.0000 Z-5.2979
+G1 X9.0000 Y0.0000 Z-5.3352
+G1 X9.5000 Y0.0000 Z-5.3751
+G1 X10.0000 Y0.0000 Z-5.4174
+G1 X10.5000 Y0.0000 Z-5.4624
+G1 X11.0000 Y0.0000 Z-5.5100
+G1 X11.5000 Y0.0000 Z-5.5604
+G1 X12.0000 Y0.0000 Z-5.6137
+G1 X12.5000 Y0.0000 Z-5.6699
+G1 X13.0000 Y0.0000 Z-5.7292
+G1 X13.5000 Y0.0000 Z-5.7917
+G1 X14.0000 Y0.0000 Z-5.8575
+G1 X14.5000 Y0.0000 Z-5.9269
+G1 X15.0000 Y0.0000 Z-6.0000
+G1 X15.5000 Y0.0000 Z-6.0770
+G1 X16.0000 Y0.0000 Z-6.1581
+G1 X16.5000 Y0.0000 Z-6.2437
+G1 X17.0000 Y0.0000 Z-6.3339
+G1 X17.5000 Y0.0000 Z-6.4293
+G1 X18.0000 Y0.0000 Z-6.5301
+G1 X18.5000 Y0.0000 Z-6.6370
+G1 X19.0000 Y0.0000 Z-6.7504
+G1 X19.5000 Y0.0000 Z-6.8711
+G1 X20.0000 Y0.0000 Z-7.0000
+G1 X20.0000 Y1.0000 Z-7.0067
+G1 X19.5000 Y1.0000 Z-6.8775
+G1 X19.0000 Y1.0000 Z-6.7565
+G1 X18.5000 Y1.0000 Z-6.6429
+G1 X18.0000 Y1.0000 Z-6.5359
+G1 X17.5000 Y1.0000 Z-6.4349
+G1 X17.0000 Y1.0000 Z-6.3394
+G1 X16.5000 Y1.0000 Z-6.2490
+G1 X16.0000 Y1.0000 Z-6.1633
+G1 X15.5000 Y1.0000 Z-6.0821
+G1 X15.0000 Y1.0000 Z-6.0050
+G1 X14.5000 Y1.0000 Z-5.9318
+G1 X14.0000 Y1.0000 Z-5.8624
+G1 X13.5000 Y1.0000 Z-5.7964
+G1 X13.0000 Y1.0000 Z-5.7339
+G1 X12.5000 Y1.0000 Z-5.6745
+G1 X12.0000 Y1.0000 Z-5.6182
+G1 X11.5000 Y1.0000 Z-5.5649
+G1 X11.0000 Y1.0000 Z-5.5145
+G1 X10.5000 Y1.0000 Z-5.4668
+G1 X10.0000 Y1.0000 Z-5.4218
+G1 X9.5000 Y1.0000 Z-5.3794
+G1 X9.0000 Y1.0000 Z-5.3395
+G1 X8.5000 Y1.0000 Z-5.3021
+G1 X8.0000 Y1.0000 Z-5.2671
+G1 X7.5000 Y1.0000 Z-5.2345
+G1 X7.0000 Y1.0000 Z-5.2042
+G1 X6.5000 Y1.0000 Z-5.1761
+G1 X6.0000 Y1.0000 Z-5.1503
+G1 X5.5000 Y1.0000 Z-5.1266
+G1 X5.0000 Y1.0000 Z-5.1051
+G1 X4.5000 Y1.0000 Z-5.0857
+G1 X4.0000 Y1.0000 Z-5.0685
+G1 X3.5000 Y1.0000 Z-5.0533
+G1 X3.0000 Y1.0000 Z-5.0402
+G1 X2.5000 Y1.0000 Z-5.0291
+G1 X2.0000 Y1.0000 Z-5.0200
+G1 X1.5000 Y1.0000 Z-5.0130
+G1 X1.0000 Y1.0000 Z-5.0080
+G1 X0.5000 Y1.0000 Z-5.0050
+G1 X0.0000 Y1.0000 Z-5.0040
+G1 X-0.5000 Y1.0000 Z-5.0050
+G1 X-1.0000 Y1.0000 Z-5.0080
+G1 X-1.5000 Y1.0000 Z-5.0130
+G1 X-2.0000 Y1.0000 Z-5.0200
+G1 X-2.5000 Y1.0000 Z-5.0291
+G1 X-3.0000 Y1.0000 Z-5.0402
+G1 X-3.5000 Y1.0000 Z-5.0533
+G1 X-4.0000 Y1.0000 Z-5.0685
+G1 X-4.5000 Y1.0000 Z-5.0857
+G1 X-5.0000 Y1.0000 Z-5.1051
+G1 X-5.5000 Y1.0000 Z-5.1266
+G1 X-6.0000 Y1.0000 Z-5.1503
+G1 X-6.5000 Y1.0000 Z-5.1761
+G1 X-7.0000 Y1.0000 Z-5.2042
+G1 X-7.5000 Y1.0000 Z-5.2345
+G1 X-8.0000 Y1.0000 Z-5.2671
+G1 X-8.5000 Y1.0000 Z-5.3021
+G1 X-9.0000 Y1.0000 Z-5.3395
+G1 X-9.5000 Y1.0000 Z-5.3794
+G1 X-10.0000 Y1.0000 Z-5.4218
+G1 X-10.5000 Y1.0000 Z-5.4668
+G1 X-11.0000 Y1.0000 Z-5.5145
+G1 X-11.5000 Y1.0000 Z-5.5649
+G1 X-12.0000 Y1.0000 Z-5.6182
+G1 X-12.5000 Y1.0000 Z-5.6745
+G1 X-13.0000 Y1.0000 Z-5.7339
+G1 X-13.5000 Y1.0000 Z-5.7964
+G1 X-14.0000 Y1.0000 Z-5.8624
+G1 X-14.5000 Y1.0000 Z-5.9318
+G1 X-15.0000 Y1.0000 Z-6.0050
+G1 X-15.5000 Y1.0000 Z-6.0821
+G1 X-16.0000 Y1.0000 Z-6.1633
+G1 X-16.5000 Y1.0000 Z-6.2490
+G1 X-17.0000 Y1.0000 Z-6.3394
+G1 X-17.5000 Y1.0000 Z-6.4349
+G1 X-18.0000 Y1.0000 Z-6.5359
+G1 X-18.5000 Y1.0000 Z-6.6429
+G1 X-19.0000 Y1.0000 Z-6.7565
+G1 X-19.5000 Y1.0000 Z-6.8775
+G1 X-20.0000 Y1.0000 Z-7.0067
+G1 X-20.0000 Y2.0000 Z-7.0268
+G1 X-19.5000 Y2.0000 Z-6.8968
+G1 X-19.0000 Y2.0000 Z-6.7751
+G1 X-18.5000 Y2.0000 Z-6.6608
+G1 X-18.0000 Y2.0000 Z-6.5533
+G1 X-17.5000 Y2.0000 Z-6.4518
+G1 X-17.0000 Y2.0000 Z-6.3558
+G1 X-16.5000 Y2.0000 Z-6.2650
+G1 X-16.0000 Y2.0000 Z-6.1790
+G1 X-15.5000 Y2.0000 Z-6.0974
+G1 X-15.0000 Y2.0000 Z-6.0201
+G1 X-14.5000 Y2.0000 Z-5.9466
+G1 X-14.0000 Y2.0000 Z-5.8769
+G1 X-13.5000 Y2.0000 Z-5.8107
+G1 X-13.0000 Y2.0000 Z-5.7479
+G1 X-12.5000 Y2.0000 Z-5.6884
+G1 X-12.0000 Y2.0000 Z-5.6319
+G1 X-11.5000 Y2.0000 Z-5.5785
+G1 X-11.0000 Y2.0000 Z-5.5279
+G1 X-10.5000 Y2.0000 Z-5.4800
+G1 X-10.0000 Y2.0000 Z-5.4349
+G1 X-9.5000 Y2.0000 Z-5.3924
+G1 X-9.0000 Y2.0000 Z-5.3524
+G1 X-8.5000 Y2.0000 Z-5.3149
+G1 X-8.0000 Y2.0000 Z-5.2798
+G1 X-7.5000 Y2.0000 Z-5.2471
+G1 X-7.0000 Y2.0000 Z-5.2167
+G1 X-6.5000 Y2.0000 Z-5.1886
+G1 X-6.0000 Y2.0000 Z-5.1626
+G1 X-5.5000 Y2.0000 Z-5.1389
+G1 X-5.0000 Y2.0000 Z-5.1174
+G1 X-4.5000 Y2.0000 Z-5.0980
+G1 X-4.0000 Y2.0000 Z-5.0807
+G1 X-3.5000 Y2.0000 Z-5.0654
+G1 X-3.0000 Y2.0000 Z-5.0523
+G1 X-2.5000 Y2.0000 Z-5.0412
+G1 X-2.0000 Y2.0000 Z-5.0321
+G1 X-1.5000 Y2.0000 Z-5.0251
+G1 X-1.0000 Y2.0000 Z-5.0200
+G1 X-0.5000 Y2.0000 Z-5.0170
+G1 X0.0000 Y2.0000 Z-5.0160
+G1 X0.5000 Y2.0000 Z-5.0170
+G1 X1.0000 Y2.0000 Z-5.0200
+G1 X1.5000 Y2.0000 Z-5.0251
+G1 X2.0000 Y2.0000 Z-5.0321
+G1 X2.5000 Y2.0000 Z-5.0412
+G1 X3.0000 Y2.0000 Z-5.0523
+G1 X3.5000 Y2.0000 Z-5.0654
+G1 X4.0000 Y2.0000 Z-5.0807
+G1 X4.5000 Y2.0000 Z-5.0980
+G1 X5.0000 Y2.0000 Z-5.1174
+G1 X5.5000 Y2.0000 Z-5.1389
+G1 X6.0000 Y2.0000 Z-5.1626
+G1 X6.5000 Y2.0000 Z-5.1886
+G1 X7.0000 Y2.0000 Z-5.2167
+G1 X7.5000 Y2.0000 Z-5.2471
+G1 X8.0000 Y2.0000 Z-5.2798
+G1 X8.5000 Y2.0000 Z-5.3149
+G1 X9.0000 Y2.0000 Z-5.3524
+G1 X9.5000 Y2.0000 Z-5.3924
+G1 X10.0000 Y2.0000 Z-5.4349
+G1 X10.5000 Y2.0000 Z-5.4800
+G1 X11.0000 Y2.0000 Z-5.5279
+G1 X11.5000 Y2.0000 Z-5.5785
+G1 X12.0000 Y2.0000 Z-5.6319
+G1 X12.5000 Y2.0000 Z-5.6884
+G1 X13.0000 Y2.0000 Z-5.7479
+G1 X13.5000 Y2.0000 Z-5.8107
+G1 X14.0000 Y2.0000 Z-5.8769
+G1 X14.5000 Y2.0000 Z-5.9466
+G1 X15.0000 Y2.0000 Z-6.0201
+G1 X15.5000 Y2.0000 Z-6.0974
+G1 X16.0000 Y2.0000 Z-6.1790
+G1 X16.5000 Y2.0000 Z-6.2650
+G1 X17.0000 Y2.0000 Z-6.3558
+G1 X17.5000 Y2.0000 Z-6.4518
+G1 X18.0000 Y2.0000 Z-6.5533
+G1 X18.5000 Y2.0000 Z-6.6608
+G1 X19.0000 Y2.0000 Z-6.7751
+G1 X19.5000 Y2.0000 Z-6.8968
+G1 X20.0000 Y2.0000 Z-7.0268
+G1 X20.0000 Y3.0000 Z-7.0606
+G1 X19.5000 Y3.0000 Z-6.9292
+G1 X19.0000 Y3.0000 Z-6.8063
+G1 X18.5000 Y3.0000 Z-6.6909
+G1 X18.0000 Y3.0000 Z-6.5824
+G1 X17.5000 Y3.0000 Z-6.4801
+G1 X17.0000 Y3.0000 Z-6.3834
+G1 X16.5000 Y3.0000 Z-6.2919
+G1 X16.0000 Y3.0000 Z-6.2053
+G1 X15.5000 Y3.0000 Z-6.1231
+G1 X15.0000 Y3.0000 Z-6.0453
+G1 X14.5000 Y3.0000 Z-5.9714
+G1 X14.0000 Y3.0000 Z-5.9012
+G1 X13.5000 Y3.0000 Z-5.8347
+G1 X13.0000 Y3.0000 Z-5.7715
+G1 X12.5000 Y3.0000 Z-5.7116
+G1 X12.0000 Y3.0000 Z-5.6549
+G1 X11.5000 Y3.0000 Z-5.6011
+G1 X11.0000 Y3.0000 Z-5.5503
+G1 X10.5000 Y3.0000 Z-5.5022
+G1 X10.0000 Y3.0000 Z-5.4569
+G1 X9.5000 Y3.0000 Z-5.4142
+G1 X9.0000 Y3.0000 Z-5.3740
+G1 X8.5000 Y3.0000 Z-5.3363
+G1 X8.0000 Y3.0000 Z-5.3011
+G1 X7.5000 Y3.0000 Z-5.2682
+G1 X7.0000 Y3.0000 Z-5.2376
+G1 X6.5000 Y3.0000 Z-5.2094
+G1 X6.0000 Y3.0000 Z-5.1834
+G1 X5.5000 Y3.0000 Z-5.1595
+G1 X5.0000 Y3.0000 Z-5.1379
+G1 X4.5000 Y3.0000 Z-5.1184
+G1 X4.0000 Y3.0000 Z-5.1010
+G1 X3.5000 Y3.0000 Z-5.0857
+G1 X3.0000 Y3.0000 Z-5.0725
+G1 X2.5000 Y3.0000 Z-5.0614
+G1 X2.0000 Y3.0000 Z-5.0523
+G1 X1.5000 Y3.0000 Z-5.0452
+G1 X1.0000 Y3.0000 Z-5.0402
+G1 X0.5000 Y3.0000 Z-5.0371
+G1 X0.0000 Y3.0000 Z-5.0361
+G1 X-0.5000 Y3.0000 Z-5.0371
+G1 X-1.0000 Y3.0000 Z-5.0402
+G1 X-1.5000 Y3.0000 Z-5.0452
+G1 X-2.0000 Y3.0000 Z-5.0523
+G1 X-2.5000 Y3.0000 Z-5.0614
+G1 X-3.0000 Y3.0000 Z-5.0725
+G1 X-3.5000 Y3.0000 Z-5.0857
+G1 X-4.0000 Y3.0000 Z-5.1010
+G1 X-4.5000 Y3.0000 Z-5.1184
+G1 X-5.0000 Y3.0000 Z-5.1379
+G1 X-5.5000 Y3.0000 Z-5.1595
+G1 X-6.0000 Y3.0000 Z-5.1834
+G1 X-6.5000 Y3.0000 Z-5.2094
+G1 X-7.0000 Y3.0000 Z-5.2376
+G1 X-7.5000 Y3.0000 Z-5.2682
+G1 X-8.0000 Y3.0000 Z-5.3011
+G1 X-8.5000 Y3.0000 Z-5.3363
+G1 X-9.0000 Y3.0000 Z-5.3740
+G1 X-9.5000 Y3.0000 Z-5.4142
+G1 X-10.0000 Y3.0000 Z-5.4569
+G1 X-10.5000 Y3.0000 Z-5.5022
+G1 X-11.0000 Y3.0000 Z-5.5503
+G1 X-11.5000 Y3.0000 Z-5.6011
+G1 X-12.0000 Y3.0000 Z-5.6549
+G1 X-12.5000 Y3.0000 Z-5.7116
+G1 X-13.0000 Y3.0000 Z-5.7715
+G1 X-13.5000 Y3.0000 Z-5.8347
+G1 X-14.0000 Y3.0000 Z-5.9012
+G1 X-14.5000 Y3.0000 Z-5.9714
+G1 X-15.0000 Y3.0000 Z-6.0453
+G1 X-15.5000 Y3.0000 Z-6.1231
+G1 X-16.0000 Y3.0000 Z-6.2053
+G1 X-16.5000 Y3.0000 Z-6.2919
+G1 X-17.0000 Y3.0000 Z-6.3834
+G1 X-17.5000 Y3.0000 Z-6.4801
+G1 X-18.0000 Y3.0000 Z-6.5824
+G1 X-18.5000 Y3.0000 Z-6.6909
+G1 X-19.0000 Y3.0000 Z-6.8063
+G1 X-19.5000 Y3.0000 Z-6.9292
+G1 X-20.0000 Y3.0000 Z-7.0606
+G1 X-20.0000 Y4.0000 Z-7.1086
+G1 X-19.5000 Y4.0000 Z-6.9751
+G1 X-19.0000 Y4.0000 Z-6.8504
+G1 X-18.5000 Y4.0000 Z-6.7335
+G1 X-18.0000 Y4.0000 Z-6.6236
+G1 X-17.5000 Y4.0000 Z-6.5201
+G1 X-17.0000 Y4.0000 Z-6.4223
+G1 X-16.5000 Y4.0000 Z-6.3299
+G1 X-16.0000 Y4.0000 Z-6.2423
+G1 X-15.5000 Y4.0000 Z-6.1594
+G1 X-15.0000 Y4.0000 Z-6.0808
+G1 X-14.5000 Y4.0000 Z-6.0063
+G1 X-14.0000 Y4.0000 Z-5.9355
+G1 X-13.5000 Y4.0000 Z-5.8684
+G1 X-13.0000 Y4.0000 Z-5.8048
+G1 X-12.5000 Y4.0000 Z-5.7444
+G1 X-12.0000 Y4.0000 Z-5.6872
+G1 X-11.5000 Y4.0000 Z-5.6331
+G1 X-11.0000 Y4.0000 Z-5.5819
+G1 X-10.5000 Y4.0000 Z-5.5335
+G1 X-10.0000 Y4.0000 Z-5.4878
+G1 X-9.5000 Y4.0000 Z-5.4448
+G1 X-9.0000 Y4.0000 Z-5.4043
+G1 X-8.5000 Y4.0000 Z-5.3664
+G1 X-8.0000 Y4.0000 Z-5.3310
+G1 X-7.5000 Y4.0000 Z-5.2979
+G1 X-7.0000 Y4.0000 Z-5.2671
+G1 X-6.5000 Y4.0000 Z-5.2387
+G1 X-6.0000 Y4.0000 Z-5.2125
+G1 X-5.5000 Y4.0000 Z-5.1886
+G1 X-5.0000 Y4.0000 Z-5.1668
+G1 X-4.5000 Y4.0000 Z-5.1472
+G1 X-4.0000 Y4.0000 Z-5.1297
+G1 X-3.5000 Y4.0000 Z-5.1143
+G1 X-3.0000 Y4.0000 Z-5.1010
+G1 X-2.5000 Y4.0000 Z-5.0898
+G1 X-2.0000 Y4.0000 Z-5.0807
+G1 X-1.5000 Y4.0000 Z-5.0735
+G1 X-1.0000 Y4.0000 Z-5.0685
+G1 X-0.5000 Y4.0000 Z-5.0654
+G1 X0.0000 Y4.0000 Z-5.0644
+G1 X0.5000 Y4.0000 Z-5.0654
+G1 X1.0000 Y4.0000 Z-5.0685
+G1 X1.5000 Y4.0000 Z-5.0735
+G1 X2.0000 Y4.0000 Z-5.0807
+G1 X2.5000 Y4.0000 Z-5.0898
+G1 X3.0000 Y4.0000 Z-5.1010
+G1 X3.5000 Y4.0000 Z-5.1143
+G1 X4.0000 Y4.0000 Z-5.1297
+G1 X4.5000 Y4.0000 Z-5.1472
+G1 X5.0000 Y4.0000 Z-5.1668
+G1 X5.5000 Y4.0000 Z-5.1886
+G1 X6.0000 Y4.0000 Z-5.2125
+G1 X6.5000 Y4.0000 Z-5.2387
+G1 X7.0000 Y4.0000 Z-5.2671
+G1 X7.5000 Y4.0000 Z-5.2979
+G1 X8.0000 Y4.0000 Z-5.3310
+G1 X8.5000 Y4.0000 Z-5.3664
+G1 X9.0000 Y4.0000 Z-5.4043
+G1 X9.5000 Y4.0000 Z-5.4448
+G1 X10.0000 Y4.0000 Z-5.4878
+G1 X10.5000 Y4.0000 Z-5.5335
+G1 X11.0000 Y4.0000 Z-5.5819
+G1 X11.5000 Y4.0000 Z-5.6331
+G1 X12.0000 Y4.0000 Z-5.6872
+G1 X12.5000 Y4.0000 Z-5.7444
+G1 X13.0000 Y4.0000 Z-5.8048
+G1 X13.5000 Y4.0000 Z-5.8684
+G1 X14.0000 Y4.0000 Z-5.9355
+G1 X14.5000 Y4.0000 Z-6.0063
+G1 X15.0000 Y4.0000 Z-6.0808
+G1 X15.5000 Y4.0000 Z-6.1594
+G1 X16.0000 Y4.0000 Z-6.2423
+G1 X16.5000 Y4.0000 Z-6.3299
+G1 X17.0000 Y4.0000 Z-6.4223
+G1 X17.5000 Y4.0000 Z-6.5201
+G1 X18.0000 Y4.0000 Z-6.6236
+G1 X18.5000 Y4.0000 Z-6.7335
+G1 X19.0000 Y4.0000 Z-6.8504
+G1 X19.5000 Y4.0000 Z-6.9751
+G1 X20.0000 Y4.0000 Z-7.1086
+G1 X20.0000 Y5.0000 Z-7.1716
+G1 X19.5000 Y5.0000 Z-7.0352
+G1 X19.0000 Y5.0000 Z-6.9081
+G1 X18.5000 Y5.0000 Z-6.7891
+G1 X18.0000 Y5.0000 Z-6.6774
+G1 X17.5000 Y5.0000 Z-6.5722
+G1 X17.0000 Y5.0000 Z-6.4730
+G1 X16.5000 Y5.0000 Z-6.3792
+G1 X16.0000 Y5.0000 Z-6.2906
+G1 X15.5000 Y5.0000 Z-6.2066
+G1 X15.0000 Y5.0000 Z-6.1270
+G1 X14.5000 Y5.0000 Z-6.0516
+G1 X14.0000 Y5.0000 Z-5.9800
+G1 X13.5000 Y5.0000 Z-5.9122
+G1 X13.0000 Y5.0000 Z-5.8479
+G1 X12.5000 Y5.0000 Z-5.7869
+G1 X12.0000 Y5.0000 Z-5.7292
+G1 X11.5000 Y5.0000 Z-5.6745
+G1 X11.0000 Y5.0000 Z-5.6228
+G1 X10.5000 Y5.0000 Z-5.5739
+G1 X10.0000 Y5.0000 Z-5.5279
+G1 X9.5000 Y5.0000 Z-5.4845
+G1 X9.0000 Y5.0000 Z-5.4437
+G1 X8.5000 Y5.0000 Z-5.4054
+G1 X8.0000 Y5.0000 Z-5.3697
+G1 X7.5000 Y5.0000 Z-5.3363
+G1 X7.0000 Y5.0000 Z-5.3053
+G1 X6.5000 Y5.0000 Z-5.2767
+G1 X6.0000 Y5.0000 Z-5.2503
+G1 X5.5000 Y5.0000 Z-5.2261
+G1 X5.0000 Y5.0000 Z-5.2042
+G1 X4.5000 Y5.0000 Z-5.1844
+G1 X4.0000 Y5.0000 Z-5.1668
+G1 X3.5000 Y5.0000 Z-5.1513
+G1 X3.0000 Y5.0000 Z-5.1379
+G1 X2.5000 Y5.0000 Z-5.1266
+G1 X2.0000 Y5.0000 Z-5.1174
+G1 X1.5000 Y5.0000 Z-5.1102
+G1 X1.0000 Y5.0000 Z-5.1051
+G1 X0.5000 Y5.0000 Z-5.1020
+G1 X0.0000 Y5.0000 Z-5.1010
+G1 X-0.5000 Y5.0000 Z-5.1020
+G1 X-1.0000 Y5.0000 Z-5.1051
+G1 X-1.5000 Y5.0000 Z-5.1102
+G1 X-2.0000 Y5.0000 Z-5.1174
+G1 X-2.5000 Y5.0000 Z-5.1266
+G1 X-3.0000 Y5.0000 Z-5.1379
+G1 X-3.5000 Y5.0000 Z-5.1513
+G1 X-4.0000 Y5.0000 Z-5.1668
+G1 X-4.5000 Y5.0000 Z-5.1844
+G1 X-5.0000 Y5.0000 Z-5.2042
+G1 X-5.5000 Y5.0000 Z-5.2261
+G1 X-6.0000 Y5.0000 Z-5.2503
+G1 X-6.5000 Y5.0000 Z-5.2767
+G1 X-7.0000 Y5.0000 Z-5.3053
+G1 X-7.5000 Y5.0000 Z-5.3363
+G1 X-8.0000 Y5.0000 Z-5.3697
+G1 X-8.5000 Y5.0000 Z-5.4054
+G1 X-9.0000 Y5.0000 Z-5.4437
+G1 X-9.5000 Y5.0000 Z-5.4845
+G1 X-10.0000 Y5.0000 Z-5.5279
+G1 X-10.5000 Y5.0000 Z-5.5739
+G1 X-11.0000 Y5.0000 Z-5.6228
+G1 X-11.5000 Y5.0000 Z-5.6745
+G1 X-12.0000 Y5.0000 Z-5.7292
+G1 X-12.5000 Y5.0000 Z-5.7869
+G1 X-13.0000 Y5.0000 Z-5.8479
+G1 X-13.5000 Y5.0000 Z-5.9122
+G1 X-14.0000 Y5.0000 Z-5.9800
+G1 X-14.5000 Y5.0000 Z-6.0516
+G1 X-15.0000 Y5.0000 Z-6.1270
+G1 X-15.5000 Y5.0000 Z-6.2066
+G1 X-16.0000 Y5.0000 Z-6.2906
+G1 X-16.5000 Y5.0000 Z-6.3792
+G1 X-17.0000 Y5.0000 Z-6.4730
+G1 X-17.5000 Y5.0000 Z-6.5722
+G1 X-18.0000 Y5.0000 Z-6.6774
+G1 X-18.5000 Y5.0000 Z-6.7891
+G1 X-19.0000 Y5.0000 Z-6.9081
+G1 X-19.5000 Y5.0000 Z-7.0352
+G1 X-20.0000 Y5.0000 Z-7.1716
+G1 X-20.0000 Y6.0000 Z-7.2505
+G1 X-19.5000 Y6.0000 Z-7.1104
+G1 X-19.0000 Y6.0000 Z-6.9801
+G1 X-18.5000 Y6.0000 Z-6.8583
+G1 X-18.0000 Y6.0000 Z-6.7442
+G1 X-17.5000 Y6.0000 Z-6.6370
+G1 X-17.0000 Y6.0000 Z-6.5359
+G1 X-16.5000 Y6.0000 Z-6.4405
+G1 X-16.0000 Y6.0000 Z-6.3503
+G1 X-15.5000 Y6.0000 Z-6.2650
+G1 X-15.0000 Y6.0000 Z-6.1842
+G1 X-14.5000 Y6.0000 Z-6.1077
+G1 X-14.0000 Y6.0000 Z-6.0352
+G1 X-13.5000 Y6.0000 Z-5.9664
+G1 X-13.0000 Y6.0000 Z-5.9012
+G1 X-12.5000 Y6.0000 Z-5.8395
+G1 X-12.0000 Y6.0000 Z-5.7810
+G1 X-11.5000 Y6.0000 Z-5.7257
+G1 X-11.0000 Y6.0000 Z-5.6733
+G1 X-10.5000 Y6.0000 Z-5.6239
+G1 X-10.0000 Y6.0000 Z-5.5773
+G1 X-9.5000 Y6.0000 Z-5.5335
+G1 X-9.0000 Y6.0000 Z-5.4922
+G1 X-8.5000 Y6.0000 Z-5.4536
+G1 X-8.0000 Y6.0000 Z-5.4174
+G1 X-7.5000 Y6.0000 Z-5.3837
+G1 X-7.0000 Y6.0000 Z-5.3524
+G1 X-6.5000 Y6.0000 Z-5.3235
+G1 X-6.0000 Y6.0000 Z-5.2968
+G1 X-5.5000 Y6.0000 Z-5.2724
+G1 X-5.0000 Y6.0000 Z-5.2503
+G1 X-4.5000 Y6.0000 Z-5.2303
+G1 X-4.0000 Y6.0000 Z-5.2125
+G1 X-3.5000 Y6.0000 Z-5.1969
+G1 X-3.0000 Y6.0000 Z-5.1834
+G1 X-2.5000 Y6.0000 Z-5.1720
+G1 X-2.0000 Y6.0000 Z-5.1626
+G1 X-1.5000 Y6.0000 Z-5.1554
+G1 X-1.0000 Y6.0000 Z-5.1503
+G1 X-0.5000 Y6.0000 Z-5.1472
+G1 X0.0000 Y6.0000 Z-5.1461
+G1 X0.5000 Y6.0000 Z-5.1472
+G1 X1.0000 Y6.0000 Z-5.1503
+G1 X1.5000 Y6.0000 Z-5.1554
+G1 X2.0000 Y6.0000 Z-5.1626
+G1 X2.5000 Y6.0000 Z-5.1720
+G1 X3.0000 Y6.0000 Z-5.1834
+G1 X3.5000 Y6.0000 Z-5.1969
+G1 X4.0000 Y6.0000 Z-5.2125
+G1 X4.5000 Y6.0000 Z-5.2303
+G1 X5.0000 Y6.0000 Z-5.2503
+G1 X5.5000 Y6.0000 Z-5.2724
+G1 X6.0000 Y6.0000 Z-5.2968
+G1 X6.5000 Y6.0000 Z-5.3235
+G1 X7.0000 Y6.0000 Z-5.3524
+G1 X7.5000 Y6.0000 Z-5.3837
+G1 X8.0000 Y6.0000 Z-5.4174
+G1 X8.5000 Y6.0000 Z-5.4536
+G1 X9.0000 Y6.0000 Z-5.4922
+G1 X9.5000 Y6.0000 Z-5.5335
+G1 X10.0000 Y6.0000 Z-5.5773
+G1 X10.5000 Y6.0000 Z-5.6239
+G1 X11.0000 Y6.0000 Z-5.6733
+G1 X11.5000 Y6.0000 Z-5.7257
+G1 X12.0000 Y6.0000 Z-5.7810
+G1 X12.5000 Y6.0000 Z-5.8395
+G1 X13.0000 Y6.0000 Z-5.9012
+G1 X13.5000 Y6.0000 Z-5.9664
+G1 X14.0000 Y6.0000 Z-6.0352
+G1 X14.5000 Y6.0000 Z-6.1077
+G1 X15.0000 Y6.0000 Z-6.1842
+G1 X15.5000 Y6.0000 Z-6.2650
+G1 X16.0000 Y6.0000 Z-6.3503
+G1 X16.5000 Y6.0000 Z-6.4405
+G1 X17.0000 Y6.0000 Z-6.5359
+G1 X17.5000 Y6.0000 Z-6.6370
+G1 X18.0000 Y6.0000 Z-6.7442
+G1 X18.5000 Y6.0000 Z-6.8583
+G1 X19.0000 Y6.0000 Z-6.9801
+G1 X19.5000 Y6.0000 Z-7.1104
+G1 X20.0000 Y6.0000 Z-7.2505
+G1 X20.0000 Y7.0000 Z-7.3467
+G1 X19.5000 Y7.0000 Z-7.2018
+G1 X19.0000 Y7.0000 Z-7.0674
+G1 X18.5000 Y7.0000 Z-6.9422
+G1 X18.0000 Y7.0000 Z-6.8251
+G1 X17.5000 Y7.0000 Z-6.7152
+G1 X17.0000 Y7.0000 Z-6.6118
+G1 X16.5000 Y7.0000 Z-6.5143
+G1 X16.0000 Y7.0000 Z-6.4223
+G1 X15.5000 Y7.0000 Z-6.3353
+G1 X15.0000 Y7.0000 Z-6.2530
+G1 X14.5000 Y7.0000 Z-6.1751
+G1 X14.0000 Y7.0000 Z-6.1013
+G1 X13.5000 Y7.0000 Z-6.0314
+G1 X13.0000 Y7.0000 Z-5.9652
+G1 X12.5000 Y7.0000 Z-5.9024
+G1 X12.0000 Y7.0000 Z-5.8431
+G1 X11.5000 Y7.0000 Z-5.7869
+G1 X11.0000 Y7.0000 Z-5.7339
+G1 X10.5000 Y7.0000 Z-5.6838
+G1 X10.0000 Y7.0000 Z-5.6365
+G1 X9.5000 Y7.0000 Z-5.5921
+G1 X9.0000 Y7.0000 Z-5.5503
+G1 X8.5000 Y7.0000 Z-5.5111
+G1 X8.0000 Y7.0000 Z-5.4745
+G1 X7.5000 Y7.0000 Z-5.4404
+G1 X7.0000 Y7.0000 Z-5.4087
+G1 X6.5000 Y7.0000 Z-5.3794
+G1 X6.0000 Y7.0000 Z-5.3524
+G1 X5.5000 Y7.0000 Z-5.3277
+G1 X5.0000 Y7.0000 Z-5.3053
+G1 X4.5000 Y7.0000 Z-5.2851
+G1 X4.0000 Y7.0000 Z-5.2671
+G1 X3.5000 Y7.0000 Z-5.2513
+G1 X3.0000 Y7.0000 Z-5.2376
+G1 X2.5000 Y7.0000 Z-5.2261
+G1 X2.0000 Y7.0000 Z-5.2167
+G1 X1.5000 Y7.0000 Z-5.2094
+G1 X1.0000 Y7.0000 Z-5.2042
+G1 X0.5000 Y7.0000 Z-5.2010
+G1 X0.0000 Y7.0000 Z-5.2000
+G1 X-0.5000 Y7.0000 Z-5.2010
+G1 X-1.0000 Y7.0000 Z-5.2042
+G1 X-1.5000 Y7.0000 Z-5.2094
+G1 X-2.0000 Y7.0000 Z-5.2167
+G1 X-2.5000 Y7.0000 Z-5.2261
+G1 X-3.0000 Y7.0000 Z-5.2376
+G1 X-3.5000 Y7.0000 Z-5.2513
+G1 X-4.0000 Y7.0000 Z-5.2671
+G1 X-4.5000 Y7.0000 Z-5.2851
+G1 X-5.0000 Y7.0000 Z-5.3053
+G1 X-5.5000 Y7.0000 Z-5.3277
+G1 X-6.0000 Y7.0000 Z-5.3524
+G1 X-6.5000 Y7.0000 Z-5.3794
+G1 X-7.0000 Y7.0000 Z-5.4087
+G1 X-7.5000 Y7.0000 Z-5.4404
+G1 X-8.0000 Y7.0000 Z-5.4745
+G1 X-8.5000 Y7.0000 Z-5.5111
+G1 X-9.0000 Y7.0000 Z-5.5503
+G1 X-9.5000 Y7.0000 Z-5.5921
+G1 X-10.0000 Y7.0000 Z-5.6365
+G1 X-10.5000 Y7.0000 Z-5.6838
+G1 X-11.0000 Y7.0000 Z-5.7339
+G1 X-11.5000 Y7.0000 Z-5.7869
+G1 X-12.0000 Y7.0000 Z-5.8431
+G1 X-12.5000 Y7.0000 Z-5.9024
+G1 X-13.0000 Y7.0000 Z-5.9652
+G1 X-13.5000 Y7.0000 Z-6.0314
+G1 X-14.0000 Y7.0000 Z-6.1013
+G1 X-14.5000 Y7.0000 Z-6.1751
+G1 X-15.0000 Y7.0000 Z-6.2530
+G1 X-15.5000 Y7.0000 Z-6.3353
+G1 X-16.0000 Y7.0000 Z-6.4223
+G1 X-16.5000 Y7.0000 Z-6.5143
+G1 X-17.0000 Y7.0000 Z-6.6118
+G1 X-17.5000 Y7.0000 Z-6.7152
+G1 X-18.0000 Y7.0000 Z-6.8251
+G1 X-18.5000 Y7.0000 Z-6.9422
+G1 X-19.0000 Y7.0000 Z-7.0674
+G1 X-19.5000 Y7.0000 Z-7.2018
+G1 X-20.0000 Y7.0000 Z-7.3467
+G1 X-20.0000 Y8.0000 Z-7.4623
+G1 X-19.5000 Y8.0000 Z-7.3111
+G1 X-19.0000 Y8.0000 Z-7.1716
+G1 X-18.5000 Y8.0000 Z-7.0420
+G1 X-18.0000 Y8.0000 Z-6.9210
+G1 X-17.5000 Y8.0000 Z-6.8078
+G1 X-17.0000 Y8.0000 Z-6.7015
+G1 X-16.5000 Y8.0000 Z-6.6015
+G1 X-16.0000 Y8.0000 Z-6.5072
+G1 X-15.5000 Y8.0000 Z-6.4181
+G1 X-15.0000 Y8.0000 Z-6.3339
+G1 X-14.5000 Y8.0000 Z-6.2543
+G1 X-14.0000 Y8.0000 Z-6.1790
+G1 X-13.5000 Y8.0000 Z-6.1077
+G1 X-13.0000 Y8.0000 Z-6.0402
+G1 X-12.5000 Y8.0000 Z-5.9763
+G1 X-12.0000 Y8.0000 Z-5.9159
+G1 X-11.5000 Y8.0000 Z-5.8587
+G1 X-11.0000 Y8.0000 Z-5.8048
+G1 X-10.5000 Y8.0000 Z-5.7538
+G1 X-10.0000 Y8.0000 Z-5.7058
+G1 X-9.5000 Y8.0000 Z-5.6606
+G1 X-9.0000 Y8.0000 Z-5.6182
+G1 X-8.5000 Y8.0000 Z-5.5785
+G1 X-8.0000 Y8.0000 Z-5.5413
+G1 X-7.5000 Y8.0000 Z-5.5067
+G1 X-7.0000 Y8.0000 Z-5.4745
+G1 X-6.5000 Y8.0000 Z-5.4448
+G1 X-6.0000 Y8.0000 Z-5.4174
+G1 X-5.5000 Y8.0000 Z-5.3924
+G1 X-5.0000 Y8.0000 Z-5.3697
+G1 X-4.5000 Y8.0000 Z-5.3492
+G1 X-4.0000 Y8.0000 Z-5.3310
+G1 X-3.5000 Y8.0000 Z-5.3149
+G1 X-3.0000 Y8.0000 Z-5.3011
+G1 X-2.5000 Y8.0000 Z-5.2894
+G1 X-2.0000 Y8.0000 Z-5.2798
+G1 X-1.5000 Y8.0000 Z-5.2724
+G1 X-1.0000 Y8.0000 Z-5.2671
+G1 X-0.5000 Y8.0000 Z-5.2640
+G1 X0.0000 Y8.0000 Z-5.2629
+G1 X0.5000 Y8.0000 Z-5.2640
+G1 X1.0000 Y8.0000 Z-5.2671
+G1 X1.5000 Y8.0000 Z-5.2724
+G1 X2.0000 Y8.0000 Z-5.2798
+G1 X2.5000 Y8.0000 Z-5.2894
+G1 X3.0000 Y8.0000 Z-5.3011
+G1 X3.5000 Y8.0000 Z-5.3149
+G1 X4.0000 Y8.0000 Z-5.3310
+G1 X4.5000 Y8.0000 Z-5.3492
+G1 X5.0000 Y8.0000 Z-5.3697
+G1 X5.5000 Y8.0000 Z-5.3924
+G1 X6.0000 Y8.0000 Z-5.4174
+G1 X6.5000 Y8.0000 Z-5.4448
+G1 X7.0000 Y8.0000 Z-5.4745
+G1 X7.5000 Y8.0000 Z-5.5067
+G1 X8.0000 Y8.0000 Z-5.5413
+G1 X8.5000 Y8.0000 Z-5.5785
+G1 X9.0000 Y8.0000 Z-5.6182
+G1 X9.5000 Y8.0000 Z-5.6606
+G1 X10.0000 Y8.0000 Z-5.7058
+G1 X10.5000 Y8.0000 Z-5.7538
+G1 X11.0000 Y8.0000 Z-5.8048
+G1 X11.5000 Y8.0000 Z-5.8587
+G1 X12.0000 Y8.0000 Z-5.9159
+G1 X12.5000 Y8.0000 Z-5.9763
+G1 X13.0000 Y8.0000 Z-6.0402
+G1 X13.5000 Y8.0000 Z-6.1077
+G1 X14.0000 Y8.0000 Z-6.1790
+G1 X14.5000 Y8.0000 Z-6.2543
+G1 X15.0000 Y8.0000 Z-6.3339
+G1 X15.5000 Y8.0000 Z-6.4181
+G1 X16.0000 Y8.0000 Z-6.5072
+G1 X16.5000 Y8.0000 Z-6.6015
+G1 X17.0000 Y8.0000 Z-6.7015
+G1 X17.5000 Y8.0000 Z-6.8078
+G1 X18.0000 Y8.0000 Z-6.9210
+G1 X18.5000 Y8.0000 Z-7.0420
+G1 X19.0000 Y8.0000 Z-7.1716
+G1 X19.5000 Y8.0000 Z-7.3111
+G1 X20.0000 Y8.0000 Z-7.4623
+G1 X20.0000 Y9.0000 Z-7.6000
+G1 X19.5000 Y9.0000 Z-7.4407
+G1 X19.0000 Y9.0000 Z-7.2945
+G1 X18.5000 Y9.0000 Z-7.1592
+G1 X18.0000 Y9.0000 Z-7.0335
+G1 X17.5000 Y9.0000 Z-6.9162
+G1 X17.0000 Y9.0000 Z-6.8063
+G1 X16.5000 Y9.0000 Z-6.7030
+G1 X16.0000 Y9.0000 Z-6.6059
+G1 X15.5000 Y9.0000 Z-6.5143
+G1 X15.0000 Y9.0000 Z-6.4279
+G1 X14.5000 Y9.0000 Z-6.3462
+G1 X14.0000 Y9.0000 Z-6.2690
+G1 X13.5000 Y9.0000 Z-6.1961
+G1 X13.0000 Y9.0000 Z-6.1270
+G1 X12.5000 Y9.0000 Z-6.0617
+G1 X12.0000 Y9.0000 Z-6.0000
+G1 X11.5000 Y9.0000 Z-5.9417
+G1 X11.0000 Y9.0000 Z-5.8866
+G1 X10.5000 Y9.0000 Z-5.8347
+G1 X10.0000 Y9.0000 Z-5.7857
+G1 X9.5000 Y9.0000 Z-5.7397
+G1 X9.0000 Y9.0000 Z-5.6965
+G1 X8.5000 Y9.0000 Z-5.6560
+G1 X8.0000 Y9.0000 Z-5.6182
+G1 X7.5000 Y9.0000 Z-5.5830
+G1 X7.0000 Y9.0000 Z-5.5503
+G1 X6.5000 Y9.0000 Z-5.5200
+G1 X6.0000 Y9.0000 Z-5.4922
+G1 X5.5000 Y9.0000 Z-5.4668
+G1 X5.0000 Y9.0000 Z-5.4437
+G1 X4.5000 Y9.0000 Z-5.4229
+G1 X4.0000 Y9.0000 Z-5.4043
+G1 X3.5000 Y9.0000 Z-5.3881
+G1 X3.0000 Y9.0000 Z-5.3740
+G1 X2.5000 Y9.0000 Z-5.3621
+G1 X2.0000 Y9.0000 Z-5.3524
+G1 X1.5000 Y9.0000 Z-5.3449
+G1 X1.0000 Y9.0000 Z-5.3395
+G1 X0.5000 Y9.0000 Z-5.3363
+G1 X0.0000 Y9.0000 Z-5.3352
+G1 X-0.5000 Y9.0000 Z-5.3363
+G1 X-1.0000 Y9.0000 Z-5.3395
+G1 X-1.5000 Y9.0000 Z-5.3449
+G1 X-2.0000 Y9.0000 Z-5.3524
+G1 X-2.5000 Y9.0000 Z-5.3621
+G1 X-3.0000 Y9.0000 Z-5.3740
+G1 X-3.5000 Y9.0000 Z-5.3881
+G1 X-4.0000 Y9.0000 Z-5.4043
+G1 X-4.5000 Y9.0000 Z-5.4229
+G1 X-5.0000 Y9.0000 Z-5.4437
+G1 X-5.5000 Y9.0000 Z-5.4668
+G1 X-6.0000 Y9.0000 Z-5.4922
+G1 X-6.5000 Y9.0000 Z-5.5200
+G1 X-7.0000 Y9.0000 Z-5.5503
+G1 X-7.5000 Y9.0000 Z-5.5830
+G1 X-8.0000 Y9.0000 Z-5.6182
+G1 X-8.5000 Y9.0000 Z-5.6560
+G1 X-9.0000 Y9.0000 Z-5.6965
+G1 X-9.5000 Y9.0000 Z-5.7397
+G1 X-10.0000 Y9.0000 Z-5.7857
+G1 X-10.5000 Y9.0000 Z-5.8347
+G1 X-11.0000 Y9.0000 Z-5.8866
+G1 X-11.5000 Y9.0000 Z-5.9417
+G1 X-12.0000 Y9.0000 Z-6.0000
+G1 X-12.5000 Y9.0000 Z-6.0617
+G1 X-13.0000 Y9.0000 Z-6.1270
+G1 X-13.5000 Y9.0000 Z-6.1961
+G1 X-14.0000 Y9.0000 Z-6.2690
+G1 X-14.5000 Y9.0000 Z-6.3462
+G1 X-15.0000 Y9.0000 Z-6.4279
+G1 X-15.5000 Y9.0000 Z-6.5143
+G1 X-16.0000 Y9.0000 Z-6.6059
+G1 X-16.5000 Y9.0000 Z-6.7030
+G1 X-17.0000 Y9.0000 Z-6.8063
+G1 X-17.5000 Y9.0000 Z-6.9162
+G1 X-18.0000 Y9.0000 Z-7.0335
+G1 X-18.5000 Y9.0000 Z-7.1592
+G1 X-19.0000 Y9.0000 Z-7.2945
+G1 X-19.5000 Y9.0000 Z-7.4407
+G1 X-20.0000 Y9.0000 Z-7.6000
+G1 X-20.0000 Y10.0000 Z-7.7639
+G1 X-19.5000 Y10.0000 Z-7.5938
+G1 X-19.0000 Y10.0000 Z-7.4388
+G1 X-18.5000 Y10.0000 Z-7.2963
+G1 X-18.0000 Y10.0000 Z-7.1645
+G1 X-17.5000 Y10.0000 Z-7.0420
+G1 X-17.0000 Y10.0000 Z-6.9275
+G1 X-16.5000 Y10.0000 Z-6.8204
+G1 X-16.0000 Y10.0000 Z-6.7198
+G1 X-15.5000 Y10.0000 Z-6.6251
+G1 X-15.0000 Y10.0000 Z-6.5359
+G1 X-14.5000 Y10.0000 Z-6.4518
+G1 X-14.0000 Y10.0000 Z-6.3723
+G1 X-13.5000 Y10.0000 Z-6.2973
+G1 X-13.0000 Y10.0000 Z-6.2264
+G1 X-12.5000 Y10.0000 Z-6.1594
+G1 X-12.0000 Y10.0000 Z-6.0962
+G1 X-11.5000 Y10.0000 Z-6.0364
+G1 X-11.0000 Y10.0000 Z-5.9800
+G1 X-10.5000 Y10.0000 Z-5.9269
+G1 X-10.0000 Y10.0000 Z-5.8769
+G1 X-9.5000 Y10.0000 Z-5.8299
+G1 X-9.0000 Y10.0000 Z-5.7857
+G1 X-8.5000 Y10.0000 Z-5.7444
+G1 X-8.0000 Y10.0000 Z-5.7058
+G1 X-7.5000 Y10.0000 Z-5.6699
+G1 X-7.0000 Y10.0000 Z-5.6365
+G1 X-6.5000 Y10.0000 Z-5.6057
+G1 X-6.0000 Y10.0000 Z-5.5773
+G1 X-5.5000 Y10.0000 Z-5.5514
+G1 X-5.0000 Y10.0000 Z-5.5279
+G1 X-4.5000 Y10.0000 Z-5.5067
+G1 X-4.0000 Y10.0000 Z-5.4878
+G1 X-3.5000 Y10.0000 Z-5.4712
+G1 X-3.0000 Y10.0000 Z-5.4569
+G1 X-2.5000 Y10.0000 Z-5.4448
+G1 X-2.0000 Y10.0000 Z-5.4349
+G1 X-1.5000 Y10.0000 Z-5.4273
+G1 X-1.0000 Y10.0000 Z-5.4218
+G1 X-0.5000 Y10.0000 Z-5.4185
+G1 X0.0000 Y10.0000 Z-5.4174
+G1 X0.5000 Y10.0000 Z-5.4185
+G1 X1.0000 Y10.0000 Z-5.4218
+G1 X1.5000 Y10.0000 Z-5.4273
+G1 X2.0000 Y10.0000 Z-5.4349
+G1 X2.5000 Y10.0000 Z-5.4448
+G1 X3.0000 Y10.0000 Z-5.4569
+G1 X3.5000 Y10.0000 Z-5.4712
+G1 X4.0000 Y10.0000 Z-5.4878
+G1 X4.5000 Y10.0000 Z-5.5067
+G1 X5.0000 Y10.0000 Z-5.5279
+G1 X5.5000 Y10.0000 Z-5.5514
+G1 X6.0000 Y10.0000 Z-5.5773
+G1 X6.5000 Y10.0000 Z-5.6057
+G1 X7.0000 Y10.0000 Z-5.6365
+G1 X7.5000 Y10.0000 Z-5.6699
+G1 X8.0000 Y10.0000 Z-5.7058
+G1 X8.5000 Y10.0000 Z-5.7444
+G1 X9.0000 Y10.0000 Z-5.7857
+G1 X9.5000 Y10.0000 Z-5.8299
+G1 X10.0000 Y10.0000 Z-5.8769
+G1 X10.5000 Y10.0000 Z-5.9269
+G1 X11.0000 Y10.0000 Z-5.9800
+G1 X11.5000 Y10.0000 Z-6.0364
+G1 X12.0000 Y10.0000 Z-6.0962
+G1 X12.5000 Y10.0000 Z-6.1594
+G1 X13.0000 Y10.0000 Z-6.2264
+G1 X13.5000 Y10.0000 Z-6.2973
+G1 X14.0000 Y10.0000 Z-6.3723
+G1 X14.5000 Y10.0000 Z-6.4518
+G1 X15.0000 Y10.0000 Z-6.5359
+G1 X15.5000 Y10.0000 Z-6.6251
+G1 X16.0000 Y10.0000 Z-6.7198
+G1 X16.5000 Y10.0000 Z-6.8204
+G1 X17.0000 Y10.0000 Z-6.9275
+G1 X17.5000 Y10.0000 Z-7.0420
+G1 X18.0000 Y10.0000 Z-7.1645
+G1 X18.5000 Y10.0000 Z-7.2963
+G1 X19.0000 Y10.0000 Z-7.4388
+G1 X19.5000 Y10.0000 Z-7.5938
+G1 X20.0000 Y10.0000 Z-7.7639
+G1 X20.0000 Y11.0000 Z-7.9604
+G1 X19.5000 Y11.0000 Z-7.7751
+G1 X19.0000 Y11.0000 Z-7.6083
+G1 X18.5000 Y11.0000 Z-7.4564
+G1 X18.0000 Y11.0000 Z-7.3167
+G1 X17.5000 Y11.0000 Z-7.1875
+G1 X17.0000 Y11.0000 Z-7.0674
+G1 X16.5000 Y11.0000 Z-6.9553
+G1 X16.0000 Y11.0000 Z-6.8504
+G1 X15.5000 Y11.0000 Z-6.7519
+G1 X15.0000 Y11.0000 Z-6.6593
+G1 X14.5000 Y11.0000 Z-6.5722
+G1 X14.0000 Y11.0000 Z-6.4900
+G1 X13.5000 Y11.0000 Z-6.4125
+G1 X13.0000 Y11.0000 Z-6.3394
+G1 X12.5000 Y11.0000 Z-6.2704
+G1 X12.0000 Y11.0000 Z-6.2053
+G1 X11.5000 Y11.0000 Z-6.1438
+G1 X11.0000 Y11.0000 Z-6.0859
+G1 X10.5000 Y11.0000 Z-6.0314
+G1 X10.0000 Y11.0000 Z-5.9800
+G1 X9.5000 Y11.0000 Z-5.9318
+G1 X9.0000 Y11.0000 Z-5.8866
+G1 X8.5000 Y11.0000 Z-5.8443
+G1 X8.0000 Y11.0000 Z-5.8048
+G1 X7.5000 Y11.0000 Z-5.7680
+G1 X7.0000 Y11.0000 Z-5.7339
+G1 X6.5000 Y11.0000 Z-5.7023
+G1 X6.0000 Y11.0000 Z-5.6733
+G1 X5.5000 Y11.0000 Z-5.6468
+G1 X5.0000 Y11.0000 Z-5.6228
+G1 X4.5000 Y11.0000 Z-5.6011
+G1 X4.0000 Y11.0000 Z-5.5819
+G1 X3.5000 Y11.0000 Z-5.5649
+G1 X3.0000 Y11.0000 Z-5.5503
+G1 X2.5000 Y11.0000 Z-5.5379
+G1 X2.0000 Y11.0000 Z-5.5279
+G1 X1.5000 Y11.0000 Z-5.5200
+G1 X1.0000 Y11.0000 Z-5.5145
+G1 X0.5000 Y11.0000 Z-5.5111
+G1 X0.0000 Y11.0000 Z-5.5100
+G1 X-0.5000 Y11.0000 Z-5.5111
+G1 X-1.0000 Y11.0000 Z-5.5145
+G1 X-1.5000 Y11.0000 Z-5.5200
+G1 X-2.0000 Y11.0000 Z-5.5279
+G1 X-2.5000 Y11.0000 Z-5.5379
+G1 X-3.0000 Y11.0000 Z-5.5503
+G1 X-3.5000 Y11.0000 Z-5.5649
+G1 X-4.0000 Y11.0000 Z-5.5819
+G1 X-4.5000 Y11.0000 Z-5.6011
+G1 X-5.0000 Y11.0000 Z-5.6228
+G1 X-5.5000 Y11.0000 Z-5.6468
+G1 X-6.0000 Y11.0000 Z-5.6733
+G1 X-6.5000 Y11.0000 Z-5.7023
+G1 X-7.0000 Y11.0000 Z-5.7339
+G1 X-7.5000 Y11.0000 Z-5.7680
+G1 X-8.0000 Y11.0000 Z-5.8048
+G1 X-8.5000 Y11.0000 Z-5.8443
+G1 X-9.0000 Y11.0000 Z-5.8866
+G1 X-9.5000 Y11.0000 Z-5.9318
+G1 X-10.0000 Y11.0000 Z-5.9800
+G1 X-10.5000 Y11.0000 Z-6.0314
+G1 X-11.0000 Y11.0000 Z-6.0859
+G1 X-11.5000 Y11.0000 Z-6.1438
+G1 X-12.0000 Y11.0000 Z-6.2053
+G1 X-12.5000 Y11.0000 Z-6.2704
+G1 X-13.0000 Y11.0000 Z-6.3394
+G1 X-13.5000 Y11.0000 Z-6.4125
+G1 X-14.0000 Y11.0000 Z-6.4900
+G1 X-14.5000 Y11.0000 Z-6.5722
+G1 X-15.0000 Y11.0000 Z-6.6593
+G1 X-15.5000 Y11.0000 Z-6.7519
+G1 X-16.0000 Y11.0000 Z-6.8504
+G1 X-16.5000 Y11.0000 Z-6.9553
+G1 X-17.0000 Y11.0000 Z-7.0674
+G1 X-17.5000 Y11.0000 Z-7.1875
+G1 X-18.0000 Y11.0000 Z-7.3167
+G1 X-18.5000 Y11.0000 Z-7.4564
+G1 X-19.0000 Y11.0000 Z-7.6083
+G1 X-19.5000 Y11.0000 Z-7.7751
+G1 X-20.0000 Y11.0000 Z-7.9604
+G1 X-20.0000 Y12.0000 Z-8.2000
+G1 X-19.5000 Y12.0000 Z-7.9925
+G1 X-19.0000 Y12.0000 Z-7.8091
+G1 X-18.5000 Y12.0000 Z-7.6442
+G1 X-18.0000 Y12.0000 Z-7.4940
+G1 X-17.5000 Y12.0000 Z-7.3561
+G1 X-17.0000 Y12.0000 Z-7.2287
+G1 X-16.5000 Y12.0000 Z-7.1104
+G1 X-16.0000 Y12.0000 Z-7.0000
+G1 X-15.5000 Y12.0000 Z-6.8968
+G1 X-15.0000 Y12.0000 Z-6.8000
+G1 X-14.5000 Y12.0000 Z-6.7091
+G1 X-14.0000 Y12.0000 Z-6.6236
+G1 X-13.5000 Y12.0000 Z-6.5431
+G1 X-13.0000 Y12.0000 Z-6.4673
+G1 X-12.5000 Y12.0000 Z-6.3958
+G1 X-12.0000 Y12.0000 Z-6.3285
+G1 X-11.5000 Y12.0000 Z-6.2650
+G1 X-11.0000 Y12.0000 Z-6.2053
+G1 X-10.5000 Y12.0000 Z-6.1490
+G1 X-10.0000 Y12.0000 Z-6.0962
+G1 X-9.5000 Y12.0000 Z-6.0465
+G1 X-9.0000 Y12.0000 Z-6.0000
+G1 X-8.5000 Y12.0000 Z-5.9565
+G1 X-8.0000 Y12.0000 Z-5.9159
+G1 X-7.5000 Y12.0000 Z-5.8781
+G1 X-7.0000 Y12.0000 Z-5.8431
+G1 X-6.5000 Y12.0000 Z-5.8107
+G1 X-6.0000 Y12.0000 Z-5.7810
+G1 X-5.5000 Y12.0000 Z-5.7538
+G1 X-5.0000 Y12.0000 Z-5.7292
+G1 X-4.5000 Y12.0000 Z-5.7070
+G1 X-4.0000 Y12.0000 Z-5.6872
+G1 X-3.5000 Y12.0000 Z-5.6699
+G1 X-3.0000 Y12.0000 Z-5.6549
+G1 X-2.5000 Y12.0000 Z-5.6422
+G1 X-2.0000 Y12.0000 Z-5.6319
+G1 X-1.5000 Y12.0000 Z-5.6239
+G1 X-1.0000 Y12.0000 Z-5.6182
+G1 X-0.5000 Y12.0000 Z-5.6148
+G1 X0.0000 Y12.0000 Z-5.6137
+G1 X0.5000 Y12.0000 Z-5.6148
+G1 X1.0000 Y12.0000 Z-5.6182
+G1 X1.5000 Y12.0000 Z-5.6239
+G1 X2.0000 Y12.0000 Z-5.6319
+G1 X2.5000 Y12.0000 Z-5.6422
+G1 X3.0000 Y12.0000 Z-5.6549
+G1 X3.5000 Y12.0000 Z-5.6699
+G1 X4.0000 Y12.0000 Z-5.6872
+G1 X4.5000 Y12.0000 Z-5.7070
+G1 X5.0000 Y12.0000 Z-5.7292
+G1 X5.5000 Y12.0000 Z-5.7538
+G1 X6.0000 Y12.0000 Z-5.7810
+G1 X6.5000 Y12.0000 Z-5.8107
+G1 X7.0000 Y12.0000 Z-5.8431
+G1 X7.5000 Y12.0000 Z-5.8781
+G1 X8.0000 Y12.0000 Z-5.9159
+G1 X8.5000 Y12.0000 Z-5.9565
+G1 X9.0000 Y12.0000 Z-6.0000
+G1 X9.5000 Y12.0000 Z-6.0465
+G1 X10.0000 Y12.0000 Z-6.0962
+G1 X10.5000 Y12.0000 Z-6.1490
+G1 X11.0000 Y12.0000 Z-6.2053
+G1 X11.5000 Y12.0000 Z-6.2650
+G1 X12.0000 Y12.0000 Z-6.3285
+G1 X12.5000 Y12.0000 Z-6.3958
+G1 X13.0000 Y12.0000 Z-6.4673
+G1 X13.5000 Y12.0000 Z-6.5431
+G1 X14.0000 Y12.0000 Z-6.6236
+G1 X14.5000 Y12.0000 Z-6.7091
+G1 X15.0000 Y12.0000 Z-6.8000
+G1 X15.5000 Y12.0000 Z-6.8968
+G1 X16.0000 Y12.0000 Z-7.0000
+G1 X16.5000 Y12.0000 Z-7.1104
+G1 X17.0000 Y12.0000 Z-7.2287
+G1 X17.5000 Y12.0000 Z-7.3561
+G1 X18.0000 Y12.0000 Z-7.4940
+G1 X18.5000 Y12.0000 Z-7.6442
+G1 X19.0000 Y12.0000 Z-7.8091
+G1 X19.5000 Y12.0000 Z-7.9925
+G1 X20.0000 Y12.0000 Z-8.2000
+G1 X20.0000 Y13.0000 Z-8.5033
+G1 X19.5000 Y13.0000 Z-8.2593
+G1 X19.0000 Y13.0000 Z-8.0506
+G1 X18.5000 Y13.0000 Z-7.8669
+G1 X18.0000 Y13.0000 Z-7.7022
+G1 X17.5000 Y13.0000 Z-7.5526
+G1 X17.0000 Y13.0000 Z-7.4154
+G1 X16.5000 Y13.0000 Z-7.2889
+G1 X16.0000 Y13.0000 Z-7.1716
+G1 X15.5000 Y13.0000 Z-7.0623
+G1 X15.0000 Y13.0000 Z-6.9603
+G1 X14.5000 Y13.0000 Z-6.8647
+G1 X14.0000 Y13.0000 Z-6.7751
+G1 X13.5000 Y13.0000 Z-6.6909
+G1 X13.0000 Y13.0000 Z-6.6118
+G1 X12.5000 Y13.0000 Z-6.5373
+G1 X12.0000 Y13.0000 Z-6.4673
+G1 X11.5000 Y13.0000 Z-6.4014
+G1 X11.0000 Y13.0000 Z-6.3394
+G1 X10.5000 Y13.0000 Z-6.2811
+G1 X10.0000 Y13.0000 Z-6.2264
+G1 X9.5000 Y13.0000 Z-6.1751
+G1 X9.0000 Y13.0000 Z-6.1270
+G1 X8.5000 Y13.0000 Z-6.0821
+G1 X8.0000 Y13.0000 Z-6.0402
+G1 X7.5000 Y13.0000 Z-6.0013
+G1 X7.0000 Y13.0000 Z-5.9652
+G1 X6.5000 Y13.0000 Z-5.9318
+G1 X6.0000 Y13.0000 Z-5.9012
+G1 X5.5000 Y13.0000 Z-5.8733
+G1 X5.0000 Y13.0000 Z-5.8479
+G1 X4.5000 Y13.0000 Z-5.8251
+G1 X4.0000 Y13.0000 Z-5.8048
+G1 X3.5000 Y13.0000 Z-5.7869
+G1 X3.0000 Y13.0000 Z-5.7715
+G1 X2.5000 Y13.0000 Z-5.7585
+G1 X2.0000 Y13.0000 Z-5.7479
+G1 X1.5000 Y13.0000 Z-5.7397
+G1 X1.0000 Y13.0000 Z-5.7339
+G1 X0.5000 Y13.0000 Z-5.7303
+G1 X0.0000 Y13.0000 Z-5.7292
+G1 X-0.5000 Y13.0000 Z-5.7303
+G1 X-1.0000 Y13.0000 Z-5.7339
+G1 X-1.5000 Y13.0000 Z-5.7397
+G1 X-2.0000 Y13.0000 Z-5.7479
+G1 X-2.5000 Y13.0000 Z-5.7585
+G1 X-3.0000 Y13.0000 Z-5.7715
+G1 X-3.5000 Y13.0000 Z-5.7869
+G1 X-4.0000 Y13.0000 Z-5.8048
+G1 X-4.5000 Y13.0000 Z-5.8251
+G1 X-5.0000 Y13.0000 Z-5.8479
+G1 X-5.5000 Y13.0000 Z-5.8733
+G1 X-6.0000 Y13.0000 Z-5.9012
+G1 X-6.5000 Y13.0000 Z-5.9318
+G1 X-7.0000 Y13.0000 Z-5.9652
+G1 X-7.5000 Y13.0000 Z-6.0013
+G1 X-8.0000 Y13.0000 Z-6.0402
+G1 X-8.5000 Y13.0000 Z-6.0821
+G1 X-9.0000 Y13.0000 Z-6.1270
+G1 X-9.5000 Y13.0000 Z-6.1751
+G1 X-10.0000 Y13.0000 Z-6.2264
+G1 X-10.5000 Y13.0000 Z-6.2811
+G1 X-11.0000 Y13.0000 Z-6.3394
+G1 X-11.5000 Y13.0000 Z-6.4014
+G1 X-12.0000 Y13.0000 Z-6.4673
+G1 X-12.5000 Y13.0000 Z-6.5373
+G1 X-13.0000 Y13.0000 Z-6.6118
+G1 X-13.5000 Y13.0000 Z-6.6909
+G1 X-14.0000 Y13.0000 Z-6.7751
+G1 X-14.5000 Y13.0000 Z-6.8647
+G1 X-15.0000 Y13.0000 Z-6.9603
+G1 X-15.5000 Y13.0000 Z-7.0623
+G1 X-16.0000 Y13.0000 Z-7.1716
+G1 X-16.5000 Y13.0000 Z-7.2889
+G1 X-17.0000 Y13.0000 Z-7.4154
+G1 X-17.5000 Y13.0000 Z-7.5526
+G1 X-18.0000 Y13.0000 Z-7.7022
+G1 X-18.5000 Y13.0000 Z-7.8669
+G1 X-19.0000 Y13.0000 Z-8.0506
+G1 X-19.5000 Y13.0000 Z-8.2593
+G1 X-20.0000 Y13.0000 Z-8.5033
+G1 X-20.0000 Y14.0000 Z-8.9230
+G1 X-19.5000 Y14.0000 Z-8.6036
+G1 X-19.0000 Y14.0000 Z-8.3508
+G1 X-18.5000 Y14.0000 Z-8.1372
+G1 X-18.0000 Y14.0000 Z-7.9506
+G1 X-17.5000 Y14.0000 Z-7.7841
+G1 X-17.0000 Y14.0000 Z-7.6336
+G1 X-16.5000 Y14.0000 Z-7.4960
+G1 X-16.0000 Y14.0000 Z-7.3694
+G1 X-15.5000 Y14.0000 Z-7.2523
+G1 X-15.0000 Y14.0000 Z-7.1434
+G1 X-14.5000 Y14.0000 Z-7.0420
+G1 X-14.0000 Y14.0000 Z-6.9471
+G1 X-13.5000 Y14.0000 Z-6.8583
+G1 X-13.0000 Y14.0000 Z-6.7751
+G1 X-12.5000 Y14.0000 Z-6.6970
+G1 X-12.0000 Y14.0000 Z-6.6236
+G1 X-11.5000 Y14.0000 Z-6.5547
+G1 X-11.0000 Y14.0000 Z-6.4900
+G1 X-10.5000 Y14.0000 Z-6.4293
+G1 X-10.0000 Y14.0000 Z-6.3723
+G1 X-9.5000 Y14.0000 Z-6.3190
+G1 X-9.0000 Y14.0000 Z-6.2690
+G1 X-8.5000 Y14.0000 Z-6.2224
+G1 X-8.0000 Y14.0000 Z-6.1790
+G1 X-7.5000 Y14.0000 Z-6.1387
+G1 X-7.0000 Y14.0000 Z-6.1013
+G1 X-6.5000 Y14.0000 Z-6.0668
+G1 X-6.0000 Y14.0000 Z-6.0352
+G1 X-5.5000 Y14.0000 Z-6.0063
+G1 X-5.0000 Y14.0000 Z-5.9800
+G1 X-4.5000 Y14.0000 Z-5.9565
+G1 X-4.0000 Y14.0000 Z-5.9355
+G1 X-3.5000 Y14.0000 Z-5.9171
+G1 X-3.0000 Y14.0000 Z-5.9012
+G1 X-2.5000 Y14.0000 Z-5.8878
+G1 X-2.0000 Y14.0000 Z-5.8769
+G1 X-1.5000 Y14.0000 Z-5.8684
+G1 X-1.0000 Y14.0000 Z-5.8624
+G1 X-0.5000 Y14.0000 Z-5.8587
+G1 X0.0000 Y14.0000 Z-5.8575
+G1 X0.5000 Y14.0000 Z-5.8587
+G1 X1.0000 Y14.0000 Z-5.8624
+G1 X1.5000 Y14.0000 Z-5.8684
+G1 X2.0000 Y14.0000 Z-5.8769
+G1 X2.5000 Y14.0000 Z-5.8878
+G1 X3.0000 Y14.0000 Z-5.9012
+G1 X3.5000 Y14.0000 Z-5.9171
+G1 X4.0000 Y14.0000 Z-5.9355
+G1 X4.5000 Y14.0000 Z-5.9565
+G1 X5.0000 Y14.0000 Z-5.9800
+G1 X5.5000 Y14.0000 Z-6.0063
+G1 X6.0000 Y14.0000 Z-6.0352
+G1 X6.5000 Y14.0000 Z-6.0668
+G1 X7.0000 Y14.0000 Z-6.1013
+G1 X7.5000 Y14.0000 Z-6.1387
+G1 X8.0000 Y14.0000 Z-6.1790
+G1 X8.5000 Y14.0000 Z-6.2224
+G1 X9.0000 Y14.0000 Z-6.2690
+G1 X9.5000 Y14.0000 Z-6.3190
+G1 X10.0000 Y14.0000 Z-6.3723
+G1 X10.5000 Y14.0000 Z-6.4293
+G1 X11.0000 Y14.0000 Z-6.4900
+G1 X11.5000 Y14.0000 Z-6.5547
+G1 X12.0000 Y14.0000 Z-6.6236
+G1 X12.5000 Y14.0000 Z-6.6970
+G1 X13.0000 Y14.0000 Z-6.7751
+G1 X13.5000 Y14.0000 Z-6.8583
+G1 X14.0000 Y14.0000 Z-6.9471
+G1 X14.5000 Y14.0000 Z-7.0420
+G1 X15.0000 Y14.0000 Z-7.1434
+G1 X15.5000 Y14.0000 Z-7.2523
+G1 X16.0000 Y14.0000 Z-7.3694
+G1 X16.5000 Y14.0000 Z-7.4960
+G1 X17.0000 Y14.0000 Z-7.6336
+G1 X17.5000 Y14.0000 Z-7.7841
+G1 X18.0000 Y14.0000 Z-7.9506
+G1 X18.5000 Y14.0000 Z-8.1372
+G1 X19.0000 Y14.0000 Z-8.3508
+G1 X19.5000 Y14.0000 Z-8.6036
+G1 X20.0000 Y14.0000 Z-8.9230
+G1 X20.0000 Y15.0000 Z-10.0000
+G1 X19.5000 Y15.0000 Z-9.1112
+G1 X19.0000 Y15.0000 Z-8.7510
+G1 X18.5000 Y15.0000 Z-8.4801
+G1 X18.0000 Y15.0000 Z-8.2564
+G1 X17.5000 Y15.0000 Z-8.0635
+G1 X17.0000 Y15.0000 Z-7.8929
+G1 X16.5000 Y15.0000 Z-7.7395
+G1 X16.0000 Y15.0000 Z-7.6000
+G1 X15.5000 Y15.0000 Z-7.4722
+G1 X15.0000 Y15.0000 Z-7.3542
+G1 X14.5000 Y15.0000 Z-7.2450
+G1 X14.0000 Y15.0000 Z-7.1434
+G1 X13.5000 Y15.0000 Z-7.0487
+G1 X13.0000 Y15.0000 Z-6.9603
+G1 X12.5000 Y15.0000 Z-6.8775
+G1 X12.0000 Y15.0000 Z-6.8000
+G1 X11.5000 Y15.0000 Z-6.7274
+G1 X11.0000 Y15.0000 Z-6.6593
+G1 X10.5000 Y15.0000 Z-6.5956
+G1 X10.0000 Y15.0000 Z-6.5359
+G1 X9.5000 Y15.0000 Z-6.4801
+G1 X9.0000 Y15.0000 Z-6.4279
+G1 X8.5000 Y15.0000 Z-6.3792
+G1 X8.0000 Y15.0000 Z-6.3339
+G1 X7.5000 Y15.0000 Z-6.2919
+G1 X7.0000 Y15.0000 Z-6.2530
+G1 X6.5000 Y15.0000 Z-6.2171
+G1 X6.0000 Y15.0000 Z-6.1842
+G1 X5.5000 Y15.0000 Z-6.1542
+G1 X5.0000 Y15.0000 Z-6.1270
+G1 X4.5000 Y15.0000 Z-6.1026
+G1 X4.0000 Y15.0000 Z-6.0808
+G1 X3.5000 Y15.0000 Z-6.0617
+G1 X3.0000 Y15.0000 Z-6.0453
+G1 X2.5000 Y15.0000 Z-6.0314
+G1 X2.0000 Y15.0000 Z-6.0201
+G1 X1.5000 Y15.0000 Z-6.0113
+G1 X1.0000 Y15.0000 Z-6.0050
+G1 X0.5000 Y15.0000 Z-6.0013
+G1 X0.0000 Y15.0000 Z-6.0000
+G1 X-0.5000 Y15.0000 Z-6.0013
+G1 X-1.0000 Y15.0000 Z-6.0050
+G1 X-1.5000 Y15.0000 Z-6.0113
+G1 X-2.0000 Y15.0000 Z-6.0201
+G1 X-2.5000 Y15.0000 Z-6.0314
+G1 X-3.0000 Y15.0000 Z-6.0453
+G1 X-3.5000 Y15.0000 Z-6.0617
+G1 X-4.0000 Y15.0000 Z-6.0808
+G1 X-4.5000 Y15.0000 Z-6.1026
+G1 X-5.0000 Y15.0000 Z-6.1270
+G1 X-5.5000 Y15.0000 Z-6.1542
+G1 X-6.0000 Y15.0000 Z-6.1842
+G1 X-6.5000 Y15.0000 Z-6.2171
+G1 X-7.0000 Y15.0000 Z-6.2530
+G1 X-7.5000 Y15.0000 Z-6.2919
+G1 X-8.0000 Y15.0000 Z-6.3339
+G1 X-8.5000 Y15.0000 Z-6.3792
+G1 X-9.0000 Y15.0000 Z-6.4279
+G1 X-9.5000 Y15.0000 Z-6.4801
+G1 X-10.0000 Y15.0000 Z-6.5359
+G1 X-10.5000 Y15.0000 Z-6.5956
+G1 X-11.0000 Y15.0000 Z-6.6593
+G1 X-11.5000 Y15.0000 Z-6.7274
+G1 X-12.0000 Y15.0000 Z-6.8000
+G1 X-12.5000 Y15.0000 Z-6.8775
+G1 X-13.0000 Y15.0000 Z-6.9603
+G1 X-13.5000 Y15.0000 Z-7.0487
+G1 X-14.0000 Y15.0000 Z-7.1434
+G1 X-14.5000 Y15.0000 Z-7.2450
+G1 X-15.0000 Y15.0000 Z-7.3542
+G1 X-15.5000 Y15.0000 Z-7.4722
+G1 X-16.0000 Y15.0000 Z-7.6000
+G1 X-16.5000 Y15.0000 Z-7.7395
+G1 X-17.0000 Y15.0000 Z-7.8929
+G1 X-17.5000 Y15.0000 Z-8.0635
+G1 X-18.0000 Y15.0000 Z-8.2564
+G1 X-18.5000 Y15.0000 Z-8.4801
+G1 X-19.0000 Y15.0000 Z-8.7510
+G1 X-19.5000 Y15.0000 Z-9.1112
+G1 X-20.0000 Y15.0000 Z-10.0000
+G1 X-20.0000 Y16.0000 Z-10.0000
+G1 X-19.5000 Y16.0000 Z-10.0000
+G1 X-19.0000 Y16.0000 Z-9.4343
+G1 X-18.5000 Y16.0000 Z-8.9656
+G1 X-18.0000 Y16.0000 Z-8.6584
+G1 X-17.5000 Y16.0000 Z-8.4157
+G1 X-17.0000 Y16.0000 Z-8.2111
+G1 X-16.5000 Y16.0000 Z-8.0328
+G1 X-16.0000 Y16.0000 Z-7.8740
+G1 X-15.5000 Y16.0000 Z-7.7306
+G1 X-15.0000 Y16.0000 Z-7.6000
+G1 X-14.5000 Y16.0000 Z-7.4801
+G1 X-14.0000 Y16.0000 Z-7.3694
+G1 X-13.5000 Y16.0000 Z-7.2669
+G1 X-13.0000 Y16.0000 Z-7.1716
+G1 X-12.5000 Y16.0000 Z-7.0828
+G1 X-12.0000 Y16.0000 Z-7.0000
+G1 X-11.5000 Y16.0000 Z-6.9227
+G1 X-11.0000 Y16.0000 Z-6.8504
+G1 X-10.5000 Y16.0000 Z-6.7829
+G1 X-10.0000 Y16.0000 Z-6.7198
+G1 X-9.5000 Y16.0000 Z-6.6608
+G1 X-9.0000 Y16.0000 Z-6.6059
+G1 X-8.5000 Y16.0000 Z-6.5547
+G1 X-8.0000 Y16.0000 Z-6.5072
+G1 X-7.5000 Y16.0000 Z-6.4631
+G1 X-7.0000 Y16.0000 Z-6.4223
+G1 X-6.5000 Y16.0000 Z-6.3848
+G1 X-6.0000 Y16.0000 Z-6.3503
+G1 X-5.5000 Y16.0000 Z-6.3190
+G1 X-5.0000 Y16.0000 Z-6.2906
+G1 X-4.5000 Y16.0000 Z-6.2650
+G1 X-4.0000 Y16.0000 Z-6.2423
+G1 X-3.5000 Y16.0000 Z-6.2224
+G1 X-3.0000 Y16.0000 Z-6.2053
+G1 X-2.5000 Y16.0000 Z-6.1908
+G1 X-2.0000 Y16.0000 Z-6.1790
+G1 X-1.5000 Y16.0000 Z-6.1699
+G1 X-1.0000 Y16.0000 Z-6.1633
+G1 X-0.5000 Y16.0000 Z-6.1594
+G1 X0.0000 Y16.0000 Z-6.1581
+G1 X0.5000 Y16.0000 Z-6.1594
+G1 X1.0000 Y16.0000 Z-6.1633
+G1 X1.5000 Y16.0000 Z-6.1699
+G1 X2.0000 Y16.0000 Z-6.1790
+G1 X2.5000 Y16.0000 Z-6.1908
+G1 X3.0000 Y16.0000 Z-6.2053
+G1 X3.5000 Y16.0000 Z-6.2224
+G1 X4.0000 Y16.0000 Z-6.2423
+G1 X4.5000 Y16.0000 Z-6.2650
+G1 X5.0000 Y16.0000 Z-6.2906
+G1 X5.5000 Y16.0000 Z-6.3190
+G1 X6.0000 Y16.0000 Z-6.3503
+G1 X6.5000 Y16.0000 Z-6.3848
+G1 X7.0000 Y16.0000 Z-6.4223
+G1 X7.5000 Y16.0000 Z-6.4631
+G1 X8.0000 Y16.0000 Z-6.5072
+G1 X8.5000 Y16.0000 Z-6.5547
+G1 X9.0000 Y16.0000 Z-6.6059
+G1 X9.5000 Y16.0000 Z-6.6608
+G1 X10.0000 Y16.0000 Z-6.7198
+G1 X10.5000 Y16.0000 Z-6.7829
+G1 X11.0000 Y16.0000 Z-6.8504
+G1 X11.5000 Y16.0000 Z-6.9227
+G1 X12.0000 Y16.0000 Z-7.0000
+G1 X12.5000 Y16.0000 Z-7.0828
+G1 X13.0000 Y16.0000 Z-7.1716
+G1 X13.5000 Y16.0000 Z-7.2669
+G1 X14.0000 Y16.0000 Z-7.3694
+G1 X14.5000 Y16.0000 Z-7.4801
+G1 X15.0000 Y16.0000 Z-7.6000
+G1 X15.5000 Y16.0000 Z-7.7306
+G1 X16.0000 Y16.0000 Z-7.8740
+G1 X16.5000 Y16.0000 Z-8.0328
+G1 X17.0000 Y16.0000 Z-8.2111
+G1 X17.5000 Y16.0000 Z-8.4157
+G1 X18.0000 Y16.0000 Z-8.6584
+G1 X18.5000 Y16.0000 Z-8.9656
+G1 X19.0000 Y16.0000 Z-9.4343
+G1 X19.5000 Y16.0000 Z-10.0000
+G1 X20.0000 Y16.0000 Z-10.0000
+G1 X20.0000 Y17.0000 Z-10.0000
+G1 X19.5000 Y17.0000 Z-10.0000
+G1 X19.0000 Y17.0000 Z-10.0000
+G1 X18.5000 Y17.0000 Z-10.0000
+G1 X18.0000 Y17.0000 Z-9.3072
+G1 X17.5000 Y17.0000 Z-8.9091
+G1 X17.0000 Y17.0000 Z-8.6289
+G1 X16.5000 Y17.0000 Z-8.4031
+G1 X16.0000 Y17.0000 Z-8.2111
+G1 X15.5000 Y17.0000 Z-8.0430
+G1 X15.0000 Y17.0000 Z-7.8929
+G1 X14.5000 Y17.0000 Z-7.7572
+G1 X14.0000 Y17.0000 Z-7.6336
+G1 X13.5000 Y17.0000 Z-7.5201
+G1 X13.0000 Y17.0000 Z-7.4154
+G1 X12.5000 Y17.0000 Z-7.3186
+G1 X12.0000 Y17.0000 Z-7.2287
+G1 X11.5000 Y17.0000 Z-7.1452
+G1 X11.0000 Y17.0000 Z-7.0674
+G1 X10.5000 Y17.0000 Z-6.9950
+G1 X10.0000 Y17.0000 Z-6.9275
+G1 X9.5000 Y17.0000 Z-6.8647
+G1 X9.0000 Y17.0000 Z-6.8063
+G1 X8.5000 Y17.0000 Z-6.7519
+G1 X8.0000 Y17.0000 Z-6.7015
+G1 X7.5000 Y17.0000 Z-6.6549
+G1 X7.0000 Y17.0000 Z-6.6118
+G1 X6.5000 Y17.0000 Z-6.5722
+G1 X6.0000 Y17.0000 Z-6.5359
+G1 X5.5000 Y17.0000 Z-6.5029
+G1 X5.0000 Y17.0000 Z-6.4730
+G1 X4.5000 Y17.0000 Z-6.4461
+G1 X4.0000 Y17.0000 Z-6.4223
+G1 X3.5000 Y17.0000 Z-6.4014
+G1 X3.0000 Y17.0000 Z-6.3834
+G1 X2.5000 Y17.0000 Z-6.3682
+G1 X2.0000 Y17.0000 Z-6.3558
+G1 X1.5000 Y17.0000 Z-6.3462
+G1 X1.0000 Y17.0000 Z-6.3394
+G1 X0.5000 Y17.0000 Z-6.3353
+G1 X0.0000 Y17.0000 Z-6.3339
+G1 X-0.5000 Y17.0000 Z-6.3353
+G1 X-1.0000 Y17.0000 Z-6.3394
+G1 X-1.5000 Y17.0000 Z-6.3462
+G1 X-2.0000 Y17.0000 Z-6.3558
+G1 X-2.5000 Y17.0000 Z-6.3682
+G1 X-3.0000 Y17.0000 Z-6.3834
+G1 X-3.5000 Y17.0000 Z-6.4014
+G1 X-4.0000 Y17.0000 Z-6.4223
+G1 X-4.5000 Y17.0000 Z-6.4461
+G1 X-5.0000 Y17.0000 Z-6.4730
+G1 X-5.5000 Y17.0000 Z-6.5029
+G1 X-6.0000 Y17.0000 Z-6.5359
+G1 X-6.5000 Y17.0000 Z-6.5722
+G1 X-7.0000 Y17.0000 Z-6.6118
+G1 X-7.5000 Y17.0000 Z-6.6549
+G1 X-8.0000 Y17.0000 Z-6.7015
+G1 X-8.5000 Y17.0000 Z-6.7519
+G1 X-9.0000 Y17.0000 Z-6.8063
+G1 X-9.5000 Y17.0000 Z-6.8647
+G1 X-10.0000 Y17.0000 Z-6.9275
+G1 X-10.5000 Y17.0000 Z-6.9950
+G1 X-11.0000 Y17.0000 Z-7.0674
+G1 X-11.5000 Y17.0000 Z-7.1452
+G1 X-12.0000 Y17.0000 Z-7.2287
+G1 X-12.5000 Y17.0000 Z-7.3186
+G1 X-13.0000 Y17.0000 Z-7.4154
+G1 X-13.5000 Y17.0000 Z-7.5201
+G1 X-14.0000 Y17.0000 Z-7.6336
+G1 X-14.5000 Y17.0000 Z-7.7572
+G1 X-15.0000 Y17.0000 Z-7.8929
+G1 X-15.5000 Y17.0000 Z-8.0430
+G1 X-16.0000 Y17.0000 Z-8.2111
+G1 X-16.5000 Y17.0000 Z-8.4031
+G1 X-17.0000 Y17.0000 Z-8.6289
+G1 X-17.5000 Y17.0000 Z-8.9091
+G1 X-18.0000 Y17.0000 Z-9.3072
+G1 X-18.5000 Y17.0000 Z-10.0000
+G1 X-19.0000 Y17.0000 Z-10.0000
+G1 X-19.5000 Y17.0000 Z-10.0000
+G1 X-20.0000 Y17.0000 Z-10.0000
+G1 X-20.0000 Y18.0000 Z-10.0000
+G1 X-19.5000 Y18.0000 Z-10.0000
+G1 X-19.0000 Y18.0000 Z-10.0000
+G1 X-18.5000 Y18.0000 Z-10.0000
+G1 X-18.0000 Y18.0000 Z-10.0000
+G1 X-17.5000 Y18.0000 Z-10.0000
+G1 X-17.0000 Y18.0000 Z-9.3072
+G1 X-16.5000 Y18.0000 Z-8.9276
+G1 X-16.0000 Y18.0000 Z-8.6584
+G1 X-15.5000 Y18.0000 Z-8.4412
+G1 X-15.0000 Y18.0000 Z-8.2564
+G1 X-14.5000 Y18.0000 Z-8.0947
+G1 X-14.0000 Y18.0000 Z-7.9506
+G1 X-13.5000 Y18.0000 Z-7.8206
+G1 X-13.0000 Y18.0000 Z-7.7022
+G1 X-12.5000 Y18.0000 Z-7.5938
+G1 X-12.0000 Y18.0000 Z-7.4940
+G1 X-11.5000 Y18.0000 Z-7.4019
+G1 X-11.0000 Y18.0000 Z-7.3167
+G1 X-10.5000 Y18.0000 Z-7.2378
+G1 X-10.0000 Y18.0000 Z-7.1645
+G1 X-9.5000 Y18.0000 Z-7.0966
+G1 X-9.0000 Y18.0000 Z-7.0335
+G1 X-8.5000 Y18.0000 Z-6.9751
+G1 X-8.0000 Y18.0000 Z-6.9210
+G1 X-7.5000 Y18.0000 Z-6.8711
+G1 X-7.0000 Y18.0000 Z-6.8251
+G1 X-6.5000 Y18.0000 Z-6.7829
+G1 X-6.0000 Y18.0000 Z-6.7442
+G1 X-5.5000 Y18.0000 Z-6.7091
+G1 X-5.0000 Y18.0000 Z-6.6774
+G1 X-4.5000 Y18.0000 Z-6.6489
+G1 X-4.0000 Y18.0000 Z-6.6236
+G1 X-3.5000 Y18.0000 Z-6.6015
+G1 X-3.0000 Y18.0000 Z-6.5824
+G1 X-2.5000 Y18.0000 Z-6.5663
+G1 X-2.0000 Y18.0000 Z-6.5533
+G1 X-1.5000 Y18.0000 Z-6.5431
+G1 X-1.0000 Y18.0000 Z-6.5359
+G1 X-0.5000 Y18.0000 Z-6.5316
+G1 X0.0000 Y18.0000 Z-6.5301
+G1 X0.5000 Y18.0000 Z-6.5316
+G1 X1.0000 Y18.0000 Z-6.5359
+G1 X1.5000 Y18.0000 Z-6.5431
+G1 X2.0000 Y18.0000 Z-6.5533
+G1 X2.5000 Y18.0000 Z-6.5663
+G1 X3.0000 Y18.0000 Z-6.5824
+G1 X3.5000 Y18.0000 Z-6.6015
+G1 X4.0000 Y18.0000 Z-6.6236
+G1 X4.5000 Y18.0000 Z-6.6489
+G1 X5.0000 Y18.0000 Z-6.6774
+G1 X5.5000 Y18.0000 Z-6.7091
+G1 X6.0000 Y18.0000 Z-6.7442
+G1 X6.5000 Y18.0000 Z-6.7829
+G1 X7.0000 Y18.0000 Z-6.8251
+G1 X7.5000 Y18.0000 Z-6.8711
+G1 X8.0000 Y18.0000 Z-6.9210
+G1 X8.5000 Y18.0000 Z-6.9751
+G1 X9.0000 Y18.0000 Z-7.0335
+G1 X9.5000 Y18.0000 Z-7.0966
+G1 X10.0000 Y18.0000 Z-7.1645
+G1 X10.5000 Y18.0000 Z-7.2378
+G1 X11.0000 Y18.0000 Z-7.3167
+G1 X11.5000 Y18.0000 Z-7.4019
+G1 X12.0000 Y18.0000 Z-7.4940
+G1 X12.5000 Y18.0000 Z-7.5938
+G1 X13.0000 Y18.0000 Z-7.7022
+G1 X13.5000 Y18.0000 Z-7.8206
+G1 X14.0000 Y18.0000 Z-7.9506
+G1 X14.5000 Y18.0000 Z-8.0947
+G1 X15.0000 Y18.0000 Z-8.2564
+G1 X15.5000 Y18.0000 Z-8.4412
+G1 X16.0000 Y18.0000 Z-8.6584
+G1 X16.5000 Y18.0000 Z-8.9276
+G1 X17.0000 Y18.0000 Z-9.3072
+G1 X17.5000 Y18.0000 Z-10.0000
+G1 X18.0000 Y18.0000 Z-10.0000
+G1 X18.5000 Y18.0000 Z-10.0000
+G1 X19.0000 Y18.0000 Z-10.0000
+G1 X19.5000 Y18.0000 Z-10.0000
+G1 X20.0000 Y18.0000 Z-10.0000
+G1 X20.0000 Y19.0000 Z-10.0000
+G1 X19.5000 Y19.0000 Z-10.0000
+G1 X19.0000 Y19.0000 Z-10.0000
+G1 X18.5000 Y19.0000 Z-10.0000
+G1 X18.0000 Y19.0000 Z-10.0000
+G1 X17.5000 Y19.0000 Z-10.0000
+G1 X17.0000 Y19.0000 Z-10.0000
+G1 X16.5000 Y19.0000 Z-10.0000
+G1 X16.0000 Y19.0000 Z-9.4343
+G1 X15.5000 Y19.0000 Z-9.0253
+G1 X15.0000 Y19.0000 Z-8.7510
+G1 X14.5000 Y19.0000 Z-8.5337
+G1 X14.0000 Y19.0000 Z-8.3508
+G1 X13.5000 Y19.0000 Z-8.1917
+G1 X13.0000 Y19.0000 Z-8.0506
+G1 X12.5000 Y19.0000 Z-7.9239
+G1 X12.0000 Y19.0000 Z-7.8091
+G1 X11.5000 Y19.0000 Z-7.7044
+G1 X11.0000 Y19.0000 Z-7.6083
+G1 X10.5000 Y19.0000 Z-7.5201
+G1 X10.0000 Y19.0000 Z-7.4388
+G1 X9.5000 Y19.0000 Z-7.3637
+G1 X9.0000 Y19.0000 Z-7.2945
+G1 X8.5000 Y19.0000 Z-7.2305
+G1 X8.0000 Y19.0000 Z-7.1716
+G1 X7.5000 Y19.0000 Z-7.1173
+G1 X7.0000 Y19.0000 Z-7.0674
+G1 X6.5000 Y19.0000 Z-7.0217
+G1 X6.0000 Y19.0000 Z-6.9801
+G1 X5.5000 Y19.0000 Z-6.9422
+G1 X5.0000 Y19.0000 Z-6.9081
+G1 X4.5000 Y19.0000 Z-6.8775
+G1 X4.0000 Y19.0000 Z-6.8504
+G1 X3.5000 Y19.0000 Z-6.8267
+G1 X3.0000 Y19.0000 Z-6.8063
+G1 X2.5000 Y19.0000 Z-6.7891
+G1 X2.0000 Y19.0000 Z-6.7751
+G1 X1.5000 Y19.0000 Z-6.7643
+G1 X1.0000 Y19.0000 Z-6.7565
+G1 X0.5000 Y19.0000 Z-6.7519
+G1 X0.0000 Y19.0000 Z-6.7504
+G1 X-0.5000 Y19.0000 Z-6.7519
+G1 X-1.0000 Y19.0000 Z-6.7565
+G1 X-1.5000 Y19.0000 Z-6.7643
+G1 X-2.0000 Y19.0000 Z-6.7751
+G1 X-2.5000 Y19.0000 Z-6.7891
+G1 X-3.0000 Y19.0000 Z-6.8063
+G1 X-3.5000 Y19.0000 Z-6.8267
+G1 X-4.0000 Y19.0000 Z-6.8504
+G1 X-4.5000 Y19.0000 Z-6.8775
+G1 X-5.0000 Y19.0000 Z-6.9081
+G1 X-5.5000 Y19.0000 Z-6.9422
+G1 X-6.0000 Y19.0000 Z-6.9801
+G1 X-6.5000 Y19.0000 Z-7.0217
+G1 X-7.0000 Y19.0000 Z-7.0674
+G1 X-7.5000 Y19.0000 Z-7.1173
+G1 X-8.0000 Y19.0000 Z-7.1716
+G1 X-8.5000 Y19.0000 Z-7.2305
+G1 X-9.0000 Y19.0000 Z-7.2945
+G1 X-9.5000 Y19.0000 Z-7.3637
+G1 X-10.0000 Y19.0000 Z-7.4388
+G1 X-10.5000 Y19.0000 Z-7.5201
+G1 X-11.0000 Y19.0000 Z-7.6083
+G1 X-11.5000 Y19.0000 Z-7.7044
+G1 X-12.0000 Y19.0000 Z-7.8091
+G1 X-12.5000 Y19.0000 Z-7.9239
+G1 X-13.0000 Y19.0000 Z-8.0506
+G1 X-13.5000 Y19.0000 Z-8.1917
+G1 X-14.0000 Y19.0000 Z-8.3508
+G1 X-14.5000 Y19.0000 Z-8.5337
+G1 X-15.0000 Y19.0000 Z-8.7510
+G1 X-15.5000 Y19.0000 Z-9.0253
+G1 X-16.0000 Y19.0000 Z-9.4343
+G1 X-16.5000 Y19.0000 Z-10.0000
+G1 X-17.0000 Y19.0000 Z-10.0000
+G1 X-17.5000 Y19.0000 Z-10.0000
+G1 X-18.0000 Y19.0000 Z-10.0000
+G1 X-18.5000 Y19.0000 Z-10.0000
+G1 X-19.0000 Y19.0000 Z-10.0000
+G1 X-19.5000 Y19.0000 Z-10.0000
+G1 X-20.0000 Y19.0000 Z-10.0000
+G1 X-20.0000 Y20.0000 Z-10.0000
+G1 X-19.5000 Y20.0000 Z-10.0000
+G1 X-19.0000 Y20.0000 Z-10.0000
+G1 X-18.5000 Y20.0000 Z-10.0000
+G1 X-18.0000 Y20.0000 Z-10.0000
+G1 X-17.5000 Y20.0000 Z-10.0000
+G1 X-17.0000 Y20.0000 Z-10.0000
+G1 X-16.5000 Y20.0000 Z-10.0000
+G1 X-16.0000 Y20.0000 Z-10.0000
+G1 X-15.5000 Y20.0000 Z-10.0000
+G1 X-15.0000 Y20.0000 Z-10.0000
+G1 X-14.5000 Y20.0000 Z-9.2319
+G1 X-14.0000 Y20.0000 Z-8.9230
+G1 X-13.5000 Y20.0000 Z-8.6923
+G1 X-13.0000 Y20.0000 Z-8.5033
+G1 X-12.5000 Y20.0000 Z-8.3417
+G1 X-12.0000 Y20.0000 Z-8.2000
+G1 X-11.5000 Y20.0000 Z-8.0739
+G1 X-11.0000 Y20.0000 Z-7.9604
+G1 X-10.5000 Y20.0000 Z-7.8576
+G1 X-10.0000 Y20.0000 Z-7.7639
+G1 X-9.5000 Y20.0000 Z-7.6784
+G1 X-9.0000 Y20.0000 Z-7.6000
+G1 X-8.5000 Y20.0000 Z-7.5282
+G1 X-8.0000 Y20.0000 Z-7.4623
+G1 X-7.5000 Y20.0000 Z-7.4019
+G1 X-7.0000 Y20.0000 Z-7.3467
+G1 X-6.5000 Y20.0000 Z-7.2963
+G1 X-6.0000 Y20.0000 Z-7.2505
+G1 X-5.5000 Y20.0000 Z-7.2089
+G1 X-5.0000 Y20.0000 Z-7.1716
+G1 X-4.5000 Y20.0000 Z-7.1382
+G1 X-4.0000 Y20.0000 Z-7.1086
+G1 X-3.5000 Y20.0000 Z-7.0828
+G1 X-3.0000 Y20.0000 Z-7.0606
+G1 X-2.5000 Y20.0000 Z-7.0420
+G1 X-2.0000 Y20.0000 Z-7.0268
+G1 X-1.5000 Y20.0000 Z-7.0150
+G1 X-1.0000 Y20.0000 Z-7.0067
+G1 X-0.5000 Y20.0000 Z-7.0017
+G1 X0.0000 Y20.0000 Z-7.0000
+G1 X0.5000 Y20.0000 Z-7.0017
+G1 X1.0000 Y20.0000 Z-7.0067
+G1 X1.5000 Y20.0000 Z-7.0150
+G1 X2.0000 Y20.0000 Z-7.0268
+G1 X2.5000 Y20.0000 Z-7.0420
+G1 X3.0000 Y20.0000 Z-7.0606
+G1 X3.5000 Y20.0000 Z-7.0828
+G1 X4.0000 Y20.0000 Z-7.1086
+G1 X4.5000 Y20.0000 Z-7.1382
+G1 X5.0000 Y20.0000 Z-7.1716
+G1 X5.5000 Y20.0000 Z-7.2089
+G1 X6.0000 Y20.0000 Z-7.2505
+G1 X6.5000 Y20.0000 Z-7.2963
+G1 X7.0000 Y20.0000 Z-7.3467
+G1 X7.5000 Y20.0000 Z-7.4019
+G1 X8.0000 Y20.0000 Z-7.4623
+G1 X8.5000 Y20.0000 Z-7.5282
+G1 X9.0000 Y20.0000 Z-7.6000
+G1 X9.5000 Y20.0000 Z-7.6784
+G1 X10.0000 Y20.0000 Z-7.7639
+G1 X10.5000 Y20.0000 Z-7.8576
+G1 X11.0000 Y20.0000 Z-7.9604
+G1 X11.5000 Y20.0000 Z-8.0739
+G1 X12.0000 Y20.0000 Z-8.2000
+G1 X12.5000 Y20.0000 Z-8.3417
+G1 X13.0000 Y20.0000 Z-8.5033
+G1 X13.5000 Y20.0000 Z-8.6923
+G1 X14.0000 Y20.0000 Z-8.9230
+G1 X14.5000 Y20.0000 Z-9.2319
+G1 X15.0000 Y20.0000 Z-10.0000
+G1 X15.5000 Y20.0000 Z-10.0000
+G1 X16.0000 Y20.0000 Z-10.0000
+G1 X16.5000 Y20.0000 Z-10.0000
+G1 X17.0000 Y20.0000 Z-10.0000
+G1 X17.5000 Y20.0000 Z-10.0000
+G1 X18.0000 Y20.0000 Z-10.0000
+G1 X18.5000 Y20.0000 Z-10.0000
+G1 X19.0000 Y20.0000 Z-10.0000
+G1 X19.5000 Y20.0000 Z-10.0000
+G1 X20.0000 Y20.0000 Z-10.0000
+G0 Z5.0000
+M2
@@ -0,0 +1,339 @@
+/** \file
+  \brief Check the maths functions against floating point and 64 bit math
+
+  \code
+  maths [count]
+  \endcode
+
+  Calls each function count times, 1000000 by default, with random
+  arguments and compares against a reference computed the slow way. Prints
+  the worst error found for each, and fails if that's more than documented
+  in dda_maths.c. Only the C code is checked, the AVR assembly isn't built
+  here.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "dda_maths.h"
+
+static long count = 1000000;
+static int failed = 0;
+
+/// random number of a random width, so small values are tested as well
+static uint32_t random_bits(uint8_t max_bits) {
+  uint32_t r = ((uint32_t)rand() << 16) ^ (uint32_t)rand() ^
+               ((uint32_t)rand() << 31);
+  uint8_t bits = rand() % (max_bits + 1);
+
+  return bits ? r >> (32 - bits) : 0;
+}
+
+static void report(const char *name, int ok, const char *format, double e) {
+  printf("%s %-20s worst ", ok ? "ok  " : "FAIL", name);
+  printf(format, e);
+  printf("\n");
+  if ( ! ok)
+    failed = 1;
+}
+
+/// exact_distance() and exact_distance_3(), and the approximations
+static void check_distance(void) {
+  double err, rel, worst_exact = 0., worst_rel = 0., worst_approx = 0.,
+         worst_exact_3 = 0., worst_rel_3 = 0., worst_approx_3 = 0.;
+  uint32_t dx, dy, dz, max;
+  long i;
+
+  for (i = 0; i < count; i++) {
+    // up to about 16 m in micrometers
+    dx = random_bits(24);
+    dy = random_bits(24);
+    dz = random_bits(24);
+
+    double ref = sqrt((double)dx * dx + (double)dy * dy);
+    double ref_3 = sqrt((double)dx * dx + (double)dy * dy + (double)dz * dz);
+
+    max = (dx > dy) ? dx : dy;
+    err = fabs(exact_distance(dx, dy) - ref);
+    rel = ref ? err / ref : 0.;
+    // rounded below 0x8000, scaled above
+    if (max <= 0x7FFF) {
+      if (err > worst_exact)
+        worst_exact = err;
+    }
+    else if (rel > worst_rel)
+      worst_rel = rel;
+    // the approximations overflow from about 1 m on, below 1 mm rounding to
+    // whole micrometers dominates
+    rel = ref ? fabs(approx_distance(dx, dy) - ref) / ref : 0.;
+    if (max < 0x100000 && ref >= 1000. && rel > worst_approx)
+      worst_approx = rel;
+
+    if (dz > max)
+      max = dz;
+    err = fabs(exact_distance_3(dx, dy, dz) - ref_3);
+    rel = ref_3 ? err / ref_3 : 0.;
+    if (max <= 0x7FFF) {
+      if (err > worst_exact_3)
+        worst_exact_3 = err;
+    }
+    else if (rel > worst_rel_3)
+      worst_rel_3 = rel;
+    rel = ref_3 ? fabs(approx_distance_3(dx, dy, dz) - ref_3) / ref_3 : 0.;
+    if (max < 0x100000 && ref_3 >= 1000. && rel > worst_approx_3)
+      worst_approx_3 = rel;
+  }
+
+  report("exact_distance", worst_exact <= 0.5, "%.3f below 32.767 mm",
+         worst_exact);
+  report("exact_distance", worst_rel < 0.00007, "%.5f%% above",
+         worst_rel * 100.);
+  report("exact_distance_3", worst_exact_3 <= 0.5, "%.3f below 32.767 mm",
+         worst_exact_3);
+  report("exact_distance_3", worst_rel_3 < 0.00007, "%.5f%% above",
+         worst_rel_3 * 100.);
+  report("approx_distance", worst_approx < 0.04, "%.2f%% 1 mm to 1 m",
+         worst_approx * 100.);
+  report("approx_distance_3", worst_approx_3 < 0.17, "%.2f%% 1 mm to 1 m",
+         worst_approx_3 * 100.);
+}
+
+/// int_sqrt(), truncated
+static void check_int_sqrt(void) {
+  uint32_t a, r;
+  long i, bad = 0;
+
+  for (i = 0; i < count; i++) {
+    a = random_bits(32);
+    r = int_sqrt(a);
+    if ((uint64_t)r * r > a || (uint64_t)(r + 1) * (r + 1) <= a)
+      bad++;
+  }
+  report("int_sqrt", bad == 0, "%.0f wrong", (double)bad);
+}
+
+/// reciprocal() and div_by_reciprocal(), exact
+static void check_reciprocal(void) {
+  uint32_t a, d, r, e;
+  long i, bad = 0, bad_div = 0;
+
+  for (i = 0; i < count; i++) {
+    d = random_bits(32);
+    r = reciprocal(d);
+    e = (d < 2) ? 0xFFFFFFFF : (uint32_t)((1ULL << 32) / d);
+    if (r != e)
+      bad++;
+
+    if (d == 0)
+      continue;
+    a = random_bits(32);
+    if (div_by_reciprocal(a, d, r) != a / d)
+      bad_div++;
+    if (div_by_reciprocal(a, d, RECIPROCAL(d)) != a / d)
+      bad_div++;
+  }
+  report("reciprocal", bad == 0, "%.0f wrong", (double)bad);
+  report("div_by_reciprocal", bad_div == 0, "%.0f wrong", (double)bad_div);
+}
+
+/*! reciprocal_update(), the way the acceleration ramp uses it
+
+  n counts up by 4 from 64 on, each time the reciprocal is updated from the
+  one of n - 4. Each update is off by less than \f$(4 / (n - 4))^2\f$ relative
+  to the exact reciprocal, plus one for truncation.
+*/
+static void check_reciprocal_update(void) {
+  uint32_t n, r;
+  double exact, bound, worst = 0.;
+
+  r = reciprocal(60);
+  for (n = 64; n < 64 + 4 * (uint32_t)count; n += 4) {
+    r = reciprocal_update(r, n);
+    exact = 4294967296. / n;
+    bound = exact * 16. / (n - 4) / (n - 4) + 1.;
+    if (fabs(r - exact) / bound > worst)
+      worst = fabs(r - exact) / bound;
+  }
+  report("reciprocal_update", worst <= 1., "%.3f of the bound", worst);
+}
+
+/// mul_wide(), here the C fallback, and what's built on it, against 64 bits
+static void check_mul_wide(void) {
+  uint32_t a, b, c, hi, lo;
+  uint64_t p;
+  uint8_t shift;
+  long i, bad = 0, bad_shift = 0, bad_div = 0;
+
+  for (i = 0; i < count; i++) {
+    a = random_bits(32);
+    b = random_bits(32);
+    p = (uint64_t)a * b;
+
+    hi = mul_wide(a, b, &lo);
+    if (hi != (uint32_t)(p >> 32) || lo != (uint32_t)p ||
+        mul_hi(a, b) != hi)
+      bad++;
+
+    // rounded, where the result fits
+    shift = 1 + rand() % 32;
+    if (((p + (1ULL << (shift - 1))) >> shift) <= 0xFFFFFFFF &&
+        mul_shift(a, b, shift) != (p + (1ULL << (shift - 1))) >> shift)
+      bad_shift++;
+
+    // hi has to be below the divisor
+    c = random_bits(32);
+    if (c > hi && div_wide(hi, lo, c) != p / c)
+      bad_div++;
+  }
+  report("mul_wide", bad == 0, "%.0f wrong", (double)bad);
+  report("mul_shift", bad_shift == 0, "%.0f wrong", (double)bad_shift);
+  report("div_wide", bad_div == 0, "%.0f wrong", (double)bad_div);
+}
+
+/// muldiv(), rounded with halves down, where the result fits
+static void check_muldiv(void) {
+  int32_t m, r;
+  uint32_t b, c;
+  uint64_t q;
+  long i, bad = 0, tried = 0;
+
+  for (i = 0; i < count; i++) {
+    m = random_bits(31);
+    if (rand() & 1)
+      m = -m;
+    b = random_bits(32);
+    c = random_bits(32);
+    if (c == 0)
+      continue;
+
+    q = ((uint64_t)(m < 0 ? -m : m) * b + (c - 1) / 2) / c;
+    if (q > 0x7FFFFFFF)
+      continue;
+    r = muldiv(m, b, c);
+    if (r != (m < 0 ? -(int32_t)q : (int32_t)q))
+      bad++;
+    tried++;
+  }
+  report("muldiv", bad == 0 && tried > count / 4, "%.0f wrong",
+         (double)bad);
+}
+
+/// mul_fixed() the way um_to_steps_*() use it, against a true muldiv
+static void check_mul_fixed(void) {
+  static const uint32_t steps_per_m[] = {
+    80000, 1280000, 4000000, 320000, 78740, 1000000, 3333333, 99999999
+  };
+  uint32_t s, a;
+  uint64_t q;
+  int32_t m, r;
+  long i, bad = 0;
+  uint8_t k;
+
+  for (k = 0; k < sizeof(steps_per_m) / sizeof(steps_per_m[0]); k++) {
+    s = steps_per_m[k];
+    for (i = 0; i < count / 8; i++) {
+      m = random_bits(28);
+      if (rand() & 1)
+        m = -m;
+      a = (m < 0) ? -m : m;
+
+      // ties down
+      q = ((uint64_t)a * s + 499999) / 1000000;
+      r = mul_fixed(m, s / 1000000, FRACTION_HI(s, 1000000UL),
+                    FRACTION_LO(s, 1000000UL));
+      if (r != (m < 0 ? -(int32_t)q : (int32_t)q))
+        bad++;
+    }
+  }
+  report("mul_fixed", bad == 0, "%.0f wrong", (double)bad);
+}
+
+/// fixed_sqrt(), truncated to 1/256
+static void check_fixed_sqrt(void) {
+  uint32_t a, r;
+  long i, bad = 0;
+
+  for (i = 0; i < count; i++) {
+    a = random_bits(32);
+    r = fixed_sqrt(a);
+    if ((uint64_t)r * r > (uint64_t)a << 16 ||
+        (uint64_t)(r + 1) * (r + 1) <= (uint64_t)a << 16)
+      bad++;
+  }
+  report("fixed_sqrt", bad == 0, "%.0f wrong", (double)bad);
+}
+
+/*! square_sum() and sqrt_wide(), truncated
+
+  The components go all the way to INT32_MIN, the largest square sum there
+  is, \f$2^{63}\f$.
+*/
+static void check_sqrt_wide(void) {
+  static const int32_t edge[] = {
+    0, 1, -1, 46341, 65535, 65536, INT32_MAX, INT32_MIN, INT32_MIN + 1
+  };
+  int32_t a, b;
+  uint32_t hi, lo, r;
+  uint64_t v;
+  long i, bad_sum = 0, bad = 0;
+  uint8_t n = sizeof(edge) / sizeof(edge[0]);
+
+  for (i = 0; i < count + n * n; i++) {
+    if (i < n * n) {
+      a = edge[i / n];
+      b = edge[i % n];
+    }
+    else {
+      a = random_bits(32);
+      b = random_bits(32);
+    }
+
+    v = (uint64_t)((int64_t)a * a) + (uint64_t)((int64_t)b * b);
+    hi = square_sum(a, b, &lo);
+    if (hi != (uint32_t)(v >> 32) || lo != (uint32_t)v)
+      bad_sum++;
+
+    r = sqrt_wide(hi, lo);
+    if ((unsigned __int128)r * r > v ||
+        (unsigned __int128)(r + 1ULL) * (r + 1ULL) <= v)
+      bad++;
+  }
+  report("square_sum", bad_sum == 0, "%.0f wrong", (double)bad_sum);
+  report("sqrt_wide", bad == 0, "%.0f wrong", (double)bad);
+}
+
+/// clz() and msbloc(), for every position of the top bit
+static void check_clz(void) {
+  uint32_t v;
+  long i, bad = 0;
+  uint8_t n;
+
+  for (i = 0; i < count; i++) {
+    v = random_bits(32);
+    for (n = 0; n < 32 && ! (v & (0x80000000 >> n)); n++);
+    if (clz(v) != n || msbloc(v) != (v ? 31 - n : 0))
+      bad++;
+  }
+  report("clz, msbloc", bad == 0, "%.0f wrong", (double)bad);
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1)
+    count = atol(argv[1]);
+  srand(1);
+
+  check_distance();
+  check_int_sqrt();
+  check_reciprocal();
+  check_reciprocal_update();
+  check_mul_wide();
+  check_muldiv();
+  check_mul_fixed();
+  check_fixed_sqrt();
+  check_sqrt_wide();
+  check_clz();
+
+  return failed;
+}
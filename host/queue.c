@@ -0,0 +1,103 @@
+/** \file
+  \brief Host stand-in for the movebuffer, see dda_queue.c
+
+  Moves are created with the firmware's own dda_create(), so startpoint and
+  the rest of the planner's state go along exactly as on the machine, but
+  they're not stepped. With \ref host_trace set, each move is printed
+  instead, one line each, in millimeters:
+
+  <tt>G1 X10.000 Y0.000 Z-1.000 F600</tt> for a straight move,
+  <tt>G2 X10.000 Y0.000 Z-1.000 F600 I0.000 J-5.000</tt> for an arc stepped
+  natively, with G3 for counterclockwise, and <tt>G4 P500</tt> for a dwell.
+  F is what the move runs at, in mm/min, after G93 too.
+
+  So the queue is never full and always empty, nothing waits for it.
+*/
+
+#include "dda_queue.h"
+
+#include <stdio.h>
+
+#include "host.h"
+
+uint8_t mb_head = 0;
+uint8_t mb_tail = 0;
+DDA movebuffer[MOVEBUFFER_SIZE];
+
+/// print micrometers as millimeters
+static void print_mm(char axis, int32_t um) {
+  uint32_t u = (um < 0) ? -(uint32_t)um : (uint32_t)um;
+
+  printf(" %c%s%lu.%03lu", axis, (um < 0) ? "-" : "",
+         (unsigned long)(u / 1000), (unsigned long)(u % 1000));
+}
+
+static void trace_move(const char *g, TARGET *t) {
+  printf("%s", g);
+  print_mm('X', t->X);
+  print_mm('Y', t->Y);
+  print_mm('Z', t->Z);
+  printf(" F%lu", (unsigned long)startpoint.F);
+}
+
+uint8_t queue_full() {
+  return 0;
+}
+
+uint8_t queue_empty() {
+  return 255;
+}
+
+void queue_step() {
+}
+
+void enqueue(TARGET *t) {
+  enqueue_home(t, 0, 0);
+}
+
+void enqueue_home(TARGET *t, uint8_t endstop_check, uint8_t endstop_stop_cond) {
+  dda_create(&movebuffer[0], t);
+  movebuffer[0].endstop_check = endstop_check;
+  movebuffer[0].endstop_stop_cond = endstop_stop_cond;
+
+  if (host_trace) {
+    trace_move("G1", t);
+    printf("\n");
+  }
+}
+
+#ifdef ARC_NATIVE
+void enqueue_arc(TARGET *t, int32_t center_x, int32_t center_y,
+                 uint32_t length, uint8_t ccw, uint8_t long_arc) {
+  int32_t start_x = startpoint.X, start_y = startpoint.Y;
+
+  dda_create_arc(&movebuffer[0], t, center_x, center_y, length, ccw,
+                 long_arc);
+
+  if (host_trace) {
+    trace_move(ccw ? "G3" : "G2", t);
+    print_mm('I', center_x - start_x);
+    print_mm('J', center_y - start_y);
+    printf("\n");
+  }
+}
+#endif
+
+void enqueue_dwell(uint32_t ms) {
+  dda_create_dwell(&movebuffer[0], ms);
+
+  if (host_trace)
+    printf("G4 P%lu\n", (unsigned long)ms);
+}
+
+void next_move() {
+}
+
+void print_queue() {
+}
+
+void queue_flush() {
+}
+
+void queue_wait() {
+}
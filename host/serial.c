@@ -0,0 +1,48 @@
+/** \file
+  \brief Host stand-in for the serial port, see host.c
+
+  Nothing comes in this way, the host programs feed the parser directly.
+  Whatever the firmware sends goes to host_reply().
+*/
+
+#include "serial.h"
+
+#include "host.h"
+
+uint8_t serial_written = 0;
+
+void serial_init() {
+}
+
+uint8_t serial_rxchars() {
+  return 0;
+}
+
+uint8_t serial_popchar() {
+  return 0;
+}
+
+void serial_writechar(uint8_t data) {
+  serial_written = 1;
+  host_reply(data);
+}
+
+void serial_writeblock(void *data, int datalen) {
+  int i;
+
+  for (i = 0; i < datalen; i++)
+    serial_writechar(((uint8_t *)data)[i]);
+}
+
+void serial_writestr(uint8_t *data) {
+  while (*data)
+    serial_writechar(*data++);
+}
+
+void serial_writeblock_P(PGM_P data, int datalen) {
+  serial_writeblock((void *)data, datalen);
+}
+
+void serial_writestr_P(PGM_P data) {
+  serial_writestr((uint8_t *)data);
+}
@@ -0,0 +1,52 @@
+/** \file
+  \brief Run G-code through the firmware on a PC
+
+  \code
+  sim [-v] [file ...]
+  \endcode
+
+  Reads the files, or standard input, as if sent over the serial line and
+  prints every move queued, see queue.c, along with replies other than a
+  plain "ok". With -v, all replies are printed.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "host.h"
+
+static void run(FILE *f) {
+  int c;
+
+  while ((c = getc(f)) != EOF)
+    host_char(c);
+  host_drain();
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  int i = 1;
+
+  host_trace = 1;
+  host_echo = 1;
+  if (i < argc && strcmp(argv[i], "-v") == 0) {
+    host_echo = 2;
+    i++;
+  }
+
+  host_init();
+
+  if (i == argc)
+    run(stdin);
+  for (; i < argc; i++) {
+    f = fopen(argv[i], "rb");
+    if (f == NULL) {
+      perror(argv[i]);
+      return 1;
+    }
+    run(f);
+    fclose(f);
+  }
+
+  return 0;
+}
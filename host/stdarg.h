@@ -0,0 +1,16 @@
+#ifndef _HOST_STDARG_H
+#define _HOST_STDARG_H
+
+/** \file
+  \brief va_arg() for types narrower than int
+
+  Fine on the AVR, where int is 16 bits, but undefined on a PC, where GCC
+  makes the program abort if it gets there. Read them promoted instead.
+*/
+
+#include_next <stdarg.h>
+
+#undef va_arg
+#define va_arg(ap, type) ((type)__builtin_va_arg(ap, __typeof__((type)0 + 0)))
+
+#endif /* _HOST_STDARG_H */
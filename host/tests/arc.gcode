@@ -0,0 +1,13 @@
+(arcs - G2/G3 with I J, R forms, a full circle, G18 and G19 helices)
+G21 G90
+G0 X10 Y10 Z0
+G2 X30 Y10 I10 J0 F600
+G3 X50 Y10 R10
+G2 X30 Y10 R-10
+G3 X30 Y10 I0 J-10
+G18
+G2 X50 Z20 I10 K10 Y20
+G19
+G3 Y0 Z20 J-10 K0 X50
+G17
+G3 X40 Y10 R10
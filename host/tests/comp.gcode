@@ -0,0 +1,23 @@
+(cutter compensation - inside and outside corners, G41 and G42, planes)
+G21 G90
+G10 L1 P1 R2
+G0 X10 Y10 Z1
+G41 D1
+G1 X30 Y10 F600
+G1 X30 Y30
+G1 X20 Y20
+G18
+G1 X10 Y30
+G1 X10 Y10
+G40
+G0 X40 Y40
+G42 D1
+G1 X60 Y40
+G1 X60 Y60
+G1 X40 Y60
+G1 X40 Y40
+G40
+G0 X0 Y0
+G18
+G17
+M114
@@ -0,0 +1,21 @@
+(canned cycles - G98/G99 retract, the Z after a cycle, relative mode)
+G21 G90
+G0 X0 Y0 Z10
+G81 X10 Y10 R2 Z-5 F300
+X20
+G80
+G0 X0 Y0
+G99 G82 X5 Y5 R1 Z-2 P0.5
+G80
+G0 X0 Y0
+G98 G83 X10 Y0 R3 Z-4 Q1.5
+G80
+G0 Z20
+G73 X0 Y10 R2 Z-3 Q1 L2
+G80
+G91
+G81 X5 Y0 R-18 Z-5 L3
+G80
+G90
+G0 X0 Y0 Z20
+M114
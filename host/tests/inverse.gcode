@@ -0,0 +1,12 @@
+(inverse time feed - G93 with the move on one line, F before it, no F)
+G21 G90
+G1 X0 Y0 Z0 F600
+G93 G1 X10 F0.5
+G1 X20 F6
+G1 X30
+G2 X40 Y0 I10 F1
+G94
+G1 X0 Y0
+F2 G93 G1 X10
+G1 X20 F60 G94
+G1 X30
@@ -0,0 +1,11 @@
+(work offsets - G10 L2, G54 to G59, G59.1 isn't there)
+G21 G90
+G10 L2 P2 X100 Y50
+G0 X0 Y0 Z10
+G55
+G0 X0 Y0
+G59.1
+G0 X10 Y10
+G54
+G0 X0 Y0
+M114
@@ -0,0 +1,26 @@
+(numbers - decimals, signs, inches and out of range values)
+G21 G90
+G1 X1.5 Y2.25 Z0.001 F600
+G1 X.5 Y+0.75 Z1
+g1 x2 y3 z4 (lower case)
+G1 X99999999999 Y123456789.123456789
+G1 X0 Y0 Z0
+G20
+G1 X1 Y0.5 Z.01
+G1 X10 F10
+G21
+G1 X0 Y0 Z0 F600
+G91
+G1 X1 Y1
+G1 X1 Y1 Z1
+G90
+G4 P0.25
+M114
+G1 X10 (a comment) Y10 Z1
+G999
+M65535
+N5 G1 X1
+M110 N5
+N6 G1 X2*100
+N7 G1 X3*0
+N7 G1 X3
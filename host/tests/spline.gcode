@@ -0,0 +1,11 @@
+(splines - G5, G5 continuing smoothly, G5.1, and a G1 breaking a chain)
+G21 G90
+G0 X0 Y0 Z0
+G5 X20 Y0 I0 J10 P0 Q10
+
+G5 X40 Y0 P0 Q-10
+G5.1 X60 Y0 I10 J-10
+G5 X80 Y0 P0 Q10
+G5 X80 Y20 I10 J0 P10 Q0
+G1 X80 Y30
+G5 X80 Y40 P10 Q0
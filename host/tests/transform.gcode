@@ -0,0 +1,24 @@
+(rotation, scaling and mirroring - with arcs, and G41 mirrored)
+G21 G90
+G0 X0 Y0 Z0
+G68 X50 Y50 R90
+G0 X60 Y50
+G1 X60 Y60 F600
+G69
+G51 X50 Y50 P2
+G1 X60 Y50
+G2 X50 Y40 I-10 J0
+G50
+M21
+G1 X-60 Y10
+G3 X-70 Y20 I-10 J0
+M23
+G10 L1 P1 R2
+M22
+G0 X10 Y-10
+G41 D1
+G1 X30 Y-10
+G1 X30 Y-30
+G40
+G0 X10 Y-10
+M23
@@ -0,0 +1,7 @@
+#ifndef _HOST_UTIL_ATOMIC_H
+#define _HOST_UTIL_ATOMIC_H
+
+// nothing interrupts on the host, see avr/interrupt.h
+#include <avr/interrupt.h>
+
+#endif /* _HOST_UTIL_ATOMIC_H */
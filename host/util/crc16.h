@@ -0,0 +1,12 @@
+#ifndef _HOST_UTIL_CRC16_H
+#define _HOST_UTIL_CRC16_H
+
+/** \file
+  \brief Host stand-in for avr-libc's CRC routines, see hw.c
+*/
+
+#include <stdint.h>
+
+uint16_t _crc16_update(uint16_t crc, uint8_t a);
+
+#endif /* _HOST_UTIL_CRC16_H */
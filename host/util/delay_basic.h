@@ -0,0 +1,12 @@
+#ifndef _HOST_UTIL_DELAY_BASIC_H
+#define _HOST_UTIL_DELAY_BASIC_H
+
+/** \file
+  \brief Host stand-in for avr-libc's busy loops, they return right away
+*/
+
+#include <stdint.h>
+
+void _delay_loop_2(uint16_t count);
+
+#endif /* _HOST_UTIL_DELAY_BASIC_H */
@@ -34,6 +34,13 @@
 #include "dda_queue.h"
 #include "dda.h"
 #include "gcode_parse.h"
+#include "gcode_queue.h"
+#include "gcode_binary.h"
+#include "arc.h"
+#include "spline.h"
+#include "cycle.h"
+#include "tool.h"
+#include "coord.h"
 #include "timer.h"
 #include "sermsg.h"
 #include "watchdog.h"
@@ -147,6 +154,14 @@ void init(void) {
   // set up dda
   dda_init();
 
+#ifdef TOOL_TABLE
+  // read the tool table
+  tool_init();
+#endif
+
+  // read the work offset of G54
+  coord_init();
+
   // enable interrupts
   sei();
 
@@ -160,7 +175,7 @@ void init(void) {
 
 /// this is where it all starts, and ends
 ///
-/// just run init(), then run an endless loop where we pass characters from the serial RX buffer to gcode_parse_char() and check the clocks
+/// just run init(), then run an endless loop where we pass characters from the serial RX buffer to gcode_parse_char(), pass parsed commands to the movebuffer and check the clocks
 int main (void)
 {
   init();
@@ -168,12 +183,39 @@ int main (void)
   // main loop
   for (;;)
   {
-    // if queue is full, no point in reading chars- host will just have to wait
-    if ((serial_rxchars() != 0) && (queue_full() == 0)) {
+    // if command queue is full, no point in reading chars- host will just have to wait
+    if ((serial_rxchars() != 0) && (gcode_queue_full() == 0)) {
       uint8_t c = serial_popchar();
+#ifdef GCODE_BINARY
+      if (binary_mode)
+        gcode_binary_char(c);
+      else
+#endif
       gcode_parse_char(c);
     }
 
+    // if movebuffer is full, no point in processing commands- they wait parsed already
+    if (queue_full() == 0) {
+#ifdef ARC_TOLERANCE
+      // the rest of an arc goes before the commands after it
+      if (arc_segments)
+        arc_segment();
+      else
+#endif
+#ifdef SPLINE_TOLERANCE
+      if (spline_active)
+        spline_segment();
+      else
+#endif
+#ifdef CANNED_CYCLES
+      if (cycle_active)
+        cycle_segment();
+      else
+#endif
+      if (gcode_queue_empty() == 0)
+        gcode_dequeue();
+    }
+
     ifclock(clock_flag_10ms) {
       clock_10ms();
     }                
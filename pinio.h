@@ -7,11 +7,31 @@
 
 #include "config.h"
 
+#ifdef STEP_OC1A_AXIS
+  // for step_oc1a
+  #include "timer.h"
+
+  // Timer 1 can raise OC1A only, which is a different pin on each chip.
+  // IS_OC1A(DIO9) becomes OC1A_IS_DIO9, set next to OC1A in arduino_*.h,
+  // and 0 in #if for any other pin.
+  #define _IS_OC1A(pin) OC1A_IS_ ## pin
+  #define IS_OC1A(pin) _IS_OC1A(pin)
+  #if (STEP_OC1A_AXIS == 'X' && ! IS_OC1A(X_STEP_PIN)) || \
+      (STEP_OC1A_AXIS == 'Y' && ! IS_OC1A(Y_STEP_PIN)) || \
+      (STEP_OC1A_AXIS == 'Z' && ! IS_OC1A(Z_STEP_PIN))
+    #error The step pin of STEP_OC1A_AXIS must be OC1A, see arduino_*.h
+  #endif
+#endif
+
 /*
 X Stepper
 */
 #define  _x_step(st)            WRITE(X_STEP_PIN, st)
-#define  x_step()              _x_step(1);
+#if defined STEP_OC1A_AXIS && STEP_OC1A_AXIS == 'X'
+  #define  x_step()            do { if ( ! step_oc1a) _x_step(1); } while (0);
+#else
+  #define  x_step()            _x_step(1);
+#endif
 #ifndef  X_INVERT_DIR
   #define  x_direction(dir)    WRITE(X_DIR_PIN, dir)
 #else
@@ -31,7 +51,11 @@ X Stepper
 Y Stepper
 */
 #define  _y_step(st)            WRITE(Y_STEP_PIN, st)
-#define  y_step()              _y_step(1);
+#if defined STEP_OC1A_AXIS && STEP_OC1A_AXIS == 'Y'
+  #define  y_step()            do { if ( ! step_oc1a) _y_step(1); } while (0);
+#else
+  #define  y_step()            _y_step(1);
+#endif
 #ifndef  Y_INVERT_DIR
   #define  y_direction(dir)    WRITE(Y_DIR_PIN, dir)
 #else
@@ -52,7 +76,11 @@ Z Stepper
 */
 #if defined Z_STEP_PIN && defined Z_DIR_PIN
   #define  _z_step(st)          WRITE(Z_STEP_PIN, st)
-  #define  z_step()            _z_step(1);
+  #if defined STEP_OC1A_AXIS && STEP_OC1A_AXIS == 'Z'
+    #define  z_step()          do { if ( ! step_oc1a) _z_step(1); } while (0);
+  #else
+    #define  z_step()          _z_step(1);
+  #endif
   #ifndef  Z_INVERT_DIR
     #define  z_direction(dir)  WRITE(Z_DIR_PIN, dir)
   #else
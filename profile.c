@@ -0,0 +1,417 @@
+#include "profile.h"
+
+/** \file
+  \brief Step interrupt profiling
+
+  Counts how late the step interrupt fires compared to its compare match and
+  how long it runs, separately for each path through it. Counts go into
+  histograms with power-of-two buckets: bucket b counts values from
+  \f$2^{b-1}\f$ to \f$2^b - 1\f$ CPU clocks, bucket 0 counts zeros. The last
+  bucket also counts anything longer.
+
+  dda_create() is timed along with it, from the main loop, so interrupts
+  taken meanwhile count in.
+
+  With PROFILE_MATHS, the maths functions can be timed as well, see
+  profile_maths().
+*/
+
+#include <string.h>
+#include <avr/interrupt.h>
+
+#include "memory_barrier.h"
+#include "dda_maths.h"
+#include "serial.h"
+#include "sersendf.h"
+#include "timer.h"
+
+#ifdef PROFILE_STEP_ISR
+
+/// number of buckets, values from 65536 on go into the last one
+#define PROFILE_BUCKETS 17
+
+/// path taken by the current step interrupt
+volatile uint8_t profile_path;
+
+/// histograms of step interrupt lateness
+uint16_t profile_late[PROFILE_PATHS][PROFILE_BUCKETS];
+/// histograms of step interrupt duration
+uint16_t profile_duration[PROFILE_PATHS][PROFILE_BUCKETS];
+/// histogram of dda_create() duration
+uint16_t profile_create[PROFILE_BUCKETS];
+
+/// histogram bucket for value v
+static uint8_t bucket(uint32_t v) {
+  if (v > 0xFFFF)
+    return PROFILE_BUCKETS - 1;
+  return v ? msbloc(v) + 1 : 0;
+}
+
+/*! count one step interrupt
+  \param late CPU clocks from the compare match to entering the interrupt
+  \param duration CPU clocks spent in the interrupt
+
+  Called from the step interrupt, at its very end. The path is taken from
+  profile_path, which the interrupt clears on entry.
+*/
+void profile_record(uint32_t late, uint32_t duration) {
+  uint16_t *h;
+
+  h = &profile_late[profile_path][bucket(late)];
+  // saturate, so long runs don't wrap around
+  if (*h != 0xFFFF)
+    (*h)++;
+
+  h = &profile_duration[profile_path][bucket(duration)];
+  if (*h != 0xFFFF)
+    (*h)++;
+}
+
+/*! count one dda_create()
+  \param duration CPU clocks spent in it
+*/
+void profile_record_create(uint32_t duration) {
+  uint16_t *h = &profile_create[bucket(duration)];
+
+  if (*h != 0xFFFF)
+    (*h)++;
+}
+
+/// send one histogram as space separated bucket:count pairs, empty buckets omitted
+static void profile_send(uint16_t *h) {
+  uint8_t b;
+
+  for (b = 0; b < PROFILE_BUCKETS; b++)
+    if (h[b])
+      sersendf_P(PSTR(" %u:%u"), b, h[b]);
+}
+
+/// send all histograms to the host, on a single line
+void profile_report() {
+  uint16_t late[PROFILE_BUCKETS], duration[PROFILE_BUCKETS];
+  uint8_t p;
+
+  for (p = 0; p < PROFILE_PATHS; p++) {
+    // take a consistent copy, the step interrupt keeps counting meanwhile
+    uint8_t sreg_save = SREG;
+    cli();
+    CLI_SEI_BUG_MEMORY_BARRIER();
+    memcpy(late, profile_late[p], sizeof(late));
+    memcpy(duration, profile_duration[p], sizeof(duration));
+    MEMORY_BARRIER();
+    SREG = sreg_save;
+
+    if (p == PROFILE_STEP)
+      serial_writestr_P(PSTR("{step"));
+    else if (p == PROFILE_RAMP)
+      serial_writestr_P(PSTR(" {ramp"));
+    else
+      serial_writestr_P(PSTR(" {start"));
+    serial_writestr_P(PSTR(" late"));
+    profile_send(late);
+    serial_writestr_P(PSTR(" time"));
+    profile_send(duration);
+    serial_writechar('}');
+  }
+
+  // only counted from the main loop, so no copy needed
+  serial_writestr_P(PSTR(" {create time"));
+  profile_send(profile_create);
+  serial_writechar('}');
+}
+
+/// clear all histograms
+void profile_clear() {
+  uint8_t sreg_save = SREG;
+  cli();
+  CLI_SEI_BUG_MEMORY_BARRIER();
+  memset(profile_late, 0, sizeof(profile_late));
+  memset(profile_duration, 0, sizeof(profile_duration));
+  memset(profile_create, 0, sizeof(profile_create));
+  MEMORY_BARRIER();
+  SREG = sreg_save;
+}
+
+#endif /* PROFILE_STEP_ISR */
+
+#ifdef PROFILE_MATHS
+
+/// calls timed for each function
+#define PROFILE_CALLS 64
+
+/// a function to time, called through a wrapper taking three arguments
+typedef uint32_t (*profile_fn)(uint32_t, uint32_t, uint32_t);
+
+/// results go here, so the calls can't be optimised away
+static volatile uint32_t profile_sink;
+
+/// state of the pseudo random arguments, restarted for each function
+static uint32_t profile_seed;
+
+/*! pseudo random argument
+  \param bits width of the argument, 0 to 32
+  \return a number of exactly that many bits, the top one set
+
+  The sequence restarts for each function, so all of them and all builds
+  get the same arguments.
+*/
+static uint32_t profile_arg(uint8_t bits) {
+  if (bits == 0)
+    return 0;
+  profile_seed = profile_seed * 1664525 + 1013904223;
+  return (profile_seed >> (32 - bits)) | (1UL << (bits - 1));
+}
+
+/// CPU clocks of a single call, interrupts locked
+static uint16_t profile_call(profile_fn, uint32_t, uint32_t, uint32_t)
+  __attribute__ ((noinline, noclone));
+static uint16_t profile_call(profile_fn fn, uint32_t a, uint32_t b,
+                             uint32_t c) {
+  uint16_t start, end;
+
+  uint8_t sreg_save = SREG;
+  cli();
+  CLI_SEI_BUG_MEMORY_BARRIER();
+
+  start = TCNT1;
+  profile_sink = fn(a, b, c);
+  end = TCNT1;
+
+  MEMORY_BARRIER();
+  SREG = sreg_save;
+
+  return end - start;
+}
+
+static uint32_t profile_none(uint32_t a, uint32_t b, uint32_t c) {
+  return a;
+}
+
+/// clocks of calling profile_none(), taken off all others
+static uint16_t profile_overhead;
+
+/// nothing sent yet, so no space in front
+static uint8_t profile_first;
+
+/*! time a function and send minimum, average and maximum clocks per call
+  \param name of the function, in flash
+  \param fn wrapper calling it
+  \param bits_a width of the first argument, see profile_arg()
+  \param bits_b width of the second argument
+  \param bits_c width of the third argument
+*/
+static void profile_time(PGM_P name, profile_fn fn, uint8_t bits_a,
+                         uint8_t bits_b, uint8_t bits_c) {
+  uint32_t a, b, c, sum = 0;
+  uint16_t t, min = 0xFFFF, max = 0;
+  uint8_t i;
+
+  profile_seed = 1;
+  for (i = 0; i < PROFILE_CALLS; i++) {
+    a = profile_arg(bits_a);
+    b = profile_arg(bits_b);
+    c = profile_arg(bits_c);
+    t = profile_call(fn, a, b, c);
+    t = (t > profile_overhead) ? t - profile_overhead : 0;
+    sum += t;
+    if (t < min)
+      min = t;
+    if (t > max)
+      max = t;
+  }
+
+  if ( ! profile_first)
+    serial_writechar(' ');
+  profile_first = 0;
+  serial_writechar('{');
+  serial_writestr_P(name);
+  sersendf_P(PSTR(" %u %lu %u}"), min, sum / PROFILE_CALLS, max);
+}
+
+/*
+  wrappers for the functions timed
+*/
+static uint32_t profile_approx_distance(uint32_t a, uint32_t b, uint32_t c) {
+  return approx_distance(a, b);
+}
+
+static uint32_t profile_approx_distance_3(uint32_t a, uint32_t b,
+                                          uint32_t c) {
+  return approx_distance_3(a, b, c);
+}
+
+static uint32_t profile_exact_distance(uint32_t a, uint32_t b, uint32_t c) {
+  return exact_distance(a, b);
+}
+
+static uint32_t profile_exact_distance_3(uint32_t a, uint32_t b,
+                                         uint32_t c) {
+  return exact_distance_3(a, b, c);
+}
+
+static uint32_t profile_int_sqrt(uint32_t a, uint32_t b, uint32_t c) {
+  return int_sqrt(a);
+}
+
+static uint32_t profile_reciprocal(uint32_t a, uint32_t b, uint32_t c) {
+  return reciprocal(a);
+}
+
+static uint32_t profile_reciprocal_update(uint32_t a, uint32_t b,
+                                          uint32_t c) {
+  return reciprocal_update(a, b);
+}
+
+static uint32_t profile_div_by_reciprocal(uint32_t a, uint32_t b,
+                                          uint32_t c) {
+  return div_by_reciprocal(a, b, c);
+}
+
+/// plain division, what reciprocals replace
+static uint32_t profile_divide(uint32_t a, uint32_t b, uint32_t c) {
+  return a / b;
+}
+
+static uint32_t profile_mul_wide(uint32_t a, uint32_t b, uint32_t c) {
+  uint32_t lo;
+
+  return mul_wide(a, b, &lo) ^ lo;
+}
+
+/// what gcc makes of a 64 bit product, mul_wide() replaces it
+static uint32_t profile_mul_64(uint32_t a, uint32_t b, uint32_t c) {
+  uint64_t p = (uint64_t)a * b;
+
+  return (uint32_t)(p >> 32) ^ (uint32_t)p;
+}
+
+static uint32_t profile_mul_shift(uint32_t a, uint32_t b, uint32_t c) {
+  return mul_shift(a, b, 24);
+}
+
+static uint32_t profile_div_wide(uint32_t a, uint32_t b, uint32_t c) {
+  return div_wide(a, b, c);
+}
+
+static uint32_t profile_muldiv(uint32_t a, uint32_t b, uint32_t c) {
+  return muldiv(a, b, c);
+}
+
+/*! the multiply-divide muldiv() replaced, for comparison
+
+  Adds multiplier / divisor and multiplier % divisor up bit by bit, see the
+  history of dda_maths.c.
+*/
+static uint32_t profile_muldiv_shift(uint32_t a, uint32_t b, uint32_t c) {
+  uint32_t qn = b / c, rn = b % c, quotient = 0, remainder = 0;
+
+  while (a) {
+    if (a & 1) {
+      quotient += qn;
+      remainder += rn;
+      if (remainder >= c) {
+        quotient++;
+        remainder -= c;
+      }
+    }
+    a >>= 1;
+    qn <<= 1;
+    rn <<= 1;
+    if (rn >= c) {
+      qn++;
+      rn -= c;
+    }
+  }
+  if (remainder > c / 2)
+    quotient++;
+
+  return quotient;
+}
+
+static uint32_t profile_um_to_steps_x(uint32_t a, uint32_t b, uint32_t c) {
+  return um_to_steps_x(a);
+}
+
+static uint32_t profile_fixed_sqrt(uint32_t a, uint32_t b, uint32_t c) {
+  return fixed_sqrt(a);
+}
+
+static uint32_t profile_sqrt_wide(uint32_t a, uint32_t b, uint32_t c) {
+  return sqrt_wide(a, b);
+}
+
+/// the argument shifted by b, so the top bit lands anywhere
+static uint32_t profile_clz(uint32_t a, uint32_t b, uint32_t c) {
+  return clz(a >> (b & 31));
+}
+
+static uint32_t profile_msbloc(uint32_t a, uint32_t b, uint32_t c) {
+  return msbloc(a >> (b & 31));
+}
+
+/// the loop msbloc() replaced, for comparison
+static uint32_t profile_msbloc_loop(uint32_t a, uint32_t b, uint32_t c) {
+  uint32_t v = a >> (b & 31), m;
+  uint8_t i;
+
+  for (i = 31, m = 0x80000000; i; i--) {
+    if (v & m)
+      return i;
+    m >>= 1;
+  }
+  return 0;
+}
+
+/*! time the maths functions
+
+  Each function gets PROFILE_CALLS calls with pseudo random arguments, each
+  timed with interrupts locked and timer 1 counting CPU clocks. Minimum,
+  average and maximum go to the host, without the cost of the call itself.
+  Moves have to be done, the step interrupt needs the timer.
+*/
+void profile_maths() {
+  uint8_t i;
+
+  timer_unscaled();
+  profile_first = 1;
+
+  profile_overhead = 0xFFFF;
+  for (i = 0; i < 8; i++) {
+    uint16_t t = profile_call(&profile_none, 0, 0, 0);
+
+    if (t < profile_overhead)
+      profile_overhead = t;
+  }
+
+  // distances of up to about a meter in micrometers
+  profile_time(PSTR("approx_distance"), &profile_approx_distance, 20, 20, 0);
+  profile_time(PSTR("approx_distance_3"), &profile_approx_distance_3,
+               20, 20, 20);
+  profile_time(PSTR("exact_distance"), &profile_exact_distance, 20, 20, 0);
+  profile_time(PSTR("exact_distance_3"), &profile_exact_distance_3,
+               20, 20, 20);
+  profile_time(PSTR("int_sqrt"), &profile_int_sqrt, 30, 0, 0);
+  // step counts and feedrates, step times in 24.8
+  profile_time(PSTR("reciprocal"), &profile_reciprocal, 20, 0, 0);
+  profile_time(PSTR("reciprocal_update"), &profile_reciprocal_update,
+               32, 20, 0);
+  profile_time(PSTR("div_by_reciprocal"), &profile_div_by_reciprocal,
+               32, 20, 32);
+  profile_time(PSTR("divide"), &profile_divide, 32, 20, 0);
+  profile_time(PSTR("mul_wide"), &profile_mul_wide, 32, 32, 0);
+  profile_time(PSTR("mul_64"), &profile_mul_64, 32, 32, 0);
+  profile_time(PSTR("mul_shift"), &profile_mul_shift, 32, 24, 0);
+  profile_time(PSTR("div_wide"), &profile_div_wide, 20, 32, 24);
+  // distance times steps per meter over micrometers per meter, roughly
+  profile_time(PSTR("muldiv"), &profile_muldiv, 20, 24, 20);
+  profile_time(PSTR("muldiv_shift"), &profile_muldiv_shift, 20, 24, 20);
+  profile_time(PSTR("um_to_steps_x"), &profile_um_to_steps_x, 20, 0, 0);
+  // the step time in dda_init(), squares of arc radii up to some meters
+  profile_time(PSTR("fixed_sqrt"), &profile_fixed_sqrt, 24, 0, 0);
+  profile_time(PSTR("sqrt_wide"), &profile_sqrt_wide, 16, 32, 0);
+  profile_time(PSTR("clz"), &profile_clz, 32, 6, 0);
+  profile_time(PSTR("msbloc"), &profile_msbloc, 32, 6, 0);
+  profile_time(PSTR("msbloc_loop"), &profile_msbloc_loop, 32, 6, 0);
+}
+
+#endif /* PROFILE_MATHS */
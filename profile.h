@@ -0,0 +1,47 @@
+#ifndef _PROFILE_H
+#define _PROFILE_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+#ifdef PROFILE_STEP_ISR
+
+/*
+  code paths through the step interrupt, in order of precedence
+*/
+#define PROFILE_STEP  0 ///< steps only
+#define PROFILE_RAMP  1 ///< steps and a new step time for acceleration
+#define PROFILE_START 2 ///< dda_start() of the next move
+#define PROFILE_PATHS 3
+
+extern volatile uint8_t profile_path;
+
+// note the path taken by the current step interrupt, most expensive one wins
+#define profile_mark(p) do { if (profile_path < (p)) profile_path = (p); } while (0)
+
+// count lateness and duration of one step interrupt, in CPU clocks
+void profile_record(uint32_t late, uint32_t duration);
+
+// count the duration of one dda_create(), in CPU clocks
+void profile_record_create(uint32_t duration);
+
+// send histograms to the host
+void profile_report(void);
+
+// clear histograms
+void profile_clear(void);
+
+#else /* PROFILE_STEP_ISR */
+
+#define profile_mark(p) /* empty */
+
+#endif /* PROFILE_STEP_ISR */
+
+#ifdef PROFILE_MATHS
+
+// time the maths functions, send clocks per call to the host
+void profile_maths(void);
+
+#endif /* PROFILE_MATHS */
+#endif /* _PROFILE_H */
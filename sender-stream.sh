@@ -0,0 +1,57 @@
+#!/bin/bash
+
+# Send a G-code file to firmware built with STREAMING, without waiting for
+# each "ok". Instead, count the characters of lines not acknowledged yet and
+# keep them within the receive buffer of the controller.
+#
+#     ./sender-stream.sh <G-code file>
+
+DEV=/dev/arduino
+BAUD=115200
+# RX_BUFFER_SIZE as reported by M115
+RXSIZE=63
+
+stty $BAUD raw ignbrk -hup -echo -ixon < $DEV
+
+(
+	# lengths of the lines sent but not acknowledged yet
+	PENDING=()
+	INFLIGHT=0
+
+	# wait for one line from the controller, forget the oldest line
+	# sent if it's an acknowledgement
+	function receive {
+		read -s -u 3
+		echo "< $REPLY"
+		case "$REPLY" in
+			ok*)
+				INFLIGHT=$(( INFLIGHT - PENDING[0] ))
+				PENDING=("${PENDING[@]:1}")
+				;;
+		esac
+	}
+
+	while read -r LINE
+	do
+		LINE="${LINE%$'\r'}"
+		LEN=$(( ${#LINE} + 1 ))
+		if [ $LEN -gt $RXSIZE ]
+		then
+			echo "line too long, skipped: $LINE" >&2
+			continue
+		fi
+		while [ $(( INFLIGHT + LEN )) -gt $RXSIZE ]
+		do
+			receive
+		done
+		echo "> $LINE"
+		echo "$LINE" >&3
+		PENDING+=($LEN)
+		INFLIGHT=$(( INFLIGHT + LEN ))
+	done < "$1"
+
+	while [ ${#PENDING[@]} -gt 0 ]
+	do
+		receive
+	done
+) 3<>$DEV
@@ -16,8 +16,8 @@
 #include  "config.h"
 #include  "arduino.h"
 
-/// size of TX and RX buffers. MUST be a \f$2^n\f$ value
-#define    BUFSIZE      64
+/// size of TX and RX buffers, see serial.h
+#define    BUFSIZE      SERIAL_BUFSIZE
 
 /// ascii XOFF character
 #define    ASCII_XOFF  19
@@ -70,6 +70,8 @@ volatile uint8_t txbuf[BUFSIZE];
   data = buf[tail++]; tail &= (BUFSIZE - 1);
 */
 
+uint8_t serial_written = 0;
+
 #ifdef  XONXOFF
 #define    FLOWFLAG_STATE_XOFF  0
 #define    FLOWFLAG_SEND_XON    1
@@ -222,6 +224,7 @@ void serial_writechar(uint8_t data)
   }
   // enable TX interrupt so we can send this character
   UCSR0B |= _BV(UDRIE0);
+  serial_written = 1;
 }
 
 /// send a whole block
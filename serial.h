@@ -5,6 +5,13 @@
 #include  <avr/io.h>
 #include  <avr/pgmspace.h>
 
+/// size of TX and RX buffers. MUST be a \f$2^n\f$ value
+#define SERIAL_BUFSIZE 64
+
+/// set whenever a character is written, clear it to see whether a piece of
+/// code sent something
+extern uint8_t serial_written;
+
 // initialise serial subsystem
 void serial_init(void);
 
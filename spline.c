@@ -0,0 +1,230 @@
+#include "spline.h"
+
+/** \file
+  \brief Splines - flatten G5/G5.1 curves into straight moves
+
+  A cubic Bézier curve, or a quadratic one for G5.1, becomes a series of
+  straight moves, each within SPLINE_TOLERANCE of the curve. Like the chords
+  of an arc, segments are queued one at a time by spline_segment(), called
+  from the main loop as the movebuffer has room.
+
+  Points along the curve come from forward differencing, three additions per
+  axis and segment. The step in the curve parameter t adapts to the curvature
+  as the curve goes: it's halved where a segment would stray too far from the
+  curve and doubled where the curve is almost straight, both done by shifting
+  and adding the differences. They're kept in 64 bit fixed point with 32
+  fractional bits, so rounding errors stay far below a micrometer even after
+  thousands of segments. The last segment ends exactly at the programmed
+  endpoint anyway.
+*/
+
+#include <string.h>
+
+#include "dda.h"
+#include "dda_queue.h"
+#include "dda_maths.h"
+#include "sersendf.h"
+
+#ifdef SPLINE_TOLERANCE
+
+/// finest step in t is \f$2^{-SPLINE_DEPTH}\f$, so at most 4096 segments
+#define SPLINE_DEPTH 12
+
+/// control points must be closer than this to the start, in micrometers,
+/// for the differences to fit
+#define SPLINE_EXTENT (1L << 24)
+
+/// micrometers to 32.32 fixed point
+#define SPLINE_FIXED(v) ((int64_t)(v) * 0x100000000LL)
+
+/// a segment strays from the curve by up to an eighth of flatness(1)
+#define SPLINE_LIMIT SPLINE_FIXED(8 * SPLINE_TOLERANCE)
+
+/// set while segments are still to be queued
+uint8_t spline_active = 0;
+
+/// everything needed to queue the next segment
+static struct {
+  int64_t point[2]; ///< X and Y relative to the start, 32.32
+  int64_t d1[2]; ///< first forward difference, i.e. the next segment, 32.32
+  int64_t d2[2]; ///< second forward difference, 32.32
+  int64_t d3[2]; ///< third forward difference, 32.32
+  int32_t start[2]; ///< X and Y of the start
+  int32_t z_start; ///< start on Z, which moves linearly along
+  int32_t z_delta; ///< travel along Z
+  int32_t smooth[2]; ///< last control point relative to the end, for a G5 without I and J after it
+  uint8_t smooth_valid; ///< whether the above is there
+  uint16_t t; ///< curve parameter, in units of the finest step
+  uint8_t depth; ///< step in t is \f$2^{-depth}\f$
+  TARGET target; ///< endpoint of the spline and its feedrate
+} spline;
+
+/// sum of \f$|\Delta^2| + w |\Delta^3|\f$ over both axes
+static uint64_t flatness(uint8_t w) {
+  uint64_t sum = 0;
+  uint8_t i;
+
+  for (i = 0; i < 2; i++) {
+    sum += (spline.d2[i] < 0) ? -spline.d2[i] : spline.d2[i];
+    sum += w * (uint64_t)((spline.d3[i] < 0) ? -spline.d3[i] : spline.d3[i]);
+  }
+
+  return sum;
+}
+
+/// some other move, the next G5 can't continue smoothly
+void spline_break() {
+  spline.smooth_valid = 0;
+}
+
+/** start a spline
+  \param cmd the G5 or G5.1, with the endpoint made absolute already
+  \param quadratic a G5.1, with one control point instead of two
+
+  The spline starts at \ref startpoint and is in the XY plane. I and J give
+  the first control point relative to the start, P and Q the second one
+  relative to the end. A G5 right after another G5 can leave out I and J to
+  continue smoothly, the control point is then the last one mirrored at the
+  start. A G5.1 has I and J only. Z moves linearly along.
+
+  Queues the first segment right away, the rest is left to spline_segment().
+*/
+void spline_start(GCODE_COMMAND *cmd, uint8_t quadratic) {
+  int32_t end[2], c1[2], c2[2], a, b, c;
+  uint8_t i;
+
+  if (cmd->seen_I || cmd->seen_J) {
+    c1[0] = cmd->seen_I ? cmd->I : 0;
+    c1[1] = cmd->seen_J ? cmd->J : 0;
+  }
+  else if ( ! quadratic && spline.smooth_valid) {
+    c1[0] = -spline.smooth[0];
+    c1[1] = -spline.smooth[1];
+  }
+  else {
+    sersendf_P(PSTR("E: Bad spline"));
+    return;
+  }
+
+  end[0] = cmd->target.X - startpoint.X;
+  end[1] = cmd->target.Y - startpoint.Y;
+  if (quadratic) {
+    c2[0] = c2[1] = 0;
+  }
+  else {
+    if ( ! cmd->seen_P || ! cmd->seen_Q) {
+      sersendf_P(PSTR("E: Bad spline"));
+      return;
+    }
+    // P is read as a time, convert it to a length like Q
+    spline.smooth[0] = cmd->option_inches ? muldiv(cmd->P, 254, 10) : cmd->P;
+    spline.smooth[1] = cmd->Q;
+    c2[0] = end[0] + spline.smooth[0];
+    c2[1] = end[1] + spline.smooth[1];
+  }
+  spline.smooth_valid = 0;
+
+  for (i = 0; i < 2; i++) {
+    if (end[i] >= SPLINE_EXTENT || end[i] <= -SPLINE_EXTENT ||
+        c1[i] >= SPLINE_EXTENT || c1[i] <= -SPLINE_EXTENT ||
+        c2[i] >= SPLINE_EXTENT || c2[i] <= -SPLINE_EXTENT) {
+      sersendf_P(PSTR("E: Bad spline"));
+      return;
+    }
+  }
+  spline.smooth_valid = ! quadratic;
+
+  memcpy(&spline.target, &cmd->target, sizeof(TARGET));
+  spline.start[0] = startpoint.X;
+  spline.start[1] = startpoint.Y;
+  spline.z_start = startpoint.Z;
+  spline.z_delta = cmd->target.Z - startpoint.Z;
+
+  // The curve as a polynomial a t^3 + b t^2 + c t, start and end at t = 0
+  // and t = 1, and its forward differences for a single step from 0 to 1.
+  for (i = 0; i < 2; i++) {
+    if (quadratic) {
+      a = 0;
+      b = end[i] - 2 * c1[i];
+      c = 2 * c1[i];
+    }
+    else {
+      a = 3 * (c1[i] - c2[i]) + end[i];
+      b = 3 * (c2[i] - 2 * c1[i]);
+      c = 3 * c1[i];
+    }
+    spline.point[i] = 0;
+    spline.d1[i] = SPLINE_FIXED(a + b + c);
+    spline.d2[i] = SPLINE_FIXED(6 * a + 2 * b);
+    spline.d3[i] = SPLINE_FIXED(6 * a);
+  }
+  spline.t = 0;
+  spline.depth = 0;
+
+  spline_active = 1;
+  spline_segment();
+}
+
+/** queue the next segment of the spline
+
+  Call this whenever \ref spline_active is set and the movebuffer isn't full,
+  before processing any other commands.
+
+  Segment \f$[t, t + h]\f$ strays from the curve by at most
+  \f$\max |f''| h^2 / 8\f$, which is the larger of \f$|\Delta^2|\f$ and
+  \f$|\Delta^2 - \Delta^3|\f$, divided by eight.
+*/
+void spline_segment() {
+  TARGET t;
+  uint16_t step;
+  uint8_t i;
+
+  if ( ! spline_active)
+    return;
+
+  // a finer step where the curve bends too much for the current one
+  while (spline.depth < SPLINE_DEPTH && flatness(1) > SPLINE_LIMIT) {
+    for (i = 0; i < 2; i++) {
+      spline.d3[i] >>= 3;
+      spline.d2[i] = (spline.d2[i] >> 2) - spline.d3[i];
+      spline.d1[i] = (spline.d1[i] - spline.d2[i]) >> 1;
+    }
+    spline.depth++;
+  }
+
+  step = 1U << (SPLINE_DEPTH - spline.depth);
+  spline.t += step;
+  if (spline.t >= (1U << SPLINE_DEPTH)) {
+    spline_active = 0;
+    enqueue(&spline.target);
+    return;
+  }
+
+  for (i = 0; i < 2; i++) {
+    spline.point[i] += spline.d1[i];
+    spline.d1[i] += spline.d2[i];
+    spline.d2[i] += spline.d3[i];
+  }
+
+  memcpy(&t, &spline.target, sizeof(TARGET));
+  t.X = spline.start[0] + (int32_t)((spline.point[0] + 0x80000000LL) >> 32);
+  t.Y = spline.start[1] + (int32_t)((spline.point[1] + 0x80000000LL) >> 32);
+  t.Z = spline.z_start +
+        muldiv(spline.z_delta, spline.t, 1UL << SPLINE_DEPTH);
+
+  // a coarser step where that stays within the tolerance, i.e. flatness(1)
+  // after doubling within the limit; only where t is a multiple of it
+  if (spline.depth && (spline.t & (2 * step - 1)) == 0 &&
+      flatness(3) <= SPLINE_LIMIT / 4) {
+    for (i = 0; i < 2; i++) {
+      spline.d1[i] = 2 * spline.d1[i] + spline.d2[i];
+      spline.d2[i] = 4 * (spline.d2[i] + spline.d3[i]);
+      spline.d3[i] = 8 * spline.d3[i];
+    }
+    spline.depth--;
+  }
+
+  enqueue(&t);
+}
+
+#endif /* SPLINE_TOLERANCE */
@@ -0,0 +1,25 @@
+#ifndef _SPLINE_H
+#define _SPLINE_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "gcode_parse.h"
+
+#ifdef SPLINE_TOLERANCE
+
+/// set while segments of a spline are still to be queued, see spline_segment()
+extern uint8_t spline_active;
+
+// start a spline from startpoint to cmd->target
+void spline_start(GCODE_COMMAND *cmd, uint8_t quadratic);
+
+// queue the next segment of the current spline
+void spline_segment(void);
+
+// some other move, a G5 after it can't continue smoothly
+void spline_break(void);
+
+#endif /* SPLINE_TOLERANCE */
+
+#endif  /* _SPLINE_H */
@@ -8,6 +8,11 @@
   We achieve this by using the output compare registers to generate the two clocks while the timer free-runs.
 
   Teacup has tried numerous timer management methods, and this is the best so far.
+
+  The timer's prescaler is chosen for each step delay, as fine as the delay
+  allows, so slow steps don't need intermediate interrupts. As the prescaler
+  changes, the system clock comparator and the microsecond timebase get
+  rebased, see timer_rescale().
 */
 
 #include <avr/interrupt.h>
@@ -19,6 +24,10 @@
 #ifdef HOST
 #include "dda_queue.h"
 #endif
+#ifdef STEP_PULSE_WIDTH
+#include "pinio.h"
+#endif
+#include "profile.h"
 
 
 /// how often we overflow and update our clock; with F_CPU=16MHz, max is < 4.096ms (TICK_TIME = 65535)
@@ -26,8 +35,25 @@
 /// convert back to ms from cpu ticks so our system clock runs properly if you change TICK_TIME
 #define TICK_TIME_MS (TICK_TIME / (F_CPU / 1000))
 
-/// time until next step, as output compare register is too small for long step times
-uint32_t next_step_time;
+/// timer clock is CPU clock >> timer_shift, see timer_rescale()
+uint8_t timer_shift = 0;
+/// prescaler shift for each timer clock select value
+static const uint8_t cs_shift[] = {0, 0, 3, 6, 8, 10};
+
+/// longest step delay the timer can do, in CPU clocks
+#define TIMER_MAX_DELAY (0xFFFFUL << 10)
+/// CPU clocks needed to safely set the step comparator ahead of the timer
+#define STEP_MARGIN 32
+
+#ifdef STEP_OC1A_AXIS
+uint8_t step_oc1a = 0;
+#endif
+
+/// set while the step interrupt runs, so setTimer() can tell chained steps from a new start
+volatile uint8_t step_interrupt_active = 0;
+
+/// CPU clocks of the system clock interval not yet put into OCR1B, due to prescaling
+uint16_t tick_remainder = 0;
 
 #ifdef ACCELERATION_TEMPORAL
 /// unwanted extra delays, ideally always zero
@@ -46,13 +72,59 @@ volatile uint8_t clock_flag_10ms = 0;
 volatile uint8_t clock_flag_250ms = 0;
 volatile uint8_t clock_flag_1s = 0;
 
+/// timer ticks per microsecond
+#define TICKS_PER_US (F_CPU / 1000000)
+
+/// microseconds since startup, up to the last timer overflow or prescaler change
+volatile uint32_t micros_epoch = 0;
+/// CPU clocks not yet accounted for in micros_epoch, always < TICKS_PER_US
+volatile uint8_t micros_epoch_ticks = 0;
+/// CPU clocks since startup, up to the same point as micros_epoch; wraps around
+volatile uint32_t clocks_epoch = 0;
+
+/// advance both epochs by a number of CPU clocks
+static void epoch_advance(uint32_t clocks) {
+  clocks_epoch += clocks;
+  clocks += micros_epoch_ticks;
+  micros_epoch += clocks / TICKS_PER_US;
+  micros_epoch_ticks = clocks % TICKS_PER_US;
+}
+
+/// CPU clocks since the epochs, including an overflow not yet handled by its interrupt. Interrupts must be locked.
+static uint32_t clocks_since_epoch(void) {
+  uint16_t ticks = TCNT1;
+  uint32_t clocks = (uint32_t)ticks << timer_shift;
+
+  // A small ticks value tells the overflow happened before we read TCNT1.
+  if ((TIFR1 & _BV(TOV1)) && ticks < 0x8000)
+    clocks += 0x10000UL << timer_shift;
+
+  return clocks;
+}
+
+/// timer overflow extends the 16 bit timer count to 32 bit epochs
+ISR(TIMER1_OVF_vect) {
+  // save status register
+  uint8_t sreg_save = SREG;
+
+  epoch_advance(0x10000UL << timer_shift);
+
+  // restore status register
+  MEMORY_BARRIER();
+  SREG = sreg_save;
+}
+
 /// comparator B is the system clock, happens every TICK_TIME
 ISR(TIMER1_COMPB_vect) {
   // save status register
   uint8_t sreg_save = SREG;
 
-  // set output compare register to the next clock tick
-  OCR1B = (OCR1B + TICK_TIME) & 0xFFFF;
+  // set output compare register to the next clock tick. With the timer
+  // prescaled, TICK_TIME isn't a whole number of timer clocks, so keep the
+  // rest for the next time.
+  tick_remainder += TICK_TIME;
+  OCR1B = (OCR1B + (tick_remainder >> timer_shift)) & 0xFFFF;
+  tick_remainder &= (1 << timer_shift) - 1;
 
   /*
   clock stuff
@@ -84,45 +156,49 @@ ISR(TIMER1_COMPB_vect) {
 
 /// comparator A is the step timer. It has higher priority then B.
 ISR(TIMER1_COMPA_vect) {
-  // save status register
-  uint8_t sreg_save = SREG;
+#ifdef PROFILE_STEP_ISR
+  // includes the interrupt prologue, but that's part of the latency, too
+  uint32_t profile_late = (uint32_t)(uint16_t)(TCNT1 - OCR1A) << timer_shift;
+  uint32_t profile_entry = timer_clocks();
+
+  profile_path = PROFILE_STEP;
+#endif
 
-  // Check if this is a real step, or just a next_step_time "overflow"
-  if (next_step_time < 65536) {
 #ifdef DEBUG_LED_PIN
-    // step!
-    WRITE(DEBUG_LED_PIN, 1);
+  // step!
+  WRITE(DEBUG_LED_PIN, 1);
 #endif
 
-    // disable this interrupt. if we set a new timeout, it will be re-enabled when appropriate
-    TIMSK1 &= ~_BV(OCIE1A);
+  // disable this interrupt. if we set a new timeout, it will be re-enabled when appropriate
+  TIMSK1 &= ~_BV(OCIE1A);
 
-    // stepper tick
-    queue_step();
+  // stepper tick
+  step_interrupt_active = 1;
+  queue_step();
+  step_interrupt_active = 0;
 
 #ifdef DEBUG_LED_PIN
-    // led off
-    WRITE(DEBUG_LED_PIN, 0);
+  // led off
+  WRITE(DEBUG_LED_PIN, 0);
 #endif
 
-    return;
-  }
-
-  next_step_time -= 65536;
+#ifdef PROFILE_STEP_ISR
+  profile_record(profile_late, timer_clocks() - profile_entry);
+#endif
+}
 
-  // similar algorithm as described in setTimer below.
-  if (next_step_time < 65536) {
-    OCR1A = (OCR1A + next_step_time) & 0xFFFF;
-  } else if(next_step_time < 75536) {
-    OCR1A = (OCR1A - 10000) & 0xFFFF;
-    next_step_time += 10000;
-  }
-  // leave OCR1A as it was
+#ifdef STEP_PULSE_WIDTH
+/// timer 2 comparator A ends step pulses, see step_pulse_start()
+ISR(TIMER2_COMPA_vect) {
+  // one shot
+  TCCR2B = 0;
 
-  // restore status register
-  MEMORY_BARRIER();
-  SREG = sreg_save;
+  unstep();
+#ifdef STEP_OC1A_AXIS
+  step_oc1a_end();
+#endif
 }
+#endif /* STEP_PULSE_WIDTH */
 
 #endif /* ifdef HOST */
 
@@ -136,8 +212,8 @@ void timer_init()
   TCCR1B = _BV(CS10);
   // set up "clock" comparator for first tick
   OCR1B = TICK_TIME & 0xFFFF;
-  // enable interrupt
-  TIMSK1 = _BV(OCIE1B);
+  // enable interrupts
+  TIMSK1 = _BV(OCIE1B) | _BV(TOIE1);
 
   //And again, for the Charge Pump output
   // e.g. 16MHz / 8 / _80_ = 2 * 12.5kHz => 80 = 16MHz / 2 * 12.5 kHz * 8
@@ -145,23 +221,145 @@ void timer_init()
   TCCR0A = _BV(COM0A0) | _BV(WGM01); // Toggle OC0A on compare and CTC mode
   TCCR0B = _BV(CS01); // 1/8 prescaler
   TIMSK0 = 0; // No interrupts
+
+#ifdef STEP_PULSE_WIDTH
+  // timer 2 times step pulses, it's started for each one
+  TCCR2A = 0;
+  TCCR2B = 0;
+  OCR2A = STEP_PULSE_TICKS;
+  TIMSK2 = _BV(OCIE2A);
+#endif
+}
+
+/*! CPU clocks since startup.
+  \return a CPU clock count, wrapping around after 268 seconds at 16 MHz
+
+  Safe to call from both interrupt and main loop context. Meant for measuring
+  short durations, resolution depends on the current timer prescaler.
+*/
+uint32_t timer_clocks() {
+  uint32_t clocks;
+
+  uint8_t sreg_save = SREG;
+  cli();
+  CLI_SEI_BUG_MEMORY_BARRIER();
+
+  clocks = clocks_epoch + clocks_since_epoch();
+
+  MEMORY_BARRIER();
+  SREG = sreg_save;
+
+  return clocks;
+}
+
+/*! Microseconds since startup.
+  \return a monotonic microsecond count, wrapping around after 71 minutes
+
+  Safe to call from both interrupt and main loop context. Resolution is
+  that of timer 1, which depends on the prescaler setTimer() chose for the
+  last step: a CPU clock for fast steps, up to 64 microseconds (1/1024 at
+  16 MHz) for slow ones. It stays that coarse while idle, until the next
+  move. Each prescaler change may also lose up to one timer clock of the
+  old resolution, see timer_rescale().
+*/
+uint32_t micros() {
+  uint32_t epoch, clocks;
+
+  uint8_t sreg_save = SREG;
+  cli();
+  CLI_SEI_BUG_MEMORY_BARRIER();
+
+  epoch = micros_epoch;
+  clocks = micros_epoch_ticks + clocks_since_epoch();
+
+  MEMORY_BARRIER();
+  SREG = sreg_save;
+
+  return epoch + clocks / TICKS_PER_US;
 }
 
 #ifdef HOST
+/*! Change the timer prescaler.
+  \param cs new clock select value for TCCR1B
+
+  Restarts the timer from zero with the new prescaler. Everything counted so
+  far goes into the epochs and the system clock comparator is moved to the
+  same time in the new timer resolution. The prescaler itself isn't reset,
+  so each change may lose up to one old timer clock.
+
+  Interrupts must be locked. The step comparator is up to the caller.
+*/
+static void timer_rescale(uint8_t cs) {
+  uint16_t now = TCNT1;
+  uint32_t elapsed, tick_left;
+  uint8_t shift = cs_shift[cs];
+
+  // with an overflow pending, a large now tells it happened just after
+  // reading TCNT1
+  elapsed = now;
+  if (TIFR1 & _BV(TOV1))
+    elapsed = (now < 0x8000) ? 0x10000UL + now : 0x10000UL;
+  elapsed <<= timer_shift;
+
+  // time until the next system clock tick; if that's due already, its
+  // interrupt is pending and will advance OCR1B from zero
+  if (TIFR1 & _BV(OCF1B))
+    tick_left = 0;
+  else
+    tick_left = (uint32_t)(uint16_t)(OCR1B - now) << timer_shift;
+
+  TCCR1B = cs;
+  TCNT1 = 0;
+  // clear a pending overflow, we counted it already
+  TIFR1 = _BV(TOV1);
+  timer_shift = shift;
+
+  OCR1B = tick_left >> shift;
+  tick_remainder += tick_left & ((1 << shift) - 1);
+  // a compare match is blocked right after writing TCNT1, so don't aim at
+  // zero unless the interrupt is pending anyway
+  if (OCR1B == 0 && (TIFR1 & _BV(OCF1B)) == 0)
+    OCR1B = 1;
+
+  epoch_advance(elapsed);
+}
+
+#ifdef PROFILE_MATHS
+/*! Count every CPU clock in TCNT1, for timing code.
+
+  The prescaler stays wherever the last step delay put it, which can be
+  1024 CPU clocks per timer clock. Only while no steps are going on, the
+  next setTimer() picks the prescaler it needs again.
+*/
+void timer_unscaled() {
+  uint8_t sreg_save = SREG;
+  cli();
+  CLI_SEI_BUG_MEMORY_BARRIER();
+
+  // clock select 1 is no prescaler
+  if ((TCCR1B & 0x07) != 1)
+    timer_rescale(1);
+
+  MEMORY_BARRIER();
+  SREG = sreg_save;
+}
+#endif /* PROFILE_MATHS */
+
 /*! Specify how long until the step timer should fire.
   \param delay in CPU ticks
 
+  Delays are limited to TIMER_MAX_DELAY, which is about 4.2 seconds at 16 MHz.
+  Longer ones are cut short, silently.
+
   This enables the step interrupt, but also disables interrupts globally.
   So, if you use it from inside the step interrupt, make sure to do so
   as late as possible. If you use it from outside the step interrupt,
   do a sei() after it to make the interrupt actually fire.
 */
 void setTimer(uint32_t delay) {
-  uint16_t step_start = 0;
-#ifdef ACCELERATION_TEMPORAL
-  uint16_t current_time;
-  uint32_t earliest_time, actual_time;
-#endif /* ACCELERATION_TEMPORAL */
+  uint16_t step_start, now, ticks, passed;
+  uint32_t elapsed;
+  uint8_t cs;
 
   // re-enable clock interrupt in case we're recovering from emergency stop
   TIMSK1 |= _BV(OCIE1B);
@@ -174,55 +372,57 @@ void setTimer(uint32_t delay) {
   // Assume all steps belong to one move. Within one move the delay is
   // from one step to the next one, which should be more or less the same
   // as from one step interrupt to the next one. The last step interrupt happend
-  // at OCR1A, so start delay from there.
-  step_start = OCR1A;
-  if (next_step_time == 0)
-    // new move, take current time as start value
-    step_start = TCNT1;
-
-  next_step_time = delay;
+  // at OCR1A, so start delay from there. Called from outside the step
+  // interrupt, there's no move running and OCR1A is stale.
+  now = TCNT1;
+  step_start = step_interrupt_active ? OCR1A : now;
+  // CPU clocks since then
+  elapsed = (uint32_t)(uint16_t)(now - step_start) << timer_shift;
 
 #ifdef ACCELERATION_TEMPORAL
-  // 300 = safe number of cpu cycles until the interrupt actually happens
-  current_time = TCNT1;
-  earliest_time = (uint32_t)current_time + 300;
-  if (current_time < step_start) // timer counter did overflow recently
-    earliest_time += 0x00010000;
-  actual_time = (uint32_t)step_start + next_step_time;
-
   // Setting the interrupt earlier than it can happen obviously doesn't
   // make sense. To keep the "belongs to one move" idea, add an extra,
   // remember this extra and compensate the extra if a longer delay comes in.
-  if (earliest_time > actual_time) {
-    step_extra_time += (earliest_time - actual_time);
-    next_step_time = earliest_time - (uint32_t)step_start;
+  // 300 = safe number of cpu cycles until the interrupt actually happens
+  if (elapsed + 300 > delay) {
+    step_extra_time += elapsed + 300 - delay;
+    delay = elapsed + 300;
   }
   else if (step_extra_time) {
-    if (step_extra_time < actual_time - earliest_time) {
-      next_step_time -= step_extra_time;
+    if (step_extra_time < delay - (elapsed + 300)) {
+      delay -= step_extra_time;
       step_extra_time = 0;
     }
     else {
-      step_extra_time -= (actual_time - earliest_time);
-      next_step_time -= (actual_time - earliest_time);
+      step_extra_time -= delay - (elapsed + 300);
+      delay = elapsed + 300;
     }
   }
 #endif /* ACCELERATION_TEMPORAL */
 
-  // Now we know how long we actually want to delay, so set the timer.
-  if (next_step_time < 65536) {
-    // set the comparator directly to the next real step
-    OCR1A = (next_step_time + step_start) & 0xFFFF;
-  } else if (next_step_time < 75536) {
-    // Next comparator interrupt would have to trigger another
-    // interrupt within a short time (possibly within 1 cycle).
-    // Avoid the impossible by firing the interrupt earlier.
-    OCR1A = (step_start - 10000) & 0xFFFF;
-    next_step_time += 10000;
-  } else {
-    OCR1A = step_start;
+  if (delay > TIMER_MAX_DELAY)
+    delay = TIMER_MAX_DELAY;
+
+  // finest timer resolution the delay fits into
+  for (cs = 1; (delay >> cs_shift[cs]) > 0xFFFF; cs++);
+  if (cs != (TCCR1B & 0x07)) {
+    timer_rescale(cs);
+    now = 0;
   }
 
+  // Now we know how long we actually want to delay, so set the timer. If
+  // we're too late already, fire as soon as possible. Setting the
+  // comparator to a time just passed would delay the step by a full timer
+  // round instead.
+  ticks = (delay > elapsed) ? (delay - elapsed) >> timer_shift : 0;
+  passed = TCNT1 - now;
+  if (ticks < passed + (STEP_MARGIN >> timer_shift) + 1)
+    ticks = passed + (STEP_MARGIN >> timer_shift) + 1;
+  OCR1A = (now + ticks) & 0xFFFF;
+
+  // a match of the old comparator value may be pending
+  TIFR1 = _BV(OCF1A);
+
   // Enable this interrupt, but only do it after disabling
   // global interrupts (see above). This will cause push any possible
   // timer1a interrupt to the far side of the return, protecting the 
@@ -232,9 +432,18 @@ void setTimer(uint32_t delay) {
 
 /// stop timers - emergency stop
 void timer_stop() {
-  // disable timer interrupts
-  TIMSK1 = 0;
+  // disable timer interrupts, except for the timebase
+  TIMSK1 = _BV(TOIE1);
+#ifdef STEP_OC1A_AXIS
+  // hand the step pin back to software, which keeps it low
+  step_oc1a = 0;
+  TCCR1A = 0;
+#endif
   // disable the charge pump
   TCCR2B = 0;
+#ifdef STEP_PULSE_WIDTH
+  // the pulse timer is stopped now, so end a pulse right here
+  unstep();
+#endif
 }
 #endif /* ifdef HOST */
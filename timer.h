@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <avr/io.h>
 
+#include "config.h"
+
 // time-related constants
 #define US * (F_CPU / 1000000)
 #define MS * (F_CPU / 1000)
@@ -19,6 +21,12 @@ extern volatile uint8_t clock_flag_1s;
 // and then clear the flag.
 #define ifclock(F) for (;F;F=0 )
 
+// microseconds since startup
+uint32_t micros(void);
+
+// CPU clocks since startup, for measuring short durations
+uint32_t timer_clocks(void);
+
 /*
 timer stuff
 */
@@ -26,4 +34,53 @@ void timer_init(void) __attribute__ ((cold));
 void setTimer(uint32_t delay);
 void timer_stop(void);
 
+#ifdef PROFILE_MATHS
+// count CPU clocks in TCNT1, with no steps going on
+void timer_unscaled(void);
+#endif
+
+#ifdef STEP_OC1A_AXIS
+/// set while the compare unit generates step pulses
+extern uint8_t step_oc1a;
+
+// let the compare unit raise the step pin on each match from now, or not;
+// call it after setTimer(), so the first match is the new compare value
+// a pulse still running is ended by step_oc1a_end() either way
+static void step_oc1a_start(uint8_t) __attribute__ ((always_inline));
+inline void step_oc1a_start(uint8_t enable) {
+  step_oc1a = enable;
+  if (enable)
+    TCCR1A = _BV(COM1A1) | _BV(COM1A0);
+}
+
+// end the current step pulse, continue with the next match if step_oc1a is
+// still set, else hand the pin back to software
+static void step_oc1a_end(void) __attribute__ ((always_inline));
+inline void step_oc1a_end() {
+  if (TCCR1A) {
+    // force the pin low by a forced match in clear mode
+    TCCR1A = _BV(COM1A1);
+    TCCR1C = _BV(FOC1A);
+    TCCR1A = step_oc1a ? (_BV(COM1A1) | _BV(COM1A0)) : 0;
+  }
+}
+#endif /* STEP_OC1A_AXIS */
+
+#ifdef STEP_PULSE_WIDTH
+/// timer 2 clocks of a step pulse, at 1/8 prescaler; rounded up and one more,
+/// as the prescaler isn't reset when the pulse starts
+#define STEP_PULSE_TICKS (((STEP_PULSE_WIDTH * (F_CPU / 1000000) + 7) >> 3) + 1)
+#if STEP_PULSE_WIDTH < 1 || STEP_PULSE_TICKS > 255
+  #error STEP_PULSE_WIDTH out of range
+#endif
+
+// start timing a step pulse, timer 2 ends it
+static void step_pulse_start(void) __attribute__ ((always_inline));
+inline void step_pulse_start() {
+  TCNT2 = 0;
+  TIFR2 = _BV(OCF2A);
+  TCCR2B = _BV(CS21);
+}
+#endif /* STEP_PULSE_WIDTH */
+
 #endif  /* _TIMER_H */
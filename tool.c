@@ -0,0 +1,127 @@
+#include "tool.h"
+
+/** \file
+  \brief Tool table - what's known about each tool
+
+  Tools are numbered from 1 to TOOL_TABLE, tool 0 is no tool at all. The
+  table holds length and radius of each tool, set with G10 L1 and used by
+  G43 and G41/G42. It's kept in EEPROM, each entry along with its CRC, so an
+  entry never written or damaged reads as zeros.
+*/
+
+#include <string.h>
+#include <avr/eeprom.h>
+
+#include "crc.h"
+#include "dda.h"
+#include "dda_queue.h"
+#include "sersendf.h"
+
+#ifdef TOOL_TABLE
+
+/// one entry of the tool table
+typedef struct {
+  int32_t length; ///< in micrometers, for G43
+  int32_t radius; ///< in micrometers, for G41 and G42
+} TOOL;
+
+/// an entry as kept in EEPROM
+typedef struct {
+  TOOL tool;
+  uint16_t crc; ///< of tool
+} EE_tool;
+
+EE_tool EEMEM EE_tools[TOOL_TABLE];
+
+/// the tool table, tool 1 first
+static TOOL tools[TOOL_TABLE];
+
+int32_t tool_length_offset = 0;
+
+/// read the tool table from EEPROM, zeroing entries with a bad CRC
+void tool_init() {
+  uint8_t i;
+  uint16_t crc;
+
+  for (i = 0; i < TOOL_TABLE; i++) {
+    eeprom_read_block(&tools[i], &EE_tools[i].tool, sizeof(TOOL));
+    eeprom_read_block(&crc, &EE_tools[i].crc, sizeof(uint16_t));
+    if (crc_block(&tools[i], sizeof(TOOL)) != crc)
+      memset(&tools[i], 0, sizeof(TOOL));
+  }
+}
+
+/** length of a tool
+  \param tool tool number
+  \return length in micrometers, zero for tool 0 and tools not in the table
+*/
+int32_t tool_length(uint8_t tool) {
+  if (tool == 0 || tool > TOOL_TABLE)
+    return 0;
+
+  return tools[tool - 1].length;
+}
+
+/** radius of a tool
+  \param tool tool number
+  \return radius in micrometers, zero for tool 0 and tools not in the table
+*/
+int32_t tool_radius(uint8_t tool) {
+  if (tool == 0 || tool > TOOL_TABLE)
+    return 0;
+
+  return tools[tool - 1].radius;
+}
+
+/** set length and radius of a tool and save them to EEPROM
+  \param tool tool number, 1 to TOOL_TABLE
+  \param length in micrometers
+  \param radius in micrometers, 0 to TOOL_RADIUS_MAX
+  \return zero if the tool or radius is out of range
+
+  Only bytes which changed are written, to spare the EEPROM.
+*/
+uint8_t tool_set(uint8_t tool, int32_t length, int32_t radius) {
+  uint16_t crc;
+
+  if (tool == 0 || tool > TOOL_TABLE || radius < 0 || radius > TOOL_RADIUS_MAX)
+    return 0;
+
+  tool--;
+  tools[tool].length = length;
+  tools[tool].radius = radius;
+  crc = crc_block(&tools[tool], sizeof(TOOL));
+  eeprom_update_block(&tools[tool], &EE_tools[tool].tool, sizeof(TOOL));
+  eeprom_update_block(&crc, &EE_tools[tool].crc, sizeof(uint16_t));
+
+  return 1;
+}
+
+#ifdef TOOL_CHANGE_Z
+/** go to where tools are changed and wait there
+  \param tool the tool to change to, for the message
+
+  Z goes up to TOOL_CHANGE_Z first, then X and Y go to TOOL_CHANGE_X and
+  TOOL_CHANGE_Y if these are defined. All are machine coordinates. Once
+  there, "Change tool" tells the host to pause until the tool is in.
+*/
+void tool_change(uint8_t tool) {
+  TARGET t;
+
+  memcpy(&t, &startpoint, sizeof(TARGET));
+  t.Z = (int32_t)(TOOL_CHANGE_Z * 1000.);
+  t.F = MAXIMUM_FEEDRATE_Z;
+  enqueue(&t);
+#if defined TOOL_CHANGE_X && defined TOOL_CHANGE_Y
+  t.X = (int32_t)(TOOL_CHANGE_X * 1000.);
+  t.Y = (int32_t)(TOOL_CHANGE_Y * 1000.);
+  t.F = MAXIMUM_FEEDRATE_X;
+  enqueue(&t);
+#endif
+  queue_wait();
+
+  sersendf_P(PSTR("Change tool %su"), tool);
+}
+#endif /* TOOL_CHANGE_Z */
+
+#endif /* TOOL_TABLE */
@@ -0,0 +1,35 @@
+#ifndef _TOOL_H
+#define _TOOL_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+#ifdef TOOL_TABLE
+
+/// largest tool radius, in micrometers, so its square fits 32 bits
+#define TOOL_RADIUS_MAX 65535L
+
+/// added to Z of absolute moves, set by G43 and G44, cleared by G49
+extern int32_t tool_length_offset;
+
+// read the tool table from EEPROM
+void tool_init(void);
+
+// length of a tool, zero for tool 0 and unknown tools
+int32_t tool_length(uint8_t tool);
+
+// radius of a tool, zero for tool 0 and unknown tools
+int32_t tool_radius(uint8_t tool);
+
+// set length and radius of a tool, returns zero if there's no such tool
+uint8_t tool_set(uint8_t tool, int32_t length, int32_t radius);
+
+#ifdef TOOL_CHANGE_Z
+// go to where tools are changed, for M6
+void tool_change(uint8_t tool);
+#endif
+
+#endif /* TOOL_TABLE */
+
+#endif  /* _TOOL_H */
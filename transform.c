@@ -0,0 +1,171 @@
+#include "transform.h"
+
+/** \file
+  \brief Transforms - G68 rotation, G51 scaling and M21/M22 mirroring
+
+  Mirroring about the axes, then scaling about the center given with G51,
+  then rotation about the center given with G68 all make up a single affine
+  transform of X and Y, a 2 by 2 matrix and a translation. It's worked out
+  once whenever one of them changes, so transforming a point takes four
+  multiplications, no matter what's on. With everything off,
+  \ref transform_active is clear and points aren't touched at all.
+
+  The matrix is fixed point with 24 fractional bits, which keeps rounding
+  errors below a micrometer anywhere on the bed, for scale factors up to
+  TRANSFORM_SCALE_MAX. Sine and cosine come from CORDIC, as for arcs.
+
+  Transforms apply to programmed coordinates, before any offsets, and to X
+  and Y only.
+*/
+
+#include "dda_maths.h"
+
+#ifdef TRANSFORM
+
+uint8_t transform_active = 0;
+
+uint8_t transform_mirrored = 0;
+
+/// what's on and the transform they make up
+static struct {
+  uint8_t mirror; ///< TRANSFORM_MIRROR_X and _Y
+  uint32_t scale; ///< scale factor, in thousandths
+  int32_t scale_x; ///< center of scaling, X
+  int32_t scale_y; ///< center of scaling, Y
+  int32_t angle; ///< of rotation, in binary angle units, counterclockwise
+  int32_t rotate_x; ///< center of rotation, X
+  int32_t rotate_y; ///< center of rotation, Y
+  int32_t xx; ///< matrix, X from X, 8.24
+  int32_t xy; ///< matrix, X from Y, 8.24
+  int32_t yx; ///< matrix, Y from X, 8.24
+  int32_t yy; ///< matrix, Y from Y, 8.24
+  int32_t x; ///< translation, X
+  int32_t y; ///< translation, Y
+} transform = {
+  .scale = 1000
+};
+
+/// a * b / 2^24, rounded, for multiplying with the matrix
+static int32_t mul_q24(int32_t a, int32_t b) {
+  uint32_t hi, lo, r;
+
+  hi = mul_wide((a < 0) ? -a : a, (b < 0) ? -b : b, &lo);
+  r = (hi << 8) + (lo >> 24) + ((lo >> 23) & 1);
+
+  return ((a < 0) != (b < 0)) ? -((int32_t)r) : (int32_t)r;
+}
+
+/** work out the transform from what's on
+
+  A point p becomes \f$R (c_s + s (M p - c_s) - c_r) + c_r\f$, with M the
+  mirroring, s the scale factor about \f$c_s\f$ and R the rotation about
+  \f$c_r\f$. That's \f$s R M p\f$ plus a translation.
+*/
+static void transform_update(void) {
+  int32_t c, s, x, y;
+
+  transform_active = transform.mirror || transform.scale != 1000 ||
+                     transform.angle;
+  transform_mirrored = transform.mirror == TRANSFORM_MIRROR_X ||
+                       transform.mirror == TRANSFORM_MIRROR_Y;
+  if ( ! transform_active)
+    return;
+
+  cordic_sincos(transform.angle, &c, &s);
+
+  // s R, from 2.30 to 8.24
+  transform.xx = transform.yy = muldiv(c, transform.scale, 64000);
+  transform.yx = muldiv(s, transform.scale, 64000);
+  transform.xy = -transform.yx;
+
+  // then M
+  if (transform.mirror & TRANSFORM_MIRROR_X) {
+    transform.xx = -transform.xx;
+    transform.yx = -transform.yx;
+  }
+  if (transform.mirror & TRANSFORM_MIRROR_Y) {
+    transform.xy = -transform.xy;
+    transform.yy = -transform.yy;
+  }
+
+  // R ((1 - s) c_s - c_r) + c_r
+  x = transform.scale_x - muldiv(transform.scale_x, transform.scale, 1000) -
+      transform.rotate_x;
+  y = transform.scale_y - muldiv(transform.scale_y, transform.scale, 1000) -
+      transform.rotate_y;
+  transform.x = mul_q30(x, c) - mul_q30(y, s) + transform.rotate_x;
+  transform.y = mul_q30(x, s) + mul_q30(y, c) + transform.rotate_y;
+}
+
+/** rotate
+  \param x center, X
+  \param y center, Y
+  \param angle in thousandths of a degree, counterclockwise, 0 turns
+  rotation off
+*/
+void transform_rotate(int32_t x, int32_t y, int32_t angle) {
+  // to binary angle units, a half turn either way at most
+  angle %= 360000L;
+  if (angle > 180000L)
+    angle -= 360000L;
+  else if (angle < -180000L)
+    angle += 360000L;
+
+  transform.angle = muldiv(angle, 0x80000000UL, 180000UL);
+  transform.rotate_x = x;
+  transform.rotate_y = y;
+  transform_update();
+}
+
+/** scale
+  \param x center, X
+  \param y center, Y
+  \param scale factor, in thousandths, 1000 turns scaling off
+  \return zero if the factor is out of range
+*/
+uint8_t transform_scale(int32_t x, int32_t y, uint32_t scale) {
+  if (scale == 0 || scale > TRANSFORM_SCALE_MAX)
+    return 0;
+
+  transform.scale = scale;
+  transform.scale_x = x;
+  transform.scale_y = y;
+  transform_update();
+
+  return 1;
+}
+
+/** mirror about the axes, i.e. X to -X and Y to -Y
+  \param axes TRANSFORM_MIRROR_X and/or TRANSFORM_MIRROR_Y, in addition to
+  those mirrored already, zero turns mirroring off
+*/
+void transform_mirror(uint8_t axes) {
+  if (axes)
+    transform.mirror |= axes;
+  else
+    transform.mirror = 0;
+  transform_update();
+}
+
+/// transform a point, in place
+void transform_point(int32_t *x, int32_t *y) {
+  int32_t t = *x;
+
+  *x = mul_q24(t, transform.xx) + mul_q24(*y, transform.xy) + transform.x;
+  *y = mul_q24(t, transform.yx) + mul_q24(*y, transform.yy) + transform.y;
+}
+
+/// transform a vector, like a relative move or the center of an arc, in place
+void transform_vector(int32_t *x, int32_t *y) {
+  int32_t t = *x;
+
+  *x = mul_q24(t, transform.xx) + mul_q24(*y, transform.xy);
+  *y = mul_q24(t, transform.yx) + mul_q24(*y, transform.yy);
+}
+
+/// scale a length, like the radius of an arc
+int32_t transform_length(int32_t length) {
+  return muldiv(length, transform.scale, 1000);
+}
+
+#endif /* TRANSFORM */
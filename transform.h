@@ -0,0 +1,44 @@
+#ifndef _TRANSFORM_H
+#define _TRANSFORM_H
+
+#include <stdint.h>
+
+#include "config.h"
+
+#ifdef TRANSFORM
+
+/// mirror X, M21
+#define TRANSFORM_MIRROR_X 1
+/// mirror Y, M22
+#define TRANSFORM_MIRROR_Y 2
+
+/// largest scale factor, in thousandths
+#define TRANSFORM_SCALE_MAX 100000UL
+
+/// set while any of rotation, scaling or mirroring is on
+extern uint8_t transform_active;
+
+/// set while exactly one axis is mirrored, which turns arcs around
+extern uint8_t transform_mirrored;
+
+// rotate about (x, y) by angle, in thousandths of a degree, G68
+void transform_rotate(int32_t x, int32_t y, int32_t angle);
+
+// scale about (x, y) by scale, in thousandths, G51
+uint8_t transform_scale(int32_t x, int32_t y, uint32_t scale);
+
+// mirror the axes given by TRANSFORM_MIRROR_X and _Y too, M21 to M23
+void transform_mirror(uint8_t axes);
+
+// transform a point, in place
+void transform_point(int32_t *x, int32_t *y);
+
+// transform a vector, i.e. a point relative to another one, in place
+void transform_vector(int32_t *x, int32_t *y);
+
+// scale a length
+int32_t transform_length(int32_t length);
+
+#endif /* TRANSFORM */
+
+#endif  /* _TRANSFORM_H */